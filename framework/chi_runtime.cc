@@ -168,13 +168,18 @@ int Chi::Initialize(int argc,
 {
   int location_id = 0, number_processes = 1;
 
-  MPI_Init(&argc, &argv);                           /* starts MPI */
+  // Sweeps can execute angle sets on worker threads, all MPI calls are
+  // however made from the main thread.
+  int thread_support_provided = MPI_THREAD_SINGLE;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED,
+                  &thread_support_provided);        /* starts MPI */
   MPI_Comm_rank(communicator, &location_id);      /* get cur process id */
   MPI_Comm_size(communicator, &number_processes); /* get num of processes */
 
   mpi.SetCommunicator(communicator);
   mpi.SetLocationID(location_id);
   mpi.SetProcessCount(number_processes);
+  mpi.SetThreadSupport(thread_support_provided);
 
   Chi::console.LoadRegisteredLuaItems();
   Chi::console.PostMPIInfo(location_id, number_processes);
@@ -0,0 +1,101 @@
+#ifndef CHITECH_FLAT_INDEX_MAP_H
+#define CHITECH_FLAT_INDEX_MAP_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <limits>
+
+namespace chi_data_types
+{
+  /**Map from 64-bit keys, e.g. global ids, to 64-bit indices stored in a
+   * single contiguous open-addressing table with linear probing. Lookups
+   * are O(1) and touch one or two cache lines, as opposed to the pointer
+   * chasing of node based maps. The largest key value is reserved and can
+   * not be stored. Entries can not be erased individually.*/
+  class FlatIndexMap
+  {
+  public:
+    static constexpr uint64_t EMPTY_KEY = std::numeric_limits<uint64_t>::max();
+
+  private:
+    struct Entry
+    {
+      uint64_t key = EMPTY_KEY;
+      uint64_t value = 0;
+    };
+    std::vector<Entry> table_;
+    size_t             size_ = 0;
+
+    /**SplitMix64 finalizer, scrambling sequential keys over the table.*/
+    static uint64_t Hash(uint64_t key)
+    {
+      key ^= key >> 30; key *= 0xbf58476d1ce4e5b9ULL;
+      key ^= key >> 27; key *= 0x94d049bb133111ebULL;
+      key ^= key >> 31;
+      return key;
+    }
+
+    size_t Slot(uint64_t key) const
+    {
+      const size_t mask = table_.size() - 1;
+      size_t slot = Hash(key) & mask;
+      while (table_[slot].key != key and table_[slot].key != EMPTY_KEY)
+        slot = (slot + 1) & mask;
+      return slot;
+    }
+
+    void Rehash(size_t capacity)
+    {
+      std::vector<Entry> old_table(capacity);
+      old_table.swap(table_);
+      for (const auto& entry : old_table)
+        if (entry.key != EMPTY_KEY) table_[Slot(entry.key)] = entry;
+    }
+
+  public:
+    /**Prepares the table for the given number of entries.*/
+    void Reserve(size_t num_entries)
+    {
+      size_t capacity = 16;
+      while (capacity < 2 * num_entries) capacity *= 2;
+      if (capacity > table_.size()) Rehash(capacity);
+    }
+
+    /**Inserts a key-value pair. Like `std::map::insert`, an existing entry
+     * is not overwritten, in which case false is returned.*/
+    bool Insert(uint64_t key, uint64_t value)
+    {
+      if (2 * (size_ + 1) > table_.size()) Reserve(size_ + 1);
+
+      auto& entry = table_[Slot(key)];
+      if (entry.key == key) return false;
+
+      entry.key = key;
+      entry.value = value;
+      ++size_;
+      return true;
+    }
+
+    /**Returns a pointer to the value of a key, or nullptr if the key is not
+     * in the map.*/
+    const uint64_t* Find(uint64_t key) const
+    {
+      if (table_.empty()) return nullptr;
+      const auto& entry = table_[Slot(key)];
+      return entry.key == key ? &entry.value : nullptr;
+    }
+
+    size_t Count(uint64_t key) const {return Find(key) ? 1 : 0;}
+    size_t Size() const {return size_;}
+
+    void Clear()
+    {
+      table_.clear();
+      table_.shrink_to_fit();
+      size_ = 0;
+    }
+  };
+}//namespace chi_data_types
+
+#endif //CHITECH_FLAT_INDEX_MAP_H
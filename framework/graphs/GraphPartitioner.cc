@@ -1,5 +1,10 @@
 #include "GraphPartitioner.h"
 
+#include "mesh/chi_mesh.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
 namespace chi
 {
 
@@ -15,4 +20,26 @@ GraphPartitioner::GraphPartitioner(const InputParameters& params)
 {
 }
 
+// ##################################################################
+/**Given the rows [row_offset, row_offset + graph.size()) of a graph that
+ * is distributed over all locations, returns the partition ids of the
+ * local rows. Must be called by all locations.
+ *
+ * Partitioning a distributed graph is only supported by partitioners that
+ * override this method. The default throws, since gathering the graph on
+ * every location would defeat the purpose of a distributed setup.*/
+std::vector<int64_t> GraphPartitioner::PartitionDistributed(
+  const std::vector<std::vector<uint64_t>>&,
+  const std::vector<chi_mesh::Vector3>&,
+  uint64_t,
+  uint64_t,
+  int)
+{
+  ChiLogicalError("This graph partitioner does not support distributed "
+                  "graphs. Use a partitioner supporting them, e.g. "
+                  "LinearGraphPartitioner, KBAGraphPartitioner, "
+                  "SFCGraphPartitioner or PETScGraphPartitioner, or "
+                  "disable \"distributed_setup\".");
+}
+
 } // namespace chi
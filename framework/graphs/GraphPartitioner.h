@@ -22,9 +22,29 @@ public:
             const std::vector<chi_mesh::Vector3>& centroids,
             int number_of_parts) = 0;
 
+  /**Given the rows [row_offset, row_offset + graph.size()) of a graph that
+   * is distributed over all locations, returns the partition ids of the
+   * local rows. Must be called by all locations.*/
+  virtual std::vector<int64_t>
+  PartitionDistributed(const std::vector<std::vector<uint64_t>>& local_graph,
+                       const std::vector<chi_mesh::Vector3>& local_centroids,
+                       uint64_t row_offset,
+                       uint64_t num_global_rows,
+                       int number_of_parts);
+
+  /**Sets the work weights of the rows of the next graph to be partitioned,
+   * for the distributed variant only those of the local rows. Partitioners
+   * ignoring weights treat all rows as having unit weight.*/
+  void SetRowWeights(std::vector<double> row_weights)
+  {
+    row_weights_ = std::move(row_weights);
+  }
+
 protected:
   static InputParameters GetInputParameters();
   explicit GraphPartitioner(const InputParameters& params);
+
+  std::vector<double> row_weights_;
 };
 
 } // namespace chi
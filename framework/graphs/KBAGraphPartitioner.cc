@@ -144,4 +144,17 @@ KBAGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph,
   return real_pids;
 }
 
+/**Given the local rows of a distributed graph. Returns the partition ids of
+ * the local rows. The partition of each row only depends on its centroid,
+ * hence the local rows are partitioned without communication.*/
+std::vector<int64_t> KBAGraphPartitioner::PartitionDistributed(
+  const std::vector<std::vector<uint64_t>>& local_graph,
+  const std::vector<chi_mesh::Vector3>& local_centroids,
+  uint64_t,
+  uint64_t,
+  int number_of_parts)
+{
+  return Partition(local_graph, local_centroids, number_of_parts);
+}
+
 } // namespace chi
\ No newline at end of file
@@ -19,6 +19,13 @@ public:
             const std::vector<chi_mesh::Vector3>& centroids,
             int number_of_parts) override;
 
+  std::vector<int64_t>
+  PartitionDistributed(const std::vector<std::vector<uint64_t>>& local_graph,
+                       const std::vector<chi_mesh::Vector3>& local_centroids,
+                       uint64_t row_offset,
+                       uint64_t num_global_rows,
+                       int number_of_parts) override;
+
 protected:
   const size_t nx_, ny_, nz_;
   const std::vector<double> xcuts_, ycuts_, zcuts_;
@@ -2,6 +2,7 @@
 
 #include "ChiObjectFactory.h"
 #include "utils/chi_utils.h"
+#include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh_slab.h"
 
 #include "chi_log.h"
 
@@ -54,4 +55,26 @@ std::vector<int64_t> LinearGraphPartitioner::Partition(
   return pids;
 }
 
+/**Given the local rows of a distributed graph. Returns the partition ids of
+ * the local rows. Each row's partition follows directly from its global
+ * index, hence no communication is needed.*/
+std::vector<int64_t> LinearGraphPartitioner::PartitionDistributed(
+  const std::vector<std::vector<uint64_t>>& local_graph,
+  const std::vector<chi_mesh::Vector3>&,
+  uint64_t row_offset,
+  uint64_t num_global_rows,
+  int number_of_parts)
+{
+  typedef chi_mesh::UnpartitionedMeshSlab Slab;
+  Chi::log.Log0Verbose1() << "Partitioning with LinearGraphPartitioner";
+
+  std::vector<int64_t> pids(local_graph.size(), 0);
+  for (size_t r = 0; r < local_graph.size(); ++r)
+    pids[r] =
+      Slab::BlockOwner(row_offset + r, num_global_rows, number_of_parts);
+
+  Chi::log.Log0Verbose1() << "Done partitioning with LinearGraphPartitioner";
+  return pids;
+}
+
 } // namespace chi
\ No newline at end of file
@@ -1,12 +1,15 @@
 #include "PETScGraphPartitioner.h"
 
 #include "ChiObjectFactory.h"
+#include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh_slab.h"
 
 #include "petsc.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
 
+#include <algorithm>
+
 namespace chi
 {
 
@@ -21,20 +24,74 @@ InputParameters PETScGraphPartitioner::GetInputParameters()
 
   params.AddOptionalParameter(
     "type", "parmetis", "The type of PETSc partitioner");
+  params.AddOptionalParameter(
+    "parallel",
+    false,
+    "If true, replicated graphs are partitioned in parallel by all "
+    "locations, each contributing a block of rows, instead of serially on "
+    "the home location. Distributed graphs are always partitioned in "
+    "parallel.");
 
   return params;
 }
 
 PETScGraphPartitioner::PETScGraphPartitioner(const InputParameters& params)
-  : GraphPartitioner(params), type_(params.GetParamValue<std::string>("type"))
+  : GraphPartitioner(params),
+    type_(params.GetParamValue<std::string>("type")),
+    parallel_(params.GetParamValue<bool>("parallel"))
 {
 }
 
+/**Given a graph. Returns the partition ids of each row in the graph.
+ *
+ * By default the graph is partitioned serially on the home location. With
+ * "parallel" set, and at least one row per location, the rows are instead
+ * divided into contiguous blocks, one per location, which are partitioned in
+ * parallel with PartitionDistributed, after which the partition ids are
+ * gathered on all locations. Must be called by all locations.*/
 std::vector<int64_t> PETScGraphPartitioner::Partition(
   const std::vector<std::vector<uint64_t>>& graph,
   const std::vector<chi_mesh::Vector3>&,
   int number_of_parts)
 {
+  //================================================== Partition in parallel
+  // Every location must own at least one row of the adjacency matrix.
+  const int P = Chi::mpi.process_count;
+  const uint64_t num_rows = graph.size();
+  if (parallel_ and P > 1 and num_rows >= static_cast<uint64_t>(P))
+  {
+    typedef chi_mesh::UnpartitionedMeshSlab Slab;
+
+    std::vector<int> counts(P, 0);
+    std::vector<int> displs(P, 0);
+    for (int p = 0; p < P; ++p)
+    {
+      const auto [row_begin, row_end] = Slab::BlockRange(num_rows, p, P);
+      counts[p] = static_cast<int>(row_end - row_begin);
+      displs[p] = static_cast<int>(row_begin);
+    }
+
+    const auto [row_begin, row_end] =
+      Slab::BlockRange(num_rows, Chi::mpi.location_id, P);
+    const std::vector<std::vector<uint64_t>> local_graph(
+      graph.begin() + static_cast<int64_t>(row_begin),
+      graph.begin() + static_cast<int64_t>(row_end));
+
+    const auto local_pids = PartitionDistributed(
+      local_graph, {}, row_begin, num_rows, number_of_parts);
+
+    std::vector<int64_t> cell_pids(num_rows, 0);
+    MPI_Allgatherv(local_pids.data(),
+                   counts[Chi::mpi.location_id],
+                   MPI_INT64_T,
+                   cell_pids.data(),
+                   counts.data(),
+                   displs.data(),
+                   MPI_INT64_T,
+                   Chi::mpi.comm);
+    return cell_pids;
+  }
+
   Chi::log.Log0Verbose1() << "Partitioning with PETScGraphPartitioner";
   //================================================== Determine avg num faces
   //                                                   per cell
@@ -137,4 +194,100 @@ std::vector<int64_t> PETScGraphPartitioner::Partition(
   return cell_pids;
 }
 
-} // namespace chi
\ No newline at end of file
+/**Given the local rows of a distributed graph. Returns the partition ids of
+ * the local rows.
+ *
+ * The adjacency matrix is distributed over all locations, each location
+ * owning its own rows, and the partitioning is performed in parallel on the
+ * world communicator (e.g. with ParMETIS or PTScotch). No location ever
+ * holds more than its own rows of the graph.*/
+std::vector<int64_t> PETScGraphPartitioner::PartitionDistributed(
+  const std::vector<std::vector<uint64_t>>& local_graph,
+  const std::vector<chi_mesh::Vector3>&,
+  uint64_t row_offset,
+  uint64_t num_global_rows,
+  int number_of_parts)
+{
+  Chi::log.Log0Verbose1() << "Partitioning in parallel with "
+                             "PETScGraphPartitioner";
+
+  const size_t num_local_rows = local_graph.size();
+  std::vector<int64_t> pids(num_local_rows, 0);
+  if (num_global_rows <= 1 or number_of_parts <= 1) return pids;
+
+  // The parallel partitioners fail on locations without rows
+  uint64_t local_num_rows = num_local_rows;
+  uint64_t min_num_rows = 0;
+  MPI_Allreduce(&local_num_rows,
+                &min_num_rows,
+                1,
+                MPI_UINT64_T,
+                MPI_MIN,
+                Chi::mpi.comm);
+  ChiLogicalErrorIf(min_num_rows == 0,
+                    "Parallel partitioning requires every location to own "
+                    "at least one row of the graph.");
+
+  //================================================== Build indices
+  // The diagonal entries are excluded and the column indices of each row are
+  // sorted, as required by the parallel partitioners.
+  size_t num_local_entries = 0;
+  for (const auto& row : local_graph)
+    num_local_entries += row.size();
+
+  int64_t* i_indices_raw;
+  int64_t* j_indices_raw;
+  PetscMalloc((num_local_rows + 1) * sizeof(int64_t), &i_indices_raw);
+  PetscMalloc(std::max<size_t>(num_local_entries, 1) * sizeof(int64_t),
+              &j_indices_raw);
+  {
+    int64_t icount = 0;
+    for (size_t i = 0; i < num_local_rows; ++i)
+    {
+      i_indices_raw[i] = icount;
+      const auto row_id = static_cast<uint64_t>(row_offset + i);
+
+      int64_t* row_begin = j_indices_raw + icount;
+      for (const uint64_t neighbor_id : local_graph[i])
+        if (neighbor_id != row_id)
+          j_indices_raw[icount++] = static_cast<int64_t>(neighbor_id);
+      std::sort(row_begin, j_indices_raw + icount);
+    }
+    i_indices_raw[num_local_rows] = icount;
+  }
+
+  //================================================== Create adjacency matrix
+  Mat Adj; // Adjacency matrix
+  MatCreateMPIAdj(Chi::mpi.comm,
+                  static_cast<int64_t>(num_local_rows),
+                  static_cast<int64_t>(num_global_rows),
+                  i_indices_raw,
+                  j_indices_raw,
+                  nullptr,
+                  &Adj);
+
+  //================================================== Create partitioning
+  MatPartitioning part;
+  IS is;
+  MatPartitioningCreate(Chi::mpi.comm, &part);
+  MatPartitioningSetAdjacency(part, Adj);
+  MatPartitioningSetType(part, type_.c_str());
+  MatPartitioningSetNParts(part, number_of_parts);
+  MatPartitioningApply(part, &is);
+  MatPartitioningDestroy(&part);
+  MatDestroy(&Adj);
+
+  //================================================== Get the local pids
+  const int64_t* cell_pids_raw;
+  ISGetIndices(is, &cell_pids_raw);
+  for (size_t i = 0; i < num_local_rows; ++i)
+    pids[i] = cell_pids_raw[i];
+  ISRestoreIndices(is, &cell_pids_raw);
+  ISDestroy(&is);
+
+  Chi::log.Log0Verbose1() << "Done partitioning in parallel with "
+                             "PETScGraphPartitioner";
+  return pids;
+}
+
+} // namespace chi
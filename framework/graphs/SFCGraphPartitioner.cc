@@ -0,0 +1,262 @@
+#include "SFCGraphPartitioner.h"
+
+#include "ChiObjectFactory.h"
+#include "utils/chi_utils.h"
+
+#include "mesh/chi_mesh.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+namespace chi
+{
+
+RegisterChiObject(chi, SFCGraphPartitioner);
+
+InputParameters SFCGraphPartitioner::GetInputParameters()
+{
+  InputParameters params = GraphPartitioner::GetInputParameters();
+
+  // clang-format off
+  params.SetGeneralDescription("Space-filling curve partitioning. "
+"Orders the cells along a Hilbert curve through their centroids and cuts the "
+"curve into pieces with equal numbers of cells. It does not look at the graph "
+"and needs no external library, partitioning distributed graphs in parallel.");
+  // clang-format on
+  params.SetDocGroup("Graphs");
+
+  return params;
+}
+
+SFCGraphPartitioner::SFCGraphPartitioner(const InputParameters& params)
+  : GraphPartitioner(params)
+{
+}
+
+// ##################################################################
+/**Returns the Hilbert key of a point with the given integer coordinates,
+ * each of which must be less than 2^21. Uses Skilling's transposition of
+ * the coordinates into the Hilbert index (AIP Conf. Proc. 707, 2004).*/
+uint64_t SFCGraphPartitioner::HilbertKey(std::array<uint32_t, 3> coordinates)
+{
+  const int num_bits = 21;
+  auto& X = coordinates;
+
+  //============================================= Inverse undo excess work
+  const uint32_t M = 1u << (num_bits - 1);
+  for (uint32_t Q = M; Q > 1; Q >>= 1)
+  {
+    const uint32_t P = Q - 1;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (X[i] & Q) X[0] ^= P;
+      else
+      {
+        const uint32_t t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  //============================================= Gray encode
+  for (int i = 1; i < 3; ++i)
+    X[i] ^= X[i - 1];
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1)
+    if (X[2] & Q) t ^= Q - 1;
+  for (int i = 0; i < 3; ++i)
+    X[i] ^= t;
+
+  //============================================= Interleave the bits
+  uint64_t key = 0;
+  for (int b = num_bits - 1; b >= 0; --b)
+    for (int i = 0; i < 3; ++i)
+      key = (key << 1) | ((X[i] >> b) & 1u);
+
+  return key;
+}
+
+// ##################################################################
+/**Returns the Hilbert keys of the centroids relative to the given
+ * bounding box.*/
+std::vector<uint64_t> SFCGraphPartitioner::ComputeKeys(
+  const std::vector<chi_mesh::Vector3>& centroids,
+  const std::array<double, 3>& bbox_min,
+  const std::array<double, 3>& bbox_max)
+{
+  const double max_coordinate = static_cast<double>((1u << 21) - 1);
+
+  std::vector<uint64_t> keys;
+  keys.reserve(centroids.size());
+  for (const auto& centroid : centroids)
+  {
+    std::array<uint32_t, 3> X = {0, 0, 0};
+    for (int d = 0; d < 3; ++d)
+    {
+      const double extent = bbox_max[d] - bbox_min[d];
+      if (extent <= 0.0) continue;
+      const double s = (centroid[d] - bbox_min[d]) / extent;
+      X[d] = static_cast<uint32_t>(std::clamp(s, 0.0, 1.0) * max_coordinate);
+    }
+    keys.push_back(HilbertKey(X));
+  }
+
+  return keys;
+}
+
+// ##################################################################
+/**Given a graph. Returns the partition ids of each row in the graph.*/
+std::vector<int64_t> SFCGraphPartitioner::Partition(
+  const std::vector<std::vector<uint64_t>>& graph,
+  const std::vector<chi_mesh::Vector3>& centroids,
+  int number_of_parts)
+{
+  Chi::log.Log0Verbose1() << "Partitioning with SFCGraphPartitioner";
+
+  ChiInvalidArgumentIf(centroids.size() != graph.size(),
+                       "Graph number of entries not equal to centroids' "
+                       "number of entries.");
+
+  //============================================= Bounding box
+  std::array<double, 3> bbox_min = {0.0, 0.0, 0.0};
+  std::array<double, 3> bbox_max = {0.0, 0.0, 0.0};
+  if (not centroids.empty())
+    for (int d = 0; d < 3; ++d)
+    {
+      bbox_min[d] = bbox_max[d] = centroids.front()[d];
+      for (const auto& centroid : centroids)
+      {
+        bbox_min[d] = std::min(bbox_min[d], centroid[d]);
+        bbox_max[d] = std::max(bbox_max[d], centroid[d]);
+      }
+    }
+
+  //============================================= Sort along the curve
+  const auto keys = ComputeKeys(centroids, bbox_min, bbox_max);
+
+  std::vector<size_t> order(graph.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(),
+                   order.end(),
+                   [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+  //============================================= Cut the curve
+  const auto sub_sets = chi::MakeSubSets(graph.size(), number_of_parts);
+
+  std::vector<int64_t> pids(graph.size(), 0);
+  size_t n = 0;
+  for (int k = 0; k < number_of_parts; ++k)
+    for (size_t m = 0; m < sub_sets[k].ss_size; ++m)
+      pids[order[n++]] = k;
+
+  Chi::log.Log0Verbose1() << "Done partitioning with SFCGraphPartitioner";
+  return pids;
+}
+
+// ##################################################################
+/**Given the local rows of a distributed graph. Returns the partition ids of
+ * the local rows.
+ *
+ * The curve is cut without gathering the keys: the cut key values are found
+ * with a simultaneous bisection of the key range, requiring one reduction
+ * of the number of keys below each cut per bit of the keys. A cut is the
+ * smallest key having at least the target number of keys at or below it.*/
+std::vector<int64_t> SFCGraphPartitioner::PartitionDistributed(
+  const std::vector<std::vector<uint64_t>>& local_graph,
+  const std::vector<chi_mesh::Vector3>& local_centroids,
+  uint64_t,
+  uint64_t num_global_rows,
+  int number_of_parts)
+{
+  Chi::log.Log0Verbose1() << "Partitioning in parallel with "
+                             "SFCGraphPartitioner";
+
+  ChiInvalidArgumentIf(local_centroids.size() != local_graph.size(),
+                       "Graph number of entries not equal to centroids' "
+                       "number of entries.");
+
+  //============================================= Global bounding box
+  double local_bounds[6];
+  for (int d = 0; d < 3; ++d)
+  {
+    local_bounds[d] = std::numeric_limits<double>::max();
+    local_bounds[3 + d] = std::numeric_limits<double>::max();
+    for (const auto& centroid : local_centroids)
+    {
+      local_bounds[d] = std::min(local_bounds[d], centroid[d]);
+      local_bounds[3 + d] = std::min(local_bounds[3 + d], -centroid[d]);
+    }
+  }
+  double global_bounds[6];
+  MPI_Allreduce(
+    local_bounds, global_bounds, 6, MPI_DOUBLE, MPI_MIN, Chi::mpi.comm);
+
+  const std::array<double, 3> bbox_min = {
+    global_bounds[0], global_bounds[1], global_bounds[2]};
+  const std::array<double, 3> bbox_max = {
+    -global_bounds[3], -global_bounds[4], -global_bounds[5]};
+
+  //============================================= Compute and sort keys
+  const auto keys = ComputeKeys(local_centroids, bbox_min, bbox_max);
+  std::vector<uint64_t> sorted_keys = keys;
+  std::sort(sorted_keys.begin(), sorted_keys.end());
+
+  auto NumKeysAtOrBelow = [&sorted_keys](uint64_t value)
+  {
+    return static_cast<uint64_t>(
+      std::upper_bound(sorted_keys.begin(), sorted_keys.end(), value) -
+      sorted_keys.begin());
+  };
+
+  //============================================= Bisect the cuts
+  // Cut k separates part k from part k+1.
+  const size_t num_cuts = std::max(number_of_parts - 1, 0);
+  const auto sub_sets = chi::MakeSubSets(num_global_rows, number_of_parts);
+
+  std::vector<uint64_t> lo(num_cuts, 0);
+  std::vector<uint64_t> hi(num_cuts, uint64_t{1} << 63);
+  std::vector<uint64_t> local_counts(num_cuts, 0);
+  std::vector<uint64_t> global_counts(num_cuts, 0);
+  for (int bit = 0; bit < 64 and num_cuts > 0; ++bit)
+  {
+    for (size_t k = 0; k < num_cuts; ++k)
+      local_counts[k] = NumKeysAtOrBelow(lo[k] + (hi[k] - lo[k]) / 2);
+
+    MPI_Allreduce(local_counts.data(),
+                  global_counts.data(),
+                  static_cast<int>(num_cuts),
+                  MPI_UINT64_T,
+                  MPI_SUM,
+                  Chi::mpi.comm);
+
+    bool converged = true;
+    for (size_t k = 0; k < num_cuts; ++k)
+    {
+      const uint64_t mid = lo[k] + (hi[k] - lo[k]) / 2;
+      const uint64_t target = sub_sets[k].ss_end + 1;
+      if (global_counts[k] >= target) hi[k] = mid;
+      else
+        lo[k] = mid + 1;
+      if (lo[k] < hi[k]) converged = false;
+    }
+    if (converged) break;
+  }
+
+  //============================================= Assign parts
+  std::vector<int64_t> pids(local_graph.size(), 0);
+  for (size_t i = 0; i < keys.size(); ++i)
+    pids[i] = static_cast<int64_t>(
+      std::lower_bound(hi.begin(), hi.end(), keys[i]) - hi.begin());
+
+  Chi::log.Log0Verbose1() << "Done partitioning in parallel with "
+                             "SFCGraphPartitioner";
+  return pids;
+}
+
+} // namespace chi
@@ -0,0 +1,46 @@
+#ifndef CHITECH_SFCGRAPHPARTITIONER_H
+#define CHITECH_SFCGRAPHPARTITIONER_H
+
+#include "GraphPartitioner.h"
+
+#include <array>
+
+namespace chi
+{
+
+/**Geometric partitioner ordering the graph rows along a Hilbert
+ * space-filling curve through their centroids and cutting the curve into
+ * equally sized pieces. Requires no external partitioning library.*/
+class SFCGraphPartitioner : public GraphPartitioner
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit SFCGraphPartitioner(const InputParameters& params);
+
+  std::vector<int64_t>
+  Partition(const std::vector<std::vector<uint64_t>>& graph,
+            const std::vector<chi_mesh::Vector3>& centroids,
+            int number_of_parts) override;
+
+  std::vector<int64_t>
+  PartitionDistributed(const std::vector<std::vector<uint64_t>>& local_graph,
+                       const std::vector<chi_mesh::Vector3>& local_centroids,
+                       uint64_t row_offset,
+                       uint64_t num_global_rows,
+                       int number_of_parts) override;
+
+  /**Returns the Hilbert key of a point with the given integer coordinates,
+   * each of which must be less than 2^21.*/
+  static uint64_t HilbertKey(std::array<uint32_t, 3> coordinates);
+
+  /**Returns the Hilbert keys of the centroids relative to the given
+   * bounding box.*/
+  static std::vector<uint64_t>
+  ComputeKeys(const std::vector<chi_mesh::Vector3>& centroids,
+              const std::array<double, 3>& bbox_min,
+              const std::array<double, 3>& bbox_max);
+};
+
+} // namespace chi
+
+#endif // CHITECH_SFCGRAPHPARTITIONER_H
@@ -0,0 +1,370 @@
+#include "SweepGraphPartitioner.h"
+
+#include "SFCGraphPartitioner.h"
+#include "chi_directed_graph.h"
+
+#include "ChiObjectFactory.h"
+
+#include "mesh/chi_mesh.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+namespace chi
+{
+
+RegisterChiObject(chi, SweepGraphPartitioner);
+
+InputParameters SweepGraphPartitioner::GetInputParameters()
+{
+  InputParameters params = GraphPartitioner::GetInputParameters();
+
+  // clang-format off
+  params.SetGeneralDescription("Sweep-aware partitioning. "
+"Chooses, amongst tensor product (KBA-like) decompositions and a Hilbert "
+"curve decomposition, the one with the smallest predicted sweep time and "
+"refines its cut planes. The predicted time accounts for the pipeline depth "
+"of the sweeps and the work imbalance, with the work of a cell being its "
+"number of vertices when the mesh generator supplies it.");
+  // clang-format on
+  params.SetDocGroup("Graphs");
+
+  params.AddOptionalParameter(
+    "max_refinement_iterations",
+    10,
+    "Maximum number of passes over the cut planes of a tensor product "
+    "decomposition, with the cut displacements halving every pass.");
+
+  using namespace chi_data_types;
+  params.ConstrainParameterRange("max_refinement_iterations",
+                                 AllowableRangeLowLimit::New(0));
+
+  return params;
+}
+
+SweepGraphPartitioner::SweepGraphPartitioner(const InputParameters& params)
+  : GraphPartitioner(params),
+    max_refinement_iterations_(
+      params.GetParamValue<int>("max_refinement_iterations"))
+{
+}
+
+// ##################################################################
+/**Returns the predicted sweep performance of the given partition of a
+ * graph with the given row weights.
+ *
+ * Two parts sharing an edge depend on each other along the direction of
+ * the sum of the centroid differences of their shared edges. For each
+ * octant direction (the sign combinations of the active dimensions) this
+ * yields a task dependency graph of the parts, with cycles removed in the
+ * same way the AAH sweep ordering does. A part's stage is one more than
+ * the largest stage of its upstream parts and the sweep time of the
+ * direction is the sum, over the stages, of the largest work of a part in
+ * the stage.*/
+SweepGraphPartitioner::SweepPrediction SweepGraphPartitioner::PredictSweep(
+  const std::vector<std::vector<uint64_t>>& graph,
+  const std::vector<chi_mesh::Vector3>& centroids,
+  const std::vector<double>& weights,
+  const std::vector<int64_t>& pids,
+  int number_of_parts)
+{
+  const size_t num_rows = graph.size();
+  const auto num_parts = static_cast<size_t>(number_of_parts);
+
+  SweepPrediction prediction;
+
+  //============================================= Work per part
+  std::vector<double> part_work(num_parts, 0.0);
+  for (size_t i = 0; i < num_rows; ++i)
+    part_work[pids[i]] += weights[i];
+  const double total_work =
+    std::accumulate(part_work.begin(), part_work.end(), 0.0);
+
+  for (double work : part_work)
+    if (work <= 0.0) ++prediction.num_empty_parts;
+
+  //============================================= Interfaces between parts
+  // Oriented from the lower to the higher part id
+  std::map<std::pair<int64_t, int64_t>, chi_mesh::Vector3> interfaces;
+  std::array<bool, 3> active_dims = {false, false, false};
+  for (size_t i = 0; i < num_rows; ++i)
+    for (uint64_t j : graph[i])
+    {
+      if (pids[i] >= pids[j]) continue;
+      const auto dr = centroids[j] - centroids[i];
+      interfaces[{pids[i], pids[j]}] += dr;
+      for (int d = 0; d < 3; ++d)
+        if (dr[d] != 0.0) active_dims[d] = true;
+    }
+
+  std::vector<int> dims;
+  for (int d = 0; d < 3; ++d)
+    if (active_dims[d]) dims.push_back(d);
+
+  //============================================= Stages per direction
+  const size_t num_dirs = size_t{1} << dims.size();
+  for (size_t dir = 0; dir < num_dirs; ++dir)
+  {
+    chi_mesh::Vector3 omega(0.0, 0.0, 0.0);
+    for (size_t k = 0; k < dims.size(); ++k)
+      omega(dims[k]) = (dir & (size_t{1} << k)) ? -1.0 : 1.0;
+
+    chi::DirectedGraph TDG;
+    for (size_t p = 0; p < num_parts; ++p)
+      TDG.AddVertex();
+
+    for (const auto& [parts, dr] : interfaces)
+    {
+      const double mu = dr.Dot(omega);
+      if (mu > 0.0) TDG.AddEdge(parts.first, parts.second);
+      else if (mu < 0.0)
+        TDG.AddEdge(parts.second, parts.first);
+    }
+
+    auto order = TDG.GenerateTopologicalSort();
+    if (order.empty())
+    {
+      TDG.RemoveCyclicDependencies();
+      order = TDG.GenerateTopologicalSort();
+    }
+
+    std::vector<size_t> stage(num_parts, 0);
+    size_t num_stages = 0;
+    for (size_t p : order)
+    {
+      for (size_t u : TDG.vertices[p].us_edge)
+        stage[p] = std::max(stage[p], stage[u] + 1);
+      num_stages = std::max(num_stages, stage[p] + 1);
+    }
+
+    std::vector<double> stage_work(num_stages, 0.0);
+    for (size_t p : order)
+      stage_work[stage[p]] = std::max(stage_work[stage[p]], part_work[p]);
+
+    prediction.time +=
+      std::accumulate(stage_work.begin(), stage_work.end(), 0.0);
+    prediction.num_stages = std::max(prediction.num_stages, num_stages);
+  }
+  prediction.time /= static_cast<double>(num_dirs);
+
+  if (prediction.time > 0.0)
+    prediction.efficiency =
+      total_work / (static_cast<double>(num_parts) * prediction.time);
+
+  return prediction;
+}
+
+// ##################################################################
+/**Returns the partition ids of the rows given each row's cumulative work
+ * fraction along each dimension. Part ids are ordered with z fastest.*/
+std::vector<int64_t> SweepGraphPartitioner::TensorPartition(
+  const std::array<std::vector<double>, 3>& row_fractions,
+  const TensorCuts& cuts)
+{
+  const size_t num_rows = row_fractions[0].size();
+
+  std::vector<int64_t> pids(num_rows, 0);
+  for (size_t i = 0; i < num_rows; ++i)
+  {
+    int64_t pid = 0;
+    for (int d = 0; d < 3; ++d)
+    {
+      const auto& dim_cuts = cuts[d];
+      const auto index =
+        std::upper_bound(
+          dim_cuts.begin(), dim_cuts.end(), row_fractions[d][i]) -
+        dim_cuts.begin();
+      pid = pid * static_cast<int64_t>(dim_cuts.size() + 1) + index;
+    }
+    pids[i] = pid;
+  }
+
+  return pids;
+}
+
+// ##################################################################
+/**Given a graph. Returns the partition ids of each row in the graph.
+ *
+ * The candidates are all tensor product decompositions, with px py pz
+ * equal to the number of parts and the cuts of each dimension at equal
+ * work fractions, and a Hilbert curve decomposition with equal work per
+ * part. The candidate with the smallest predicted sweep time (see
+ * PredictSweep) is chosen, candidates without empty parts being preferred.
+ * A tensor product decomposition is then refined by moving one cut at a
+ * time, keeping moves that reduce the predicted time.*/
+std::vector<int64_t> SweepGraphPartitioner::Partition(
+  const std::vector<std::vector<uint64_t>>& graph,
+  const std::vector<chi_mesh::Vector3>& centroids,
+  int number_of_parts)
+{
+  Chi::log.Log0Verbose1() << "Partitioning with SweepGraphPartitioner";
+
+  ChiInvalidArgumentIf(centroids.size() != graph.size(),
+                       "Graph number of entries not equal to centroids' "
+                       "number of entries.");
+
+  const size_t num_rows = graph.size();
+  if (number_of_parts <= 1 or num_rows == 0)
+    return std::vector<int64_t>(num_rows, 0);
+
+  const std::vector<double> weights = row_weights_.size() == num_rows
+                                        ? row_weights_
+                                        : std::vector<double>(num_rows, 1.0);
+  const double total_work =
+    std::accumulate(weights.begin(), weights.end(), 0.0);
+
+  //============================================= Work fractions per dimension
+  // The fraction of a row is the work of the rows before it, along the
+  // dimension, plus half of its own work.
+  std::array<double, 3> bbox_min = {0.0, 0.0, 0.0};
+  std::array<double, 3> bbox_max = {0.0, 0.0, 0.0};
+  std::array<std::vector<double>, 3> row_fractions;
+  std::array<bool, 3> active_dims = {false, false, false};
+  for (int d = 0; d < 3; ++d)
+  {
+    std::vector<size_t> order(num_rows);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&centroids, d](size_t a, size_t b)
+                     { return centroids[a][d] < centroids[b][d]; });
+
+    bbox_min[d] = centroids[order.front()][d];
+    bbox_max[d] = centroids[order.back()][d];
+    active_dims[d] = bbox_max[d] > bbox_min[d];
+
+    row_fractions[d].assign(num_rows, 0.0);
+    double cumulative_work = 0.0;
+    for (size_t i : order)
+    {
+      row_fractions[d][i] = (cumulative_work + 0.5 * weights[i]) / total_work;
+      cumulative_work += weights[i];
+    }
+  }
+
+  //============================================= Candidate bookkeeping
+  std::vector<int64_t> best_pids;
+  SweepPrediction best;
+  TensorCuts best_cuts;
+  bool best_is_tensor = false;
+  std::string best_name;
+
+  auto IsBetter = [](const SweepPrediction& a, const SweepPrediction& b)
+  {
+    if (a.num_empty_parts != b.num_empty_parts)
+      return a.num_empty_parts < b.num_empty_parts;
+    return a.time < b.time;
+  };
+
+  auto Consider = [&](std::vector<int64_t> pids,
+                      const std::string& name,
+                      const TensorCuts* cuts)
+  {
+    const auto prediction =
+      PredictSweep(graph, centroids, weights, pids, number_of_parts);
+    if (not best_pids.empty() and not IsBetter(prediction, best)) return;
+
+    best_pids = std::move(pids);
+    best = prediction;
+    best_is_tensor = cuts != nullptr;
+    if (cuts) best_cuts = *cuts;
+    best_name = name;
+  };
+
+  //============================================= Tensor product candidates
+  const int P = number_of_parts;
+  for (int px = 1; px <= P; ++px)
+  {
+    if (P % px != 0) continue;
+    for (int py = 1; py <= P / px; ++py)
+    {
+      if ((P / px) % py != 0) continue;
+      const std::array<int, 3> num_parts_1d = {px, py, P / (px * py)};
+
+      bool feasible = true;
+      TensorCuts cuts;
+      for (int d = 0; d < 3; ++d)
+      {
+        if (num_parts_1d[d] > 1 and not active_dims[d]) feasible = false;
+        for (int k = 1; k < num_parts_1d[d]; ++k)
+          cuts[d].push_back(static_cast<double>(k) / num_parts_1d[d]);
+      }
+      if (not feasible) continue;
+
+      std::stringstream name;
+      name << "tensor " << num_parts_1d[0] << "x" << num_parts_1d[1] << "x"
+           << num_parts_1d[2];
+      Consider(TensorPartition(row_fractions, cuts), name.str(), &cuts);
+    }
+  }
+
+  //============================================= Hilbert curve candidate
+  {
+    const auto keys =
+      SFCGraphPartitioner::ComputeKeys(centroids, bbox_min, bbox_max);
+
+    std::vector<size_t> order(num_rows);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+    std::vector<int64_t> pids(num_rows, 0);
+    double cumulative_work = 0.0;
+    for (size_t i : order)
+    {
+      const double fraction =
+        (cumulative_work + 0.5 * weights[i]) / total_work;
+      pids[i] = std::min<int64_t>(P - 1, static_cast<int64_t>(fraction * P));
+      cumulative_work += weights[i];
+    }
+    Consider(std::move(pids), "Hilbert curve", nullptr);
+  }
+
+  Chi::log.Log() << "SweepGraphPartitioner: initial " << best_name
+                 << " partition, predicted sweep efficiency "
+                 << best.efficiency << " with " << best.num_stages
+                 << " stages.";
+
+  //============================================= Refine tensor cuts
+  if (best_is_tensor)
+  {
+    size_t max_num_parts_1d = 1;
+    for (const auto& dim_cuts : best_cuts)
+      max_num_parts_1d = std::max(max_num_parts_1d, dim_cuts.size() + 1);
+
+    double delta = 0.25 / static_cast<double>(max_num_parts_1d);
+    for (int iter = 0; iter < max_refinement_iterations_; ++iter)
+    {
+      for (int d = 0; d < 3; ++d)
+        for (size_t k = 0; k < best_cuts[d].size(); ++k)
+          for (double sign : {-1.0, 1.0})
+          {
+            const auto& dim_cuts = best_cuts[d];
+            const double lo = k > 0 ? dim_cuts[k - 1] : 0.0;
+            const double hi = k + 1 < dim_cuts.size() ? dim_cuts[k + 1] : 1.0;
+            const double cut = dim_cuts[k] + sign * delta;
+            if (cut <= lo or cut >= hi) continue;
+
+            TensorCuts cuts = best_cuts;
+            cuts[d][k] = cut;
+            Consider(TensorPartition(row_fractions, cuts), best_name, &cuts);
+          }
+      delta *= 0.5;
+    }
+
+    Chi::log.Log() << "SweepGraphPartitioner: refined " << best_name
+                   << " partition, predicted sweep efficiency "
+                   << best.efficiency << " with " << best.num_stages
+                   << " stages.";
+  }
+
+  Chi::log.Log0Verbose1() << "Done partitioning with SweepGraphPartitioner";
+  return best_pids;
+}
+
+} // namespace chi
@@ -0,0 +1,63 @@
+#ifndef CHITECH_SWEEPGRAPHPARTITIONER_H
+#define CHITECH_SWEEPGRAPHPARTITIONER_H
+
+#include "GraphPartitioner.h"
+
+#include <array>
+
+namespace chi
+{
+
+/**Geometric partitioner minimizing the predicted time of transport sweeps
+ * instead of the edge cut. Candidate decompositions are scored with a
+ * model of the sweep pipeline: for each octant direction the parts are
+ * ordered into stages by their upwind dependencies and the predicted sweep
+ * time is the sum, over the stages, of the largest part work in the stage.
+ * The cheapest candidate is refined by moving its cut planes.*/
+class SweepGraphPartitioner : public GraphPartitioner
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit SweepGraphPartitioner(const InputParameters& params);
+
+  std::vector<int64_t>
+  Partition(const std::vector<std::vector<uint64_t>>& graph,
+            const std::vector<chi_mesh::Vector3>& centroids,
+            int number_of_parts) override;
+
+  /**Predicted sweep performance of a partition.*/
+  struct SweepPrediction
+  {
+    double time = 0.0;       ///< Mean over the directions, in work units
+    double efficiency = 0.0; ///< Total work over (parts x time)
+    size_t num_stages = 0;   ///< Largest number of stages of a direction
+    size_t num_empty_parts = 0;
+  };
+
+  /**Returns the predicted sweep performance of the given partition of a
+   * graph with the given row weights.*/
+  static SweepPrediction
+  PredictSweep(const std::vector<std::vector<uint64_t>>& graph,
+               const std::vector<chi_mesh::Vector3>& centroids,
+               const std::vector<double>& weights,
+               const std::vector<int64_t>& pids,
+               int number_of_parts);
+
+protected:
+  const int max_refinement_iterations_;
+
+  /**Cut positions, as cumulative work fractions, of a tensor product
+   * decomposition. Each dimension has its number of parts minus one
+   * cuts.*/
+  typedef std::array<std::vector<double>, 3> TensorCuts;
+
+  /**Returns the partition ids of the rows given each row's cumulative work
+   * fraction along each dimension.*/
+  static std::vector<int64_t>
+  TensorPartition(const std::array<std::vector<double>, 3>& row_fractions,
+                  const TensorCuts& cuts);
+};
+
+} // namespace chi
+
+#endif // CHITECH_SWEEPGRAPHPARTITIONER_H
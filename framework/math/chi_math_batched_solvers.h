@@ -0,0 +1,112 @@
+#ifndef CHI_MATH_BATCHED_SOLVERS_H
+#define CHI_MATH_BATCHED_SOLVERS_H
+
+#include "chi_math.h"
+
+namespace chi_math
+{
+
+// ###################################################################
+/**Solves a batch of small dense systems of the form
+ * \f$ (A + \sigma_g M) x_g = b_g \f$, one for each lane g, that share the
+ * matrices A and M and differ only in the scalar \f$ \sigma_g \f$. This is
+ * the structure of the per-group cell systems of a transport sweep.
+ *
+ * The systems are stored lane-major so that the innermost loops run over
+ * contiguous lanes and vectorize:
+ *  - system entry (i,j) of lane g at `Awork[(i*n + j)*num_lanes + g]`,
+ *  - right-hand side entry i of lane g at `b[i*num_lanes + g]`.
+ *
+ * Gaussian elimination is done without pivoting, i.e., with the same
+ * operation sequence as GaussElimination applied lane by lane. On return
+ * `b` holds the solutions.
+ *
+ * \param n_dynamic  Number of rows, only used when N is 0.
+ * \param A          Shared matrix (n x n).
+ * \param M          Shared matrix (n x n) scaled per lane.
+ * \param sigma      Lane scale factors, num_lanes entries.
+ * \param num_lanes  Number of systems.
+ * \param Awork      Work space of at least n*n*num_lanes entries.
+ * \param b          Lane-major right-hand sides (n*num_lanes entries).
+ * \param lane_work  Work space of at least 2*num_lanes entries.
+ *
+ * \tparam N Compile-time number of rows (e.g. 4 for quadrilaterals and
+ *           tetrahedra, 8 for hexahedra) or 0 for a runtime size.
+ * \tparam MatrixA,MatrixM Any types with `[i][j]` element access, e.g.
+ *           MatDbl or a view of packed row-major storage.*/
+template <int N, typename MatrixA, typename MatrixM>
+void BatchedGaussElimination(int n_dynamic,
+                             const MatrixA& A,
+                             const MatrixM& M,
+                             const double* sigma,
+                             size_t num_lanes,
+                             double* Awork,
+                             double* b,
+                             double* lane_work)
+{
+  const int n = (N > 0) ? N : n_dynamic;
+  const size_t L = num_lanes;
+
+  //============================================= Assemble systems
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+    {
+      const double Aij = A[i][j];
+      const double Mij = M[i][j];
+      double* a_ij = &Awork[(i * n + j) * L];
+      for (size_t g = 0; g < L; ++g)
+        a_ij[g] = Aij + Mij * sigma[g];
+    }
+
+  double* factor = lane_work;
+  double* val = lane_work + L;
+
+  //============================================= Forward elimination
+  for (int i = 0; i < n - 1; ++i)
+  {
+    const double* a_ii = &Awork[(i * n + i) * L];
+    const double* b_i = &b[i * L];
+    for (size_t g = 0; g < L; ++g)
+      factor[g] = 1.0 / a_ii[g];
+
+    for (int j = i + 1; j < n; ++j)
+    {
+      const double* a_ji = &Awork[(j * n + i) * L];
+      double* b_j = &b[j * L];
+      for (size_t g = 0; g < L; ++g)
+      {
+        val[g] = a_ji[g] * factor[g];
+        b_j[g] -= val[g] * b_i[g];
+      }
+
+      for (int k = i + 1; k < n; ++k)
+      {
+        const double* a_ik = &Awork[(i * n + k) * L];
+        double* a_jk = &Awork[(j * n + k) * L];
+        for (size_t g = 0; g < L; ++g)
+          a_jk[g] -= val[g] * a_ik[g];
+      }
+    }
+  }
+
+  //============================================= Back substitution
+  for (int i = n - 1; i >= 0; --i)
+  {
+    double* b_i = &b[i * L];
+    for (int j = i + 1; j < n; ++j)
+    {
+      const double* a_ij = &Awork[(i * n + j) * L];
+      const double* b_j = &b[j * L];
+      for (size_t g = 0; g < L; ++g)
+        b_i[g] -= a_ij[g] * b_j[g];
+    }
+
+    const double* a_ii = &Awork[(i * n + i) * L];
+    for (size_t g = 0; g < L; ++g)
+      b_i[g] /= a_ii[g];
+  }
+}
+
+} // namespace chi_math
+
+#endif // CHI_MATH_BATCHED_SOLVERS_H
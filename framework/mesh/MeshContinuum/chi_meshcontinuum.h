@@ -8,6 +8,8 @@
 #include "chi_meshcontinuum_localcellhandler.h"
 #include "chi_meshcontinuum_globalcellhandler.h"
 #include "chi_meshcontinuum_vertexhandler.h"
+#include "chi_meshcontinuum_packedtopology.h"
+#include "chi_meshcontinuum_faceassociations.h"
 
 #include "chi_mpi.h"
 
@@ -41,11 +43,15 @@ private:
   std::vector<std::unique_ptr<chi_mesh::Cell>>
     ghost_cells_; ///< Locally stored ghosts
 
-  std::map<uint64_t, uint64_t> global_cell_id_to_local_id_map_;
-  std::map<uint64_t, uint64_t> global_cell_id_to_nonlocal_id_map_;
+  chi_data_types::FlatIndexMap global_cell_id_to_index_map_;
 
   uint64_t global_vertex_count_ = 0;
 
+  std::unique_ptr<PackedCellTopology> packed_topology_;
+  /**Built on first request, once the grid is complete. Discarded when
+   * cells are added, reordered, cut or cleared.*/
+  mutable std::unique_ptr<CellFaceAssociations> face_associations_;
+
 public:
   VertexHandler vertices;
   LocalCellHandler local_cells;
@@ -68,8 +74,8 @@ public:
     : local_cells(local_cells_),
       cells(local_cells_,
             ghost_cells_,
-            global_cell_id_to_local_id_map_,
-            global_cell_id_to_nonlocal_id_map_)
+            global_cell_id_to_index_map_,
+            face_associations_)
   {
   }
 
@@ -102,11 +108,16 @@ public:
   {
     local_cells_.clear();
     ghost_cells_.clear();
-    global_cell_id_to_local_id_map_.clear();
-    global_cell_id_to_nonlocal_id_map_.clear();
+    global_cell_id_to_index_map_.Clear();
     vertices.Clear();
+    packed_topology_.reset();
+    face_associations_.reset();
   }
 
+  const PackedCellTopology& BuildPackedTopology();
+  bool HasPackedTopology() const { return packed_topology_ != nullptr; }
+  const PackedCellTopology& PackedTopology() const;
+
   void ExportCellsToObj(const char* fileName,
                         bool per_material = false,
                         int options = 0) const;
@@ -114,6 +125,9 @@ public:
   void ExportCellsToExodus(const std::string& file_base_name,
                            bool suppress_node_sets = false,
                            bool suppress_side_sets = false) const;
+  void ExportCellsToCheckpoint(const std::string& file_base_name) const;
+  static std::shared_ptr<MeshContinuum>
+  ReadCheckpoint(const std::string& file_base_name);
 
   std::shared_ptr<GridFaceHistogram>
   MakeGridFaceHistogram(double master_tolerance = 100.0,
@@ -133,6 +147,15 @@ public:
   static size_t MapCellFace(const chi_mesh::Cell& cur_cell,
                             const chi_mesh::Cell& adj_cell,
                             unsigned int f);
+  const CellFaceAssociations& FaceAssociations() const;
+  /**Discards the cached face associations. Must be called by routines
+   * modifying the faces or vertices of existing cells.*/
+  void InvalidateFaceAssociations() { face_associations_.reset(); }
+
+  std::vector<uint64_t> MakeHilbertLocalCellOrdering() const;
+  std::vector<uint64_t> MakeRCMLocalCellOrdering() const;
+  void ReorderLocalCells(const std::vector<uint64_t>& ordering);
+  void ReorderLocalCells(const std::string& ordering);
 
   /**Given a global-id of a cell, will return the local-id if the
   * cell is local, otherwise will throw out_of_range.*/
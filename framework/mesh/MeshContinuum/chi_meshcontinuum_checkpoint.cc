@@ -0,0 +1,212 @@
+#include "chi_meshcontinuum.h"
+
+#include "mesh/Cell/cell.h"
+#include "data_types/byte_array.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <fstream>
+
+namespace
+{
+
+/**Identifies a ChiTech mesh checkpoint ("CHIMESH\0").*/
+constexpr uint64_t CHECKPOINT_MAGIC = 0x004853454d494843ULL;
+constexpr uint64_t CHECKPOINT_VERSION = 1;
+
+/**Returns the name of the checkpoint file of a location.*/
+std::string CheckpointFileName(const std::string& file_base_name,
+                               int location_id)
+{
+  return file_base_name + "_" + std::to_string(location_id) + ".cmesh";
+}
+
+void WriteString(chi_data_types::ByteArray& raw, const std::string& str)
+{
+  raw.Write<size_t>(str.size());
+  for (const char c : str)
+    raw.Write<char>(c);
+}
+
+std::string ReadString(const chi_data_types::ByteArray& raw, size_t& address)
+{
+  const auto length = raw.Read<size_t>(address, &address);
+  std::string str(length, ' ');
+  for (size_t i = 0; i < length; ++i)
+    str[i] = raw.Read<char>(address, &address);
+  return str;
+}
+
+} // namespace
+
+// ###################################################################
+/**Writes the partitioned mesh to a native binary checkpoint, one file per
+ * location named `<file_base_name>_<location_id>.cmesh`. Each file holds,
+ * in order,
+ * - a header with the format version, the number of locations, the
+ *   location id, the global vertex count and the mesh attributes,
+ * - the boundary id map,
+ * - the locally stored vertices,
+ * - the local cells followed by the ghost cells, each serialized with
+ *   chi_mesh::Cell::Serialize.
+ *
+ * The checkpoint can only be read back with the same number of locations,
+ * for which it skips reading, connecting and partitioning the original
+ * mesh. See MeshContinuum::ReadCheckpoint.*/
+void chi_mesh::MeshContinuum::ExportCellsToCheckpoint(
+  const std::string& file_base_name) const
+{
+  Chi::log.Log() << "Exporting mesh to checkpoint files with base "
+                 << file_base_name;
+
+  chi_data_types::ByteArray raw;
+
+  //============================================= Header
+  raw.Write<uint64_t>(CHECKPOINT_MAGIC);
+  raw.Write<uint64_t>(CHECKPOINT_VERSION);
+  raw.Write<int>(Chi::mpi.process_count);
+  raw.Write<int>(Chi::mpi.location_id);
+  raw.Write<uint64_t>(global_vertex_count_);
+  raw.Write<int>(static_cast<int>(attributes));
+  raw.Write<size_t>(ortho_attributes.Nx);
+  raw.Write<size_t>(ortho_attributes.Ny);
+  raw.Write<size_t>(ortho_attributes.Nz);
+
+  //============================================= Boundary id map
+  raw.Write<size_t>(boundary_id_map_.size());
+  for (const auto& [boundary_id, boundary_name] : boundary_id_map_)
+  {
+    raw.Write<uint64_t>(boundary_id);
+    WriteString(raw, boundary_name);
+  }
+
+  //============================================= Vertices
+  raw.Write<size_t>(vertices.NumLocallyStored());
+  for (const auto& [vid, vertex] : vertices)
+  {
+    raw.Write<uint64_t>(vid);
+    raw.Write<chi_mesh::Vector3>(vertex);
+  }
+
+  //============================================= Cells
+  raw.Write<size_t>(local_cells_.size());
+  for (const auto& cell_ptr : local_cells_)
+    raw.Append(cell_ptr->Serialize());
+
+  raw.Write<size_t>(ghost_cells_.size());
+  for (const auto& cell_ptr : ghost_cells_)
+    raw.Append(cell_ptr->Serialize());
+
+  //============================================= Write the file
+  const auto file_name =
+    CheckpointFileName(file_base_name, Chi::mpi.location_id);
+  std::ofstream file(file_name, std::ios::out | std::ios::binary);
+  ChiLogicalErrorIf(not file.is_open(),
+                    "Failed to open \"" + file_name + "\" for writing.");
+
+  file.write(reinterpret_cast<const char*>(raw.Data().data()),
+             static_cast<std::streamsize>(raw.Size()));
+  file.close();
+  ChiLogicalErrorIf(not file.good(),
+                    "Failed to write \"" + file_name + "\".");
+
+  Chi::mpi.Barrier();
+  Chi::log.Log() << "Done exporting mesh to checkpoint.";
+}
+
+// ###################################################################
+/**Reads the mesh written with MeshContinuum::ExportCellsToCheckpoint. Each
+ * location reads its own file in one contiguous read. The number of
+ * locations must be the same as when the checkpoint was written.*/
+std::shared_ptr<chi_mesh::MeshContinuum>
+chi_mesh::MeshContinuum::ReadCheckpoint(const std::string& file_base_name)
+{
+  const auto file_name =
+    CheckpointFileName(file_base_name, Chi::mpi.location_id);
+
+  //============================================= Read the file
+  std::ifstream file(file_name, std::ios::in | std::ios::binary);
+  ChiInvalidArgumentIf(not file.is_open(),
+                       "Failed to open mesh checkpoint \"" + file_name +
+                         "\".");
+
+  file.seekg(0, std::ios::end);
+  const auto file_size = static_cast<size_t>(file.tellg());
+  file.seekg(0, std::ios::beg);
+
+  chi_data_types::ByteArray raw(file_size);
+  file.read(reinterpret_cast<char*>(raw.Data().data()),
+            static_cast<std::streamsize>(file_size));
+  file.close();
+
+  //============================================= Header
+  size_t address = 0;
+  ChiInvalidArgumentIf(
+    file_size < sizeof(uint64_t) or
+      raw.Read<uint64_t>(address, &address) != CHECKPOINT_MAGIC,
+    "\"" + file_name + "\" is not a mesh checkpoint.");
+
+  const auto version = raw.Read<uint64_t>(address, &address);
+  ChiInvalidArgumentIf(version != CHECKPOINT_VERSION,
+                       "\"" + file_name + "\" has checkpoint version " +
+                         std::to_string(version) + ", expected " +
+                         std::to_string(CHECKPOINT_VERSION) + ".");
+
+  const auto process_count = raw.Read<int>(address, &address);
+  const auto location_id = raw.Read<int>(address, &address);
+  ChiInvalidArgumentIf(process_count != Chi::mpi.process_count,
+                       "The mesh checkpoint was written with " +
+                         std::to_string(process_count) +
+                         " processes. It can only be read with the same "
+                         "number of processes.");
+  ChiInvalidArgumentIf(location_id != Chi::mpi.location_id,
+                       "\"" + file_name + "\" holds the partition of " +
+                         "location " + std::to_string(location_id) +
+                         ", expected location " +
+                         std::to_string(Chi::mpi.location_id) + ".");
+
+  auto grid_ptr = MeshContinuum::New();
+  auto& grid = *grid_ptr;
+
+  grid.global_vertex_count_ = raw.Read<uint64_t>(address, &address);
+  grid.attributes =
+    static_cast<MeshAttributes>(raw.Read<int>(address, &address));
+  grid.ortho_attributes.Nx = raw.Read<size_t>(address, &address);
+  grid.ortho_attributes.Ny = raw.Read<size_t>(address, &address);
+  grid.ortho_attributes.Nz = raw.Read<size_t>(address, &address);
+
+  //============================================= Boundary id map
+  const auto num_boundaries = raw.Read<size_t>(address, &address);
+  for (size_t b = 0; b < num_boundaries; ++b)
+  {
+    const auto boundary_id = raw.Read<uint64_t>(address, &address);
+    grid.boundary_id_map_[boundary_id] = ReadString(raw, address);
+  }
+
+  //============================================= Vertices
+  // Vertices were written in increasing id order, which appends them
+  const auto num_vertices = raw.Read<size_t>(address, &address);
+  grid.vertices.Reserve(num_vertices);
+  for (size_t v = 0; v < num_vertices; ++v)
+  {
+    const auto vid = raw.Read<uint64_t>(address, &address);
+    grid.vertices.Insert(vid, raw.Read<chi_mesh::Vector3>(address, &address));
+  }
+
+  //============================================= Cells
+  const auto num_local_cells = raw.Read<size_t>(address, &address);
+  grid.local_cells_.reserve(num_local_cells);
+  for (size_t c = 0; c < num_local_cells; ++c)
+    grid.cells.push_back(
+      std::make_unique<Cell>(Cell::DeSerialize(raw, address)));
+
+  const auto num_ghost_cells = raw.Read<size_t>(address, &address);
+  grid.ghost_cells_.reserve(num_ghost_cells);
+  for (size_t c = 0; c < num_ghost_cells; ++c)
+    grid.cells.push_back(
+      std::make_unique<Cell>(Cell::DeSerialize(raw, address)));
+
+  return grid_ptr;
+}
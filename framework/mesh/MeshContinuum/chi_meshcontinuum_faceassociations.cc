@@ -0,0 +1,114 @@
+#include "chi_meshcontinuum_faceassociations.h"
+
+#include "chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <algorithm>
+
+namespace
+{
+
+/**Maps the vertices of `face` onto the vertices of `adj_face`. Returns
+ * false if the two faces do not share the same vertices.*/
+bool MapFaceVertices(const chi_mesh::CellFace& face,
+                     const chi_mesh::CellFace& adj_face,
+                     std::vector<short>& mapping)
+{
+  if (face.vertex_ids_.size() != adj_face.vertex_ids_.size()) return false;
+
+  const size_t begin = mapping.size();
+  const auto& adj_vids = adj_face.vertex_ids_;
+  for (const uint64_t vid : face.vertex_ids_)
+  {
+    const auto it = std::find(adj_vids.begin(), adj_vids.end(), vid);
+    if (it == adj_vids.end())
+    {
+      mapping.resize(begin);
+      return false;
+    }
+    mapping.push_back(static_cast<short>(it - adj_vids.begin()));
+  }
+  return true;
+}
+
+} // namespace
+
+//###################################################################
+/**Computes the associations of all the faces of the local cells of the
+ * grid. Neighbor cells must be stored locally, either as local or as ghost
+ * cells.*/
+chi_mesh::CellFaceAssociations::CellFaceAssociations(
+  const MeshContinuum& grid)
+{
+  const size_t num_cells = grid.local_cells.size();
+
+  //============================================= Count
+  size_t num_faces = 0;
+  size_t num_face_nodes = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    num_faces += cell.faces_.size();
+    for (const auto& face : cell.faces_)
+      if (face.has_neighbor_) num_face_nodes += face.vertex_ids_.size();
+  }
+
+  cell_face_offsets_.reserve(num_cells + 1);
+  associated_faces_.reserve(num_faces);
+  neighbor_is_local_.reserve(num_faces);
+  neighbor_local_ids_.reserve(num_faces);
+  face_node_offsets_.reserve(num_faces + 1);
+  face_node_mappings_.reserve(num_face_nodes);
+  cell_node_mappings_.reserve(num_face_nodes);
+
+  //============================================= Associate faces
+  cell_face_offsets_.push_back(0);
+  face_node_offsets_.push_back(0);
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const auto& face : cell.faces_)
+    {
+      int associated_face = -1;
+      bool is_local = false;
+      uint64_t neighbor_local_id = 0;
+
+      if (face.has_neighbor_)
+      {
+        const auto& adj_cell = grid.cells[face.neighbor_id_];
+        is_local = grid.IsCellLocal(face.neighbor_id_);
+        if (is_local) neighbor_local_id = adj_cell.local_id_;
+
+        //=================================== Face and face-node mapping
+        for (size_t af = 0; af < adj_cell.faces_.size(); ++af)
+          if (MapFaceVertices(face, adj_cell.faces_[af], face_node_mappings_))
+          {
+            associated_face = static_cast<int>(af);
+            break;
+          }
+
+        ChiLogicalErrorIf(associated_face < 0,
+                          "Could not find the face of cell " +
+                            std::to_string(face.neighbor_id_) +
+                            " associated with the face of cell " +
+                            std::to_string(cell.global_id_) +
+                            " with centroid " + face.centroid_.PrintS());
+
+        //=================================== Cell-node mapping
+        const auto& adj_vids = adj_cell.vertex_ids_;
+        for (const uint64_t vid : face.vertex_ids_)
+        {
+          const auto it = std::find(adj_vids.begin(), adj_vids.end(), vid);
+          cell_node_mappings_.push_back(
+            static_cast<short>(it - adj_vids.begin()));
+        }
+      }
+
+      associated_faces_.push_back(associated_face);
+      neighbor_is_local_.push_back(is_local);
+      neighbor_local_ids_.push_back(neighbor_local_id);
+      face_node_offsets_.push_back(face_node_mappings_.size());
+    } // for face
+    cell_face_offsets_.push_back(associated_faces_.size());
+  } // for cell
+}
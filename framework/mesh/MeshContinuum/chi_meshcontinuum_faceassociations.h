@@ -0,0 +1,94 @@
+#ifndef CHI_MESHCONTINUUM_FACEASSOCIATIONS_H
+#define CHI_MESHCONTINUUM_FACEASSOCIATIONS_H
+
+#include "chi_meshcontinuum_packedtopology.h"
+
+#include <vector>
+
+namespace chi_mesh
+{
+
+//##################################################
+/**Precomputed associations between the faces of the local cells and the
+ * faces of their neighbor cells, stored in flat per-face arrays. For every
+ * face of every local cell this holds whether the neighbor is local, its
+ * local id if it is, the index of the associated face on the neighbor and
+ * the mapping of the face vertices onto the vertices of the associated face
+ * and of the neighbor cell.
+ *
+ * This replaces the vertex list searches of
+ * CellFace::GetNeighborAssociatedFace, MeshContinuum::MapCellFace,
+ * MeshContinuum::FindAssociatedVertices and
+ * MeshContinuum::FindAssociatedCellVertices. Obtained with
+ * MeshContinuum::FaceAssociations.*/
+class CellFaceAssociations
+{
+private:
+  /**Per local cell, the index of its first face.*/
+  std::vector<size_t> cell_face_offsets_;
+
+  // Per face
+  std::vector<int> associated_faces_;
+  std::vector<bool> neighbor_is_local_;
+  std::vector<uint64_t> neighbor_local_ids_;
+  std::vector<size_t> face_node_offsets_;
+
+  // Per face vertex
+  std::vector<short> face_node_mappings_;
+  std::vector<short> cell_node_mappings_;
+
+  size_t FaceIndex(uint64_t cell_local_id, size_t f) const
+  {
+    return cell_face_offsets_[cell_local_id] + f;
+  }
+
+public:
+  explicit CellFaceAssociations(const MeshContinuum& grid);
+
+  /**Returns the index of the face of the neighbor cell that is shared with
+   * face `f` of the given local cell, or -1 if the face is a boundary.*/
+  int AssociatedFace(uint64_t cell_local_id, size_t f) const
+  {
+    return associated_faces_[FaceIndex(cell_local_id, f)];
+  }
+
+  /**Returns true if the neighbor across face `f` of the given local cell is
+   * a local cell.*/
+  bool NeighborIsLocal(uint64_t cell_local_id, size_t f) const
+  {
+    return neighbor_is_local_[FaceIndex(cell_local_id, f)];
+  }
+
+  /**Returns the local id of the neighbor across face `f` of the given
+   * local cell. Only meaningful if the neighbor is local.*/
+  uint64_t NeighborLocalID(uint64_t cell_local_id, size_t f) const
+  {
+    return neighbor_local_ids_[FaceIndex(cell_local_id, f)];
+  }
+
+  /**Returns, for each vertex of face `f` of the given local cell, the
+   * index of the same vertex on the associated face. Empty for boundary
+   * faces.*/
+  ConstArrayView<short> FaceNodeMapping(uint64_t cell_local_id,
+                                        size_t f) const
+  {
+    const size_t face = FaceIndex(cell_local_id, f);
+    return {face_node_mappings_.data() + face_node_offsets_[face],
+            face_node_offsets_[face + 1] - face_node_offsets_[face]};
+  }
+
+  /**Returns, for each vertex of face `f` of the given local cell, the
+   * index of the same vertex on the neighbor cell. Empty for boundary
+   * faces.*/
+  ConstArrayView<short> CellNodeMapping(uint64_t cell_local_id,
+                                        size_t f) const
+  {
+    const size_t face = FaceIndex(cell_local_id, f);
+    return {cell_node_mappings_.data() + face_node_offsets_[face],
+            face_node_offsets_[face + 1] - face_node_offsets_[face]};
+  }
+};
+
+}//namespace chi_mesh
+
+#endif //CHI_MESHCONTINUUM_FACEASSOCIATIONS_H
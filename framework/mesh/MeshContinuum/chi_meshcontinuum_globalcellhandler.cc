@@ -5,10 +5,13 @@
 #include "chi_log.h"
 
 //###################################################################
-/**Adds a new cell to grid registry.*/
+/**Adds a new cell to grid registry. Invalidates the cached face
+ * associations of the grid.*/
 void chi_mesh::GlobalCellHandler::
   push_back(std::unique_ptr<chi_mesh::Cell> new_cell)
 {
+  face_associations_ref_.reset();
+
   if (new_cell->partition_id_ == static_cast<uint64_t>(Chi::mpi.location_id))
   {
     new_cell->local_id_ = local_cells_ref_.size();
@@ -17,8 +20,8 @@ void chi_mesh::GlobalCellHandler::
 
     const auto& cell = local_cells_ref_.back();
 
-    global_cell_id_to_native_id_map.insert(std::make_pair(
-      cell->global_id_, local_cells_ref_.size() - 1));
+    global_cell_id_to_index_map.Insert(
+      cell->global_id_, (local_cells_ref_.size() - 1) << 1);
   }
   else
   {
@@ -26,8 +29,8 @@ void chi_mesh::GlobalCellHandler::
 
     const auto& cell = ghost_cells_ref_.back();
 
-    global_cell_id_to_foreign_id_map.insert(std::make_pair(
-      cell->global_id_, ghost_cells_ref_.size() - 1));
+    global_cell_id_to_index_map.Insert(
+      cell->global_id_, ((ghost_cells_ref_.size() - 1) << 1) | 1);
   }
 
 }
@@ -37,23 +40,8 @@ void chi_mesh::GlobalCellHandler::
 chi_mesh::Cell& chi_mesh::GlobalCellHandler::
   operator[](uint64_t cell_global_index)
 {
-  auto native_location = global_cell_id_to_native_id_map.find(cell_global_index);
-
-  if (native_location != global_cell_id_to_native_id_map.end())
-    return *local_cells_ref_[native_location->second];
-  else
-  {
-    auto foreign_location = global_cell_id_to_foreign_id_map.find(cell_global_index);
-    if (foreign_location != global_cell_id_to_foreign_id_map.end())
-      return *ghost_cells_ref_[foreign_location->second];
-  }
-
-  std::stringstream ostr;
-  ostr << "chi_mesh::MeshContinuum::cells. Mapping error."
-       << "\n"
-       << cell_global_index;
-
-  throw std::invalid_argument(ostr.str());
+  const auto& const_this = *this;
+  return const_cast<chi_mesh::Cell&>(const_this[cell_global_index]);
 }
 
 //###################################################################
@@ -61,15 +49,13 @@ chi_mesh::Cell& chi_mesh::GlobalCellHandler::
 const chi_mesh::Cell& chi_mesh::GlobalCellHandler::
   operator[](uint64_t cell_global_index) const
 {
-  auto native_location = global_cell_id_to_native_id_map.find(cell_global_index);
+  const uint64_t* index = global_cell_id_to_index_map.Find(cell_global_index);
 
-  if (native_location != global_cell_id_to_native_id_map.end())
-    return *local_cells_ref_[native_location->second];
-  else
+  if (index != nullptr)
   {
-    auto foreign_location = global_cell_id_to_foreign_id_map.find(cell_global_index);
-    if (foreign_location != global_cell_id_to_foreign_id_map.end())
-      return *ghost_cells_ref_[foreign_location->second];
+    if (*index & 1) return *ghost_cells_ref_[*index >> 1];
+    else
+      return *local_cells_ref_[*index >> 1];
   }
 
   std::stringstream ostr;
@@ -121,11 +107,9 @@ std::vector<uint64_t> chi_mesh::GlobalCellHandler::
 uint64_t chi_mesh::GlobalCellHandler::
   GetGhostLocalID(uint64_t cell_global_index) const
 {
-  auto foreign_location =
-    global_cell_id_to_foreign_id_map.find(cell_global_index);
+  const uint64_t* index = global_cell_id_to_index_map.Find(cell_global_index);
 
-  if (foreign_location != global_cell_id_to_foreign_id_map.end())
-    return foreign_location->second;
+  if (index != nullptr and (*index & 1)) return *index >> 1;
 
   std::stringstream ostr;
   ostr << "Grid GetGhostLocalID failed to find cell " << cell_global_index;
@@ -2,13 +2,16 @@
 #define CHI_MESHCONTINUUM_GLOBALCELLHANDLER_H_
 
 #include "mesh/Cell/cell.h"
-
-#include <map>
+#include "data_types/flat_index_map.h"
 
 namespace chi_mesh
 {
+class CellFaceAssociations;
+
 //##################################################
-/**Handles all global index queries.*/
+/**Handles all global index queries. A single flat index maps a global id
+ * to the cell's storage index, shifted left by one bit, with the lowest bit
+ * set for ghost cells.*/
 class GlobalCellHandler
 {
   friend class MeshContinuum;
@@ -16,20 +19,21 @@ private:
   std::vector<std::unique_ptr<chi_mesh::Cell>>& local_cells_ref_;
   std::vector<std::unique_ptr<chi_mesh::Cell>>& ghost_cells_ref_;
 
-  std::map<uint64_t,uint64_t>& global_cell_id_to_native_id_map;
-  std::map<uint64_t,uint64_t>& global_cell_id_to_foreign_id_map;
+  chi_data_types::FlatIndexMap& global_cell_id_to_index_map;
 
+  /**Cached face associations of the grid, invalidated by new cells.*/
+  std::unique_ptr<CellFaceAssociations>& face_associations_ref_;
 
 private:
   explicit GlobalCellHandler(
     std::vector<std::unique_ptr<chi_mesh::Cell>>& in_native_cells,
     std::vector<std::unique_ptr<chi_mesh::Cell>>& in_foreign_cells,
-    std::map<uint64_t,uint64_t>& in_global_cell_id_to_native_id_map,
-    std::map<uint64_t,uint64_t>& in_global_cell_id_to_foreign_id_map) :
+    chi_data_types::FlatIndexMap& in_global_cell_id_to_index_map,
+    std::unique_ptr<CellFaceAssociations>& in_face_associations) :
     local_cells_ref_(in_native_cells),
     ghost_cells_ref_(in_foreign_cells),
-    global_cell_id_to_native_id_map(in_global_cell_id_to_native_id_map),
-    global_cell_id_to_foreign_id_map(in_global_cell_id_to_foreign_id_map)
+    global_cell_id_to_index_map(in_global_cell_id_to_index_map),
+    face_associations_ref_(in_face_associations)
   {}
 
 public:
@@ -38,7 +42,7 @@ public:
   const chi_mesh::Cell& operator[](uint64_t cell_global_index) const;
 
   size_t GetNumGhosts() const
-  {return global_cell_id_to_foreign_id_map.size();}
+  {return ghost_cells_ref_.size();}
 
   std::vector<uint64_t> GetGhostGlobalIDs() const;
 
@@ -0,0 +1,90 @@
+#include "chi_meshcontinuum_packedtopology.h"
+
+#include "chi_meshcontinuum.h"
+
+//###################################################################
+/**Packs the topology of the local cells of the grid.*/
+chi_mesh::PackedCellTopology::PackedCellTopology(const MeshContinuum& grid)
+{
+  const size_t num_cells = grid.local_cells.size();
+
+  //============================================= Count
+  size_t num_cell_vertex_ids = 0;
+  size_t num_faces = 0;
+  size_t num_face_vertex_ids = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    num_cell_vertex_ids += cell.vertex_ids_.size();
+    num_faces += cell.faces_.size();
+    for (const auto& face : cell.faces_)
+      num_face_vertex_ids += face.vertex_ids_.size();
+  }
+
+  //============================================= Allocate
+  cell_global_ids_.reserve(num_cells);
+  cell_types_.reserve(num_cells);
+  cell_sub_types_.reserve(num_cells);
+  cell_material_ids_.reserve(num_cells);
+  cell_centroids_.reserve(num_cells);
+  cell_vertex_offsets_.reserve(num_cells + 1);
+  cell_vertex_ids_.reserve(num_cell_vertex_ids);
+  cell_face_offsets_.reserve(num_cells + 1);
+
+  face_vertex_offsets_.reserve(num_faces + 1);
+  face_vertex_ids_.reserve(num_face_vertex_ids);
+  face_normals_.reserve(num_faces);
+  face_centroids_.reserve(num_faces);
+  face_has_neighbor_.reserve(num_faces);
+  face_neighbor_ids_.reserve(num_faces);
+
+  //============================================= Pack
+  cell_vertex_offsets_.push_back(0);
+  cell_face_offsets_.push_back(0);
+  face_vertex_offsets_.push_back(0);
+  for (const auto& cell : grid.local_cells)
+  {
+    cell_global_ids_.push_back(cell.global_id_);
+    cell_types_.push_back(cell.Type());
+    cell_sub_types_.push_back(cell.SubType());
+    cell_material_ids_.push_back(cell.material_id_);
+    cell_centroids_.push_back(cell.centroid_);
+
+    cell_vertex_ids_.insert(cell_vertex_ids_.end(),
+                            cell.vertex_ids_.begin(),
+                            cell.vertex_ids_.end());
+    cell_vertex_offsets_.push_back(cell_vertex_ids_.size());
+
+    for (const auto& face : cell.faces_)
+    {
+      face_vertex_ids_.insert(face_vertex_ids_.end(),
+                              face.vertex_ids_.begin(),
+                              face.vertex_ids_.end());
+      face_vertex_offsets_.push_back(face_vertex_ids_.size());
+
+      face_normals_.push_back(face.normal_);
+      face_centroids_.push_back(face.centroid_);
+      face_has_neighbor_.push_back(face.has_neighbor_);
+      face_neighbor_ids_.push_back(face.neighbor_id_);
+    }
+    cell_face_offsets_.push_back(face_normals_.size());
+  }
+}
+
+//###################################################################
+/**Returns the number of bytes allocated by the packed topology.*/
+size_t chi_mesh::PackedCellTopology::MemoryUsage() const
+{
+  auto Bytes = [](const auto& vec)
+  {
+    typedef typename std::decay_t<decltype(vec)>::value_type T;
+    return vec.capacity() * sizeof(T);
+  };
+
+  return Bytes(cell_global_ids_) + Bytes(cell_types_) +
+         Bytes(cell_sub_types_) + Bytes(cell_material_ids_) +
+         Bytes(cell_centroids_) + Bytes(cell_vertex_offsets_) +
+         Bytes(cell_vertex_ids_) + Bytes(cell_face_offsets_) +
+         Bytes(face_vertex_offsets_) + Bytes(face_vertex_ids_) +
+         Bytes(face_normals_) + Bytes(face_centroids_) +
+         face_has_neighbor_.capacity() / 8 + Bytes(face_neighbor_ids_);
+}
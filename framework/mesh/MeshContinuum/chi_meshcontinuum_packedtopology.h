@@ -0,0 +1,128 @@
+#ifndef CHI_MESHCONTINUUM_PACKEDTOPOLOGY_H
+#define CHI_MESHCONTINUUM_PACKEDTOPOLOGY_H
+
+#include "mesh/Cell/cell.h"
+#include "mesh/chi_mesh_arrayview.h"
+
+#include <vector>
+
+namespace chi_mesh
+{
+
+//##################################################
+/**Compact structure-of-arrays copy of the topology of the local cells of
+ * a grid. The vertex ids of all cells and all faces are stored in two
+ * shared arrays, indexed through offset arrays (CSR style), and the face
+ * normals, face centroids and face neighbors in flat per-face arrays. The
+ * faces of a cell are contiguous.
+ *
+ * Cells and faces are accessed through the lightweight CellView and
+ * CellFaceView, which mirror the data members of chi_mesh::Cell and
+ * chi_mesh::CellFace, so that code can move over from the cell objects one
+ * loop at a time. Built with MeshContinuum::BuildPackedTopology.*/
+class PackedCellTopology
+{
+public:
+  /**View of a face of the packed topology.*/
+  class CellFaceView
+  {
+  private:
+    const PackedCellTopology& topology_;
+    const size_t face_;
+
+  public:
+    CellFaceView(const PackedCellTopology& topology, size_t face)
+      : topology_(topology), face_(face)
+    {
+    }
+
+    ConstArrayView<uint64_t> VertexIDs() const
+    {
+      const auto& offsets = topology_.face_vertex_offsets_;
+      return {topology_.face_vertex_ids_.data() + offsets[face_],
+              offsets[face_ + 1] - offsets[face_]};
+    }
+    const Normal& GetNormal() const { return topology_.face_normals_[face_]; }
+    const Vertex& GetCentroid() const
+    {
+      return topology_.face_centroids_[face_];
+    }
+    bool HasNeighbor() const { return topology_.face_has_neighbor_[face_]; }
+    /**The global id of the neighbor cell, or the boundary id.*/
+    uint64_t NeighborID() const { return topology_.face_neighbor_ids_[face_]; }
+  };
+
+  /**View of a cell of the packed topology.*/
+  class CellView
+  {
+  private:
+    const PackedCellTopology& topology_;
+    const size_t cell_;
+
+  public:
+    CellView(const PackedCellTopology& topology, size_t cell)
+      : topology_(topology), cell_(cell)
+    {
+    }
+
+    uint64_t LocalID() const { return cell_; }
+    uint64_t GlobalID() const { return topology_.cell_global_ids_[cell_]; }
+    CellType Type() const { return topology_.cell_types_[cell_]; }
+    CellType SubType() const { return topology_.cell_sub_types_[cell_]; }
+    int MaterialID() const { return topology_.cell_material_ids_[cell_]; }
+    const Vertex& GetCentroid() const
+    {
+      return topology_.cell_centroids_[cell_];
+    }
+
+    ConstArrayView<uint64_t> VertexIDs() const
+    {
+      const auto& offsets = topology_.cell_vertex_offsets_;
+      return {topology_.cell_vertex_ids_.data() + offsets[cell_],
+              offsets[cell_ + 1] - offsets[cell_]};
+    }
+
+    size_t NumFaces() const
+    {
+      return topology_.cell_face_offsets_[cell_ + 1] -
+             topology_.cell_face_offsets_[cell_];
+    }
+    CellFaceView GetFace(size_t f) const
+    {
+      return {topology_, topology_.cell_face_offsets_[cell_] + f};
+    }
+  };
+
+private:
+  // Per cell
+  std::vector<uint64_t> cell_global_ids_;
+  std::vector<CellType> cell_types_;
+  std::vector<CellType> cell_sub_types_;
+  std::vector<int> cell_material_ids_;
+  std::vector<Vertex> cell_centroids_;
+  std::vector<size_t> cell_vertex_offsets_;
+  std::vector<uint64_t> cell_vertex_ids_;
+  std::vector<size_t> cell_face_offsets_;
+
+  // Per face
+  std::vector<size_t> face_vertex_offsets_;
+  std::vector<uint64_t> face_vertex_ids_;
+  std::vector<Normal> face_normals_;
+  std::vector<Vertex> face_centroids_;
+  std::vector<bool> face_has_neighbor_;
+  std::vector<uint64_t> face_neighbor_ids_;
+
+public:
+  explicit PackedCellTopology(const MeshContinuum& grid);
+
+  size_t NumCells() const { return cell_global_ids_.size(); }
+  size_t NumFaces() const { return face_normals_.size(); }
+
+  CellView GetCell(size_t local_id) const { return {*this, local_id}; }
+
+  size_t MemoryUsage() const;
+};
+
+}//namespace chi_mesh
+
+#endif //CHI_MESHCONTINUUM_PACKEDTOPOLOGY_H
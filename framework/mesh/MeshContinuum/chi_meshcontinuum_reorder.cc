@@ -0,0 +1,184 @@
+#include "chi_meshcontinuum.h"
+
+#include "mesh/Cell/cell.h"
+#include "graphs/SFCGraphPartitioner.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+
+// ###################################################################
+/**Returns the local cells ordered along a Hilbert curve through their
+ * centroids, as a list of current local ids.*/
+std::vector<uint64_t>
+chi_mesh::MeshContinuum::MakeHilbertLocalCellOrdering() const
+{
+  const size_t num_cells = local_cells_.size();
+
+  std::vector<chi_mesh::Vector3> centroids;
+  centroids.reserve(num_cells);
+  for (const auto& cell : local_cells)
+    centroids.push_back(cell.centroid_);
+
+  //============================================= Bounding box
+  std::array<double, 3> bbox_min = {0.0, 0.0, 0.0};
+  std::array<double, 3> bbox_max = {0.0, 0.0, 0.0};
+  if (not centroids.empty())
+    for (int d = 0; d < 3; ++d)
+    {
+      bbox_min[d] = bbox_max[d] = centroids.front()[d];
+      for (const auto& centroid : centroids)
+      {
+        bbox_min[d] = std::min(bbox_min[d], centroid[d]);
+        bbox_max[d] = std::max(bbox_max[d], centroid[d]);
+      }
+    }
+
+  //============================================= Sort along the curve
+  const auto keys =
+    chi::SFCGraphPartitioner::ComputeKeys(centroids, bbox_min, bbox_max);
+
+  std::vector<uint64_t> ordering(num_cells);
+  std::iota(ordering.begin(), ordering.end(), 0);
+  std::stable_sort(ordering.begin(),
+                   ordering.end(),
+                   [&keys](uint64_t a, uint64_t b)
+                   { return keys[a] < keys[b]; });
+
+  return ordering;
+}
+
+// ###################################################################
+/**Returns the reverse Cuthill-McKee ordering of the graph of the local
+ * cells, connected through faces shared with local neighbors, as a list of
+ * current local ids. Each connected component is started from a cell of
+ * minimum degree.*/
+std::vector<uint64_t> chi_mesh::MeshContinuum::MakeRCMLocalCellOrdering() const
+{
+  const size_t num_cells = local_cells_.size();
+
+  //============================================= Local adjacency
+  std::vector<std::vector<uint64_t>> adjacency(num_cells);
+  for (const auto& cell : local_cells)
+    for (const auto& face : cell.faces_)
+      if (face.has_neighbor_ and IsCellLocal(face.neighbor_id_))
+        adjacency[cell.local_id_].push_back(
+          MapCellGlobalID2LocalID(face.neighbor_id_));
+
+  auto Degree = [&adjacency](uint64_t a) { return adjacency[a].size(); };
+  auto LessDegree = [&Degree](uint64_t a, uint64_t b)
+  { return Degree(a) < Degree(b); };
+
+  //============================================= Start cells
+  std::vector<uint64_t> candidates(num_cells);
+  std::iota(candidates.begin(), candidates.end(), 0);
+  std::stable_sort(candidates.begin(), candidates.end(), LessDegree);
+
+  //============================================= Breadth-first traversal
+  std::vector<uint64_t> ordering;
+  ordering.reserve(num_cells);
+  std::vector<bool> visited(num_cells, false);
+  std::queue<uint64_t> queue;
+  for (const uint64_t start : candidates)
+  {
+    if (visited[start]) continue;
+
+    visited[start] = true;
+    queue.push(start);
+    while (not queue.empty())
+    {
+      const uint64_t c = queue.front();
+      queue.pop();
+      ordering.push_back(c);
+
+      std::vector<uint64_t> neighbors;
+      for (const uint64_t n : adjacency[c])
+        if (not visited[n])
+        {
+          visited[n] = true;
+          neighbors.push_back(n);
+        }
+      std::stable_sort(neighbors.begin(), neighbors.end(), LessDegree);
+      for (const uint64_t n : neighbors)
+        queue.push(n);
+    }
+  }
+
+  std::reverse(ordering.begin(), ordering.end());
+  return ordering;
+}
+
+// ###################################################################
+/**Renumbers the local cells such that the cell with current local id
+ * `ordering[i]` gets local id `i`. Global ids, ghost cells and vertices
+ * are not affected. The packed topology and face associations are
+ * discarded.
+ *
+ * Must be called before any spatial discretization or solver is created
+ * on the grid, since these store data in local id order.*/
+void chi_mesh::MeshContinuum::ReorderLocalCells(
+  const std::vector<uint64_t>& ordering)
+{
+  const size_t num_cells = local_cells_.size();
+
+  //============================================= Check the permutation
+  ChiInvalidArgumentIf(ordering.size() != num_cells,
+                       "The ordering has " + std::to_string(ordering.size()) +
+                         " entries for " + std::to_string(num_cells) +
+                         " local cells.");
+  {
+    std::vector<bool> present(num_cells, false);
+    for (const uint64_t c : ordering)
+    {
+      ChiInvalidArgumentIf(c >= num_cells or present[c],
+                           "The ordering is not a permutation of the local "
+                           "cell ids.");
+      present[c] = true;
+    }
+  }
+
+  //============================================= Move the cells
+  std::vector<std::unique_ptr<chi_mesh::Cell>> reordered_cells;
+  reordered_cells.reserve(num_cells);
+  for (const uint64_t c : ordering)
+  {
+    reordered_cells.push_back(std::move(local_cells_[c]));
+    reordered_cells.back()->local_id_ = reordered_cells.size() - 1;
+  }
+  local_cells_ = std::move(reordered_cells);
+
+  //============================================= Rebuild the index map
+  global_cell_id_to_index_map_.Clear();
+  global_cell_id_to_index_map_.Reserve(num_cells + ghost_cells_.size());
+  for (size_t i = 0; i < num_cells; ++i)
+    global_cell_id_to_index_map_.Insert(local_cells_[i]->global_id_, i << 1);
+  for (size_t i = 0; i < ghost_cells_.size(); ++i)
+    global_cell_id_to_index_map_.Insert(ghost_cells_[i]->global_id_,
+                                        (i << 1) | 1);
+
+  packed_topology_.reset();
+  face_associations_.reset();
+}
+
+// ###################################################################
+/**Renumbers the local cells with the named ordering. Supported are
+ * "none", "hilbert" (along a Hilbert curve through the cell centroids) and
+ * "rcm" (reverse Cuthill-McKee on the local cell graph).*/
+void chi_mesh::MeshContinuum::ReorderLocalCells(const std::string& ordering)
+{
+  if (ordering == "none") return;
+
+  Chi::log.Log0Verbose1() << "Reordering local cells with ordering \""
+                          << ordering << "\"";
+
+  if (ordering == "hilbert") ReorderLocalCells(MakeHilbertLocalCellOrdering());
+  else if (ordering == "rcm")
+    ReorderLocalCells(MakeRCMLocalCellOrdering());
+  else
+    ChiInvalidArgument("Unknown local cell ordering \"" + ordering +
+                       "\". Supported are \"none\", \"hilbert\" and "
+                       "\"rcm\".");
+}
@@ -123,11 +123,9 @@ chi_mesh::MeshContinuum::MakeGridFaceHistogram(double master_tolerance,
  * the native index map.*/
 bool chi_mesh::MeshContinuum::IsCellLocal(uint64_t cell_global_index) const
 {
-  auto native_index = global_cell_id_to_local_id_map_.find(cell_global_index);
+  const uint64_t* index = global_cell_id_to_index_map_.Find(cell_global_index);
 
-  if (native_index != global_cell_id_to_local_id_map_.end()) return true;
-
-  return false;
+  return index != nullptr and (*index & 1) == 0;
 }
 
 // ###################################################################
@@ -285,13 +283,56 @@ size_t chi_mesh::MeshContinuum::MapCellFace(const chi_mesh::Cell& cur_cell,
   return fmap;
 }
 
+// ###################################################################
+/**Returns the precomputed face associations of the local cells. These are
+ * computed on the first call, which must happen after the local and ghost
+ * cells are final, and are cached until cells are added, reordered, cut or
+ * cleared.*/
+const chi_mesh::CellFaceAssociations&
+chi_mesh::MeshContinuum::FaceAssociations() const
+{
+  if (not face_associations_)
+    face_associations_ = std::make_unique<CellFaceAssociations>(*this);
+
+  return *face_associations_;
+}
+
 // ###################################################################
 /**Given a global-id of a cell, will return the local-id if the
  * cell is local, otherwise will throw logic_error.*/
 size_t
 chi_mesh::MeshContinuum::MapCellGlobalID2LocalID(uint64_t global_id) const
 {
-  return global_cell_id_to_local_id_map_.at(global_id);
+  const uint64_t* index = global_cell_id_to_index_map_.Find(global_id);
+
+  if (index == nullptr or (*index & 1))
+    throw std::out_of_range(
+      "chi_mesh::MeshContinuum::MapCellGlobalID2LocalID: Cell " +
+      std::to_string(global_id) + " is not local.");
+
+  return *index >> 1;
+}
+
+// ###################################################################
+/**Builds, or rebuilds, the packed structure-of-arrays copy of the local
+ * cell topology. Must be called again after the local cells changed.*/
+const chi_mesh::PackedCellTopology&
+chi_mesh::MeshContinuum::BuildPackedTopology()
+{
+  packed_topology_ = std::make_unique<PackedCellTopology>(*this);
+  return *packed_topology_;
+}
+
+// ###################################################################
+/**Returns the packed topology of the local cells, which must have been
+ * built with BuildPackedTopology.*/
+const chi_mesh::PackedCellTopology&
+chi_mesh::MeshContinuum::PackedTopology() const
+{
+  ChiLogicalErrorIf(not packed_topology_,
+                    "The packed topology has not been built. Call "
+                    "BuildPackedTopology first.");
+  return *packed_topology_;
 }
 
 // ###################################################################
@@ -3,51 +3,98 @@
 
 #include "mesh/chi_meshvector.h"
 
-#include <map>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
 
 namespace chi_mesh
 {
 
-/**Manages a vertex map with custom calls.*/
+/**Manages the locally stored vertices with custom calls. The vertices are
+ * stored contiguously, sorted by global id, which also serves as the
+ * global-to-local index. Iterating yields (global id, vertex) pairs in
+ * increasing global id order.*/
 class VertexHandler
 {
-  typedef std::map<uint64_t, chi_mesh::Vector3> GlobalIDMap;
+  typedef std::pair<uint64_t, chi_mesh::Vector3> IDVertexPair;
+  typedef std::vector<IDVertexPair> GlobalIDVertexList;
 private:
-  std::map<uint64_t, chi_mesh::Vector3> m_global_id_vertex_map;
+  GlobalIDVertexList m_global_id_vertices;
+
+  GlobalIDVertexList::const_iterator Find(const uint64_t global_id) const
+  {
+    auto it = std::lower_bound(m_global_id_vertices.begin(),
+                               m_global_id_vertices.end(),
+                               global_id,
+                               [](const IDVertexPair& pair, uint64_t id)
+                               { return pair.first < id; });
+    if (it != m_global_id_vertices.end() and it->first == global_id)
+      return it;
+
+    throw std::out_of_range("chi_mesh::VertexHandler: Vertex " +
+                            std::to_string(global_id) +
+                            " not stored locally.");
+  }
 
 public:
   // Iterators
-  GlobalIDMap::iterator begin() {return m_global_id_vertex_map.begin();}
-  GlobalIDMap::iterator end() {return m_global_id_vertex_map.end();}
+  GlobalIDVertexList::iterator begin() {return m_global_id_vertices.begin();}
+  GlobalIDVertexList::iterator end() {return m_global_id_vertices.end();}
 
-  GlobalIDMap::const_iterator begin() const {return m_global_id_vertex_map.begin();}
-  GlobalIDMap::const_iterator end() const {return m_global_id_vertex_map.end();}
+  GlobalIDVertexList::const_iterator begin() const
+  {return m_global_id_vertices.begin();}
+  GlobalIDVertexList::const_iterator end() const
+  {return m_global_id_vertices.end();}
 
   // Accessors
   chi_mesh::Vector3& operator[](const uint64_t global_id)
   {
-    return m_global_id_vertex_map.at(global_id);
+    const auto it = Find(global_id);
+    return m_global_id_vertices[it - m_global_id_vertices.cbegin()].second;
   }
 
   const chi_mesh::Vector3& operator[](const uint64_t global_id) const
   {
-    return m_global_id_vertex_map.at(global_id);
+    return Find(global_id)->second;
   }
 
   // Utilities
+  /**Adds a vertex, unless a vertex with the same global id is already
+   * stored. Inserting in increasing global id order appends in constant
+   * time, otherwise the later vertices are shifted. References to the
+   * vertices are invalidated.*/
   void Insert(const uint64_t global_id, const chi_mesh::Vector3& vec)
   {
-    m_global_id_vertex_map.insert(std::make_pair(global_id, vec));
+    auto& list = m_global_id_vertices;
+    if (list.empty() or list.back().first < global_id)
+    {
+      list.emplace_back(global_id, vec);
+      return;
+    }
+
+    auto it = std::lower_bound(list.begin(),
+                               list.end(),
+                               global_id,
+                               [](const IDVertexPair& pair, uint64_t id)
+                               { return pair.first < id; });
+    if (it->first != global_id) list.emplace(it, global_id, vec);
+  }
+
+  void Reserve(const size_t num_vertices)
+  {
+    m_global_id_vertices.reserve(num_vertices);
   }
 
   size_t NumLocallyStored() const
   {
-    return m_global_id_vertex_map.size();
+    return m_global_id_vertices.size();
   }
 
   void Clear()
   {
-    m_global_id_vertex_map.clear();
+    m_global_id_vertices.clear();
+    m_global_id_vertices.shrink_to_fit();
   }
 };
 
@@ -244,6 +244,9 @@ void chi_mesh::mesh_cutting::
     }//for cell_ptr
   }
 
+  //============================================= Cut cells changed faces
+  mesh.InvalidateFaceAssociations();
+
   Chi::log.Log() << "Done cutting mesh with plane. Num cells = "
                 << mesh.local_cells.size();
 }
\ No newline at end of file
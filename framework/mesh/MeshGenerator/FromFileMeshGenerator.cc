@@ -1,6 +1,7 @@
 #include "FromFileMeshGenerator.h"
 
 #include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
 #include "ChiObjectFactory.h"
 
@@ -22,7 +23,12 @@ chi::InputParameters FromFileMeshGenerator::GetInputParameters()
                                " from a file.");
   params.SetDocGroup("MeshGenerator");
 
-  params.AddRequiredParameter<std::string>("filename", "Path to the file.");
+  params.AddRequiredParameter<std::string>(
+    "filename",
+    "Path to the file. A mesh checkpoint, written with "
+    "chiMeshHandlerExportMeshToCheckpoint(\"<base>\") as one file per "
+    "process, is loaded with \"<base>.cmesh\" and bypasses connectivity "
+    "building and partitioning. It requires the same number of processes.");
   params.AddOptionalParameter(
     "material_id_fieldname",
     "BlockID",
@@ -30,6 +36,15 @@ chi::InputParameters FromFileMeshGenerator::GetInputParameters()
     "for .vtu, .pvtu and .e files.");
   params.AddOptionalParameter(
     "boundary_id_fieldname", "", "The name of the field storing boundary-ids");
+  params.AddOptionalParameter(
+    "connectivity_num_threads",
+    1,
+    "Number of threads used to establish the cell connectivity of the "
+    "unpartitioned mesh.");
+
+  using namespace chi_data_types;
+  params.ConstrainParameterRange("connectivity_num_threads",
+                                 AllowableRangeLowLimit::New(1));
 
   return params;
 }
@@ -40,12 +55,46 @@ FromFileMeshGenerator::FromFileMeshGenerator(const chi::InputParameters& params)
     material_id_fieldname_(
       params.GetParamValue<std::string>("material_id_fieldname")),
     boundary_id_fieldname_(
-      params.GetParamValue<std::string>("boundary_id_fieldname"))
+      params.GetParamValue<std::string>("boundary_id_fieldname")),
+    connectivity_num_threads_(
+      params.GetParamValue<size_t>("connectivity_num_threads"))
 {
   const std::filesystem::path filepath(filename_);
   const std::string extension = filepath.extension();
 }
 
+// ##################################################################
+/**Mesh checkpoints (.cmesh) are already partitioned and are loaded
+ * directly as the final mesh.*/
+void FromFileMeshGenerator::Execute()
+{
+  const std::filesystem::path filepath(filename_);
+  if (filepath.extension() != ".cmesh")
+  {
+    MeshGenerator::Execute();
+    return;
+  }
+
+  Chi::log.Log() << "FromFileMeshGenerator: Loading mesh checkpoint";
+
+  const std::string file_base_name = filepath.parent_path() / filepath.stem();
+  auto grid_ptr = MeshContinuum::ReadCheckpoint(file_base_name);
+
+  size_t total_local_cells = grid_ptr->local_cells.size();
+  size_t total_global_cells = 0;
+  MPI_Allreduce(&total_local_cells,
+                &total_global_cells,
+                1,
+                MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM,
+                Chi::mpi.comm);
+
+  Chi::log.Log() << "FromFileMeshGenerator: Cells loaded = "
+                 << total_global_cells;
+
+  AssignToCurrentHandler(grid_ptr);
+}
+
 std::unique_ptr<UnpartitionedMesh>
 FromFileMeshGenerator::GenerateUnpartitionedMesh(
   std::unique_ptr<UnpartitionedMesh> input_umesh)
@@ -60,6 +109,7 @@ FromFileMeshGenerator::GenerateUnpartitionedMesh(
   options.scale = scale_;
   options.material_id_fieldname = material_id_fieldname_;
   options.boundary_id_fieldname = boundary_id_fieldname_;
+  options.connectivity_num_threads = connectivity_num_threads_;
 
   const std::filesystem::path filepath(filename_);
   const std::string extension = filepath.extension();
@@ -79,6 +129,9 @@ FromFileMeshGenerator::GenerateUnpartitionedMesh(
     umesh->ReadFromPVTU(options);
   else if (extension == ".case")
     umesh->ReadFromEnsightGold(options);
+  else if (extension == ".cmesh")
+    ChiInvalidArgument("Mesh checkpoints are already partitioned and can "
+                       "not be the input of another mesh generator.");
   else
     ChiInvalidArgument("Unsupported file type \"" + extension +
                        "\". Supported types limited to"
@@ -88,4 +141,35 @@ FromFileMeshGenerator::GenerateUnpartitionedMesh(
   return umesh;
 }
 
-} // namespace chi_mesh
\ No newline at end of file
+// ##################################################################
+/**Reads this location's slab of the mesh file. Only .msh files can be read
+ * in slabs.*/
+std::unique_ptr<UnpartitionedMeshSlab>
+FromFileMeshGenerator::GenerateUnpartitionedMeshSlab()
+{
+  UnpartitionedMesh::Options options;
+  options.file_name = filename_;
+  options.scale = scale_;
+  options.material_id_fieldname = material_id_fieldname_;
+  options.boundary_id_fieldname = boundary_id_fieldname_;
+
+  const std::filesystem::path filepath(filename_);
+  const std::string extension = filepath.extension();
+
+  ChiInvalidArgumentIf(extension != ".msh",
+                       "Unsupported file type \"" + extension +
+                         "\" for \"distributed_setup\". Supported types "
+                         "limited to .msh.");
+
+  auto slab = std::make_unique<UnpartitionedMeshSlab>();
+
+  Chi::log.Log() << "FromFileMeshGenerator: Generating UnpartitionedMeshSlab";
+
+  slab->ReadFromMsh(options);
+
+  Chi::log.Log()
+    << "FromFileMeshGenerator: Done generating UnpartitionedMeshSlab";
+  return slab;
+}
+
+} // namespace chi_mesh
@@ -12,12 +12,21 @@ public:
   static chi::InputParameters GetInputParameters();
   explicit FromFileMeshGenerator(const chi::InputParameters& params);
 
+  /**Loads a mesh checkpoint directly, otherwise executes the regular mesh
+   * generation.*/
+  void Execute() override;
+
 protected:
   std::unique_ptr<UnpartitionedMesh> GenerateUnpartitionedMesh(
     std::unique_ptr<UnpartitionedMesh> input_umesh) override;
+
+  std::unique_ptr<UnpartitionedMeshSlab>
+  GenerateUnpartitionedMeshSlab() override;
+
   const std::string filename_;
   const std::string material_id_fieldname_;
   const std::string boundary_id_fieldname_;
+  const size_t connectivity_num_threads_;
 };
 
 } // namespace chi_mesh
@@ -2,6 +2,7 @@
 
 #include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh.h"
 #include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "mesh/VolumeMesher/chi_volumemesher.h"
 #include "graphs/GraphPartitioner.h"
 #include "graphs/PETScGraphPartitioner.h"
@@ -42,13 +43,35 @@ chi::InputParameters MeshGenerator::GetInputParameters()
     false,
     "Flag, when set, makes the mesh appear in full fidelity on each process");
 
+  params.AddOptionalParameter(
+    "distributed_setup",
+    false,
+    "Flag, when set, makes each process generate or read only a slab of the "
+    "mesh, after which connectivity, partitioning and the distribution of "
+    "cells are performed in parallel. No process ever holds the entire mesh. "
+    "Cannot be combined with \"inputs\" or \"replicated_mesh\".");
+
+  params.AddOptionalParameter(
+    "cell_ordering",
+    "none",
+    "Renumbering applied to the local cells after partitioning, to improve "
+    "the memory locality of cell-wise data. \"hilbert\" orders the cells "
+    "along a Hilbert curve through their centroids, \"rcm\" applies reverse "
+    "Cuthill-McKee to the local cell graph.");
+
+  using namespace chi_data_types;
+  params.ConstrainParameterRange(
+    "cell_ordering", AllowableRangeList::New({"none", "hilbert", "rcm"}));
+
   return params;
 }
 
 MeshGenerator::MeshGenerator(const chi::InputParameters& params)
   : ChiObject(params),
     scale_(params.GetParamValue<double>("scale")),
-    replicated_(params.GetParamValue<bool>("replicated_mesh"))
+    replicated_(params.GetParamValue<bool>("replicated_mesh")),
+    distributed_setup_(params.GetParamValue<bool>("distributed_setup")),
+    cell_ordering_(params.GetParamValue<std::string>("cell_ordering"))
 {
   //============================================= Convert input handles
   auto input_handles = params.GetParamVectorValue<size_t>("inputs");
@@ -60,6 +83,13 @@ MeshGenerator::MeshGenerator(const chi::InputParameters& params)
     inputs_.push_back(&mesh_generator);
   }
 
+  ChiInvalidArgumentIf(distributed_setup_ and not inputs_.empty(),
+                       "\"distributed_setup\" cannot be used with input "
+                       "mesh generators.");
+  ChiInvalidArgumentIf(distributed_setup_ and replicated_,
+                       "\"distributed_setup\" cannot be used with "
+                       "\"replicated_mesh\".");
+
   //============================================= Set partitioner
   size_t partitioner_handle;
   if (params.ParametersAtAssignment().Has("partitioner"))
@@ -83,23 +113,54 @@ std::unique_ptr<UnpartitionedMesh> MeshGenerator::GenerateUnpartitionedMesh(
   return input_umesh;
 }
 
+// ##################################################################
+/**Default behavior here is to error out since not every generator can
+ * generate a slab of its mesh.*/
+std::unique_ptr<UnpartitionedMeshSlab>
+MeshGenerator::GenerateUnpartitionedMeshSlab()
+{
+  ChiInvalidArgument("This mesh generator does not support "
+                     "\"distributed_setup\".");
+}
+
 /**Final execution step. */
 void MeshGenerator::Execute()
 {
-  //======================================== Execute all input generators
-  // Note these could be empty
-  std::unique_ptr<UnpartitionedMesh> current_umesh = nullptr;
-  for (auto mesh_generator_ptr : inputs_)
+  std::shared_ptr<MeshContinuum> grid_ptr;
+  if (distributed_setup_)
+  {
+    //====================================== Generate slab and convert it
+    auto slab = GenerateUnpartitionedMeshSlab();
+    grid_ptr = SetupMeshDistributed(std::move(slab));
+  }
+  else
   {
-    auto new_umesh =
-      mesh_generator_ptr->GenerateUnpartitionedMesh(std::move(current_umesh));
-    current_umesh = std::move(new_umesh);
+    //====================================== Execute all input generators
+    // Note these could be empty
+    std::unique_ptr<UnpartitionedMesh> current_umesh = nullptr;
+    for (auto mesh_generator_ptr : inputs_)
+    {
+      auto new_umesh =
+        mesh_generator_ptr->GenerateUnpartitionedMesh(std::move(current_umesh));
+      current_umesh = std::move(new_umesh);
+    }
+
+    //====================================== Generate final umesh and convert it
+    current_umesh = GenerateUnpartitionedMesh(std::move(current_umesh));
+    grid_ptr = SetupMesh(std::move(current_umesh));
   }
 
-  //======================================== Generate final umesh and convert it
-  current_umesh = GenerateUnpartitionedMesh(std::move(current_umesh));
-  auto grid_ptr = SetupMesh(std::move(current_umesh));
+  grid_ptr->ReorderLocalCells(cell_ordering_);
 
+  AssignToCurrentHandler(grid_ptr);
+}
+
+// ##################################################################
+/**Makes the grid the mesh of the current mesh handler, creating a handler
+ * if none exists.*/
+void MeshGenerator::AssignToCurrentHandler(
+  std::shared_ptr<MeshContinuum> grid_ptr)
+{
   //======================================== Assign the mesh to a VolumeMesher
   auto new_mesher =
     std::make_shared<chi_mesh::VolumeMesher>(VolumeMesherType::UNPARTITIONED);
@@ -3,6 +3,7 @@
 
 #include "ChiObject.h"
 #include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh.h"
+#include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh_slab.h"
 
 namespace chi
 {
@@ -30,6 +31,11 @@ class MeshContinuum;
  * this mesh into real mesh (with both steps customizable). The phase that
  * creates the real mesh can be hooked up to a partitioner that can also be
  * designed to be pluggable.
+ *
+ * With the `distributed_setup` parameter set, no location ever holds the
+ * complete unpartitioned mesh. Each location generates (or reads) only a
+ * slab of the mesh, after which connectivity, partitioning and the
+ * redistribution of cells and vertices are performed in parallel.
  * */
 class MeshGenerator : public ChiObject
 {
@@ -45,17 +51,32 @@ protected:
   virtual std::unique_ptr<UnpartitionedMesh>
   GenerateUnpartitionedMesh(std::unique_ptr<UnpartitionedMesh> input_umesh);
 
+  /**Virtual method to generate this location's slab of the unpartitioned
+   * mesh for a distributed setup.*/
+  virtual std::unique_ptr<UnpartitionedMeshSlab>
+  GenerateUnpartitionedMeshSlab();
+
   // 01
   /**Executes the partitioner and configures the mesh as a real mesh.*/
   virtual std::shared_ptr<MeshContinuum>
   SetupMesh(std::unique_ptr<UnpartitionedMesh> input_umesh_ptr);
 
+  // 03
+  /**Connects, partitions and redistributes the slabs of all locations and
+   * configures the result as a real mesh.*/
+  virtual std::shared_ptr<MeshContinuum>
+  SetupMeshDistributed(std::unique_ptr<UnpartitionedMeshSlab> slab);
+
+  /**Makes the grid the mesh of the current mesh handler.*/
+  static void AssignToCurrentHandler(std::shared_ptr<MeshContinuum> grid_ptr);
+
   // 02 utils
   /**Determines if a cells needs to be included as a ghost or as a local cell.*/
   bool
   CellHasLocalScope(const chi_mesh::UnpartitionedMesh::LightWeightCell& lwcell,
                     uint64_t cell_global_id,
-                    const std::vector<std::set<uint64_t>>& vertex_subscriptions,
+                    const UnpartitionedMesh::VertexCellSubscriptions&
+                      vertex_subscriptions,
                     const std::vector<int64_t>& cell_partition_ids);
 
   /**Converts a light-weight cell to a real cell.*/
@@ -65,8 +86,22 @@ protected:
             uint64_t partition_id,
             const std::vector<chi_mesh::Vector3>& vertices);
 
+  /**Converts a light-weight cell to a real cell, with the vertices looked up
+   * by global id.*/
+  static std::unique_ptr<chi_mesh::Cell>
+  SetupCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
+            uint64_t global_id,
+            uint64_t partition_id,
+            const std::map<uint64_t, chi_mesh::Vector3>& vertices);
+
+  /**Logs the total number of cells and the balance of the local cells over
+   * the locations. Returns the total number of cells.*/
+  static size_t ReportCellCounts(const MeshContinuum& grid);
+
   const double scale_;
   const bool replicated_;
+  const bool distributed_setup_;
+  const std::string cell_ordering_;
   std::vector<MeshGenerator*> inputs_;
   chi::GraphPartitioner* partitioner_ = nullptr;
 };
@@ -23,8 +23,11 @@ MeshGenerator::SetupMesh(std::unique_ptr<UnpartitionedMesh> input_umesh_ptr)
   CellGraph cell_graph;
   std::vector<chi_mesh::Vector3> cell_centroids;
 
+  std::vector<double> cell_weights;
+
   cell_graph.reserve(num_raw_cells);
   cell_centroids.reserve(num_raw_cells);
+  cell_weights.reserve(num_raw_cells);
   {
     uint64_t cell_globl_id = 0;
     for (const auto& raw_cell_ptr : raw_cells)
@@ -35,10 +38,14 @@ MeshGenerator::SetupMesh(std::unique_ptr<UnpartitionedMesh> input_umesh_ptr)
 
       cell_graph.push_back(cell_graph_node);
       cell_centroids.push_back(raw_cell_ptr->centroid);
+      cell_weights.push_back(
+        static_cast<double>(raw_cell_ptr->vertex_ids.size()));
     }
   }
 
   //============================================= Execute partitioner
+  // Cells are weighted with their number of vertices
+  partitioner_->SetRowWeights(std::move(cell_weights));
   auto cell_pids =
     partitioner_->Partition(cell_graph, cell_centroids, Chi::mpi.process_count);
 
@@ -49,6 +56,7 @@ MeshGenerator::SetupMesh(std::unique_ptr<UnpartitionedMesh> input_umesh_ptr)
     input_umesh_ptr->GetMeshOptions().boundary_id_map;
 
   auto& vertex_subs = input_umesh_ptr->GetVertextCellSubscriptions();
+  std::vector<uint64_t> local_vids;
   size_t cell_globl_id = 0;
   for (auto raw_cell : input_umesh_ptr->GetRawCells())
   {
@@ -59,8 +67,8 @@ MeshGenerator::SetupMesh(std::unique_ptr<UnpartitionedMesh> input_umesh_ptr)
                             cell_pids[cell_globl_id],
                             input_umesh_ptr->GetVertices());
 
-      for (uint64_t vid : cell->vertex_ids_)
-        grid_ptr->vertices.Insert(vid, input_umesh_ptr->GetVertices()[vid]);
+      local_vids.insert(
+        local_vids.end(), cell->vertex_ids_.begin(), cell->vertex_ids_.end());
 
       grid_ptr->cells.push_back(std::move(cell));
     }
@@ -68,25 +76,18 @@ MeshGenerator::SetupMesh(std::unique_ptr<UnpartitionedMesh> input_umesh_ptr)
     ++cell_globl_id;
   } // for raw_cell
 
+  // Vertices are inserted in increasing id order, which appends them
+  std::sort(local_vids.begin(), local_vids.end());
+  local_vids.erase(std::unique(local_vids.begin(), local_vids.end()),
+                   local_vids.end());
+  grid_ptr->vertices.Reserve(local_vids.size());
+  for (uint64_t vid : local_vids)
+    grid_ptr->vertices.Insert(vid, input_umesh_ptr->GetVertices()[vid]);
+
   grid_ptr->SetGlobalVertexCount(input_umesh_ptr->GetVertices().size());
 
   //======================================== Concluding messages
-  Chi::log.LogAllVerbose1()
-    << "### LOCATION[" << Chi::mpi.location_id
-    << "] amount of local cells=" << grid_ptr->local_cells.size();
-
-  size_t total_local_cells = grid_ptr->local_cells.size();
-  size_t total_global_cells = 0;
-
-  MPI_Allreduce(&total_local_cells,
-                &total_global_cells,
-                1,
-                MPI_UNSIGNED_LONG_LONG,
-                MPI_SUM,
-                Chi::mpi.comm);
-
-  Chi::log.Log() << "MeshGenerator: Cells created = " << total_global_cells
-                 << std::endl;
+  ReportCellCounts(*grid_ptr);
 
   return grid_ptr;
 }
@@ -1,5 +1,11 @@
 #include "MeshGenerator.h"
 
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
 namespace chi_mesh
 {
 
@@ -8,7 +14,7 @@ namespace chi_mesh
 bool chi_mesh::MeshGenerator::CellHasLocalScope(
   const chi_mesh::UnpartitionedMesh::LightWeightCell& lwcell,
   uint64_t cell_global_id,
-  const std::vector<std::set<uint64_t>>& vertex_subscriptions,
+  const UnpartitionedMesh::VertexCellSubscriptions& vertex_subscriptions,
   const std::vector<int64_t>& cell_partition_ids)
 {
   if (replicated_)
@@ -29,13 +35,18 @@ bool chi_mesh::MeshGenerator::CellHasLocalScope(
   return false;
 }
 
+namespace
+{
+
 // ###################################################################
-/**Converts a light-weight cell to a real cell.*/
+/**Converts a light-weight cell to a real cell. `vertices` can be any
+ * container returning a vertex for `vertices.at(global_id)`.*/
+template <typename VertexContainer>
 std::unique_ptr<chi_mesh::Cell>
-MeshGenerator::SetupCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
-                         uint64_t global_id,
-                         uint64_t partition_id,
-                         const std::vector<chi_mesh::Vector3>& vertices)
+MakeCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
+         uint64_t global_id,
+         uint64_t partition_id,
+         const VertexContainer& vertices)
 {
   auto cell =
     std::make_unique<chi_mesh::Cell>(raw_cell.type, raw_cell.sub_type);
@@ -57,7 +68,7 @@ MeshGenerator::SetupCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
     newFace.vertex_ids_ = raw_face.vertex_ids;
     auto vfc = chi_mesh::Vertex(0.0, 0.0, 0.0);
     for (auto fvid : newFace.vertex_ids_)
-      vfc = vfc + vertices[fvid];
+      vfc = vfc + vertices.at(fvid);
     newFace.centroid_ = vfc / static_cast<double>(newFace.vertex_ids_.size());
 
     if (cell->Type() == CellType::SLAB)
@@ -77,7 +88,7 @@ MeshGenerator::SetupCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
       // centroid. The normal is then just khat
       // cross-product with this vector.
       uint64_t fvid = newFace.vertex_ids_[0];
-      auto vec_vvc = vertices[fvid] - newFace.centroid_;
+      auto vec_vvc = vertices.at(fvid) - newFace.centroid_;
 
       newFace.normal_ = chi_mesh::Vector3(0.0, 0.0, 1.0).Cross(vec_vvc);
       newFace.normal_.Normalize();
@@ -97,8 +108,8 @@ MeshGenerator::SetupCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
         uint64_t fvid_m = newFace.vertex_ids_[fv];
         uint64_t fvid_p = newFace.vertex_ids_[fvp1];
 
-        auto leg_m = vertices[fvid_m] - newFace.centroid_;
-        auto leg_p = vertices[fvid_p] - newFace.centroid_;
+        auto leg_m = vertices.at(fvid_m) - newFace.centroid_;
+        auto leg_p = vertices.at(fvid_p) - newFace.centroid_;
 
         auto vn = leg_m.Cross(leg_p);
 
@@ -118,4 +129,71 @@ MeshGenerator::SetupCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
   return cell;
 }
 
+} // namespace
+
+// ###################################################################
+/**Converts a light-weight cell to a real cell.*/
+std::unique_ptr<chi_mesh::Cell>
+MeshGenerator::SetupCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
+                         uint64_t global_id,
+                         uint64_t partition_id,
+                         const std::vector<chi_mesh::Vector3>& vertices)
+{
+  return MakeCell(raw_cell, global_id, partition_id, vertices);
+}
+
+// ###################################################################
+/**Converts a light-weight cell to a real cell, with the vertices looked up
+ * by global id.*/
+std::unique_ptr<chi_mesh::Cell>
+MeshGenerator::SetupCell(const UnpartitionedMesh::LightWeightCell& raw_cell,
+                         uint64_t global_id,
+                         uint64_t partition_id,
+                         const std::map<uint64_t, chi_mesh::Vector3>& vertices)
+{
+  return MakeCell(raw_cell, global_id, partition_id, vertices);
+}
+
+// ###################################################################
+/**Logs the total number of cells and the balance of the local cells over
+ * the locations. Returns the total number of cells. Must be called by all
+ * locations.*/
+size_t MeshGenerator::ReportCellCounts(const MeshContinuum& grid)
+{
+  Chi::log.LogAllVerbose1()
+    << "### LOCATION[" << Chi::mpi.location_id
+    << "] amount of local cells=" << grid.local_cells.size();
+
+  const uint64_t num_local_cells = grid.local_cells.size();
+  uint64_t total_global_cells = 0;
+  uint64_t min_local_cells = 0;
+  uint64_t max_local_cells = 0;
+
+  MPI_Allreduce(&num_local_cells,
+                &total_global_cells,
+                1,
+                MPI_UINT64_T,
+                MPI_SUM,
+                Chi::mpi.comm);
+  MPI_Allreduce(&num_local_cells,
+                &min_local_cells,
+                1,
+                MPI_UINT64_T,
+                MPI_MIN,
+                Chi::mpi.comm);
+  MPI_Allreduce(&num_local_cells,
+                &max_local_cells,
+                1,
+                MPI_UINT64_T,
+                MPI_MAX,
+                Chi::mpi.comm);
+
+  Chi::log.Log() << "MeshGenerator: Cells created = " << total_global_cells
+                 << std::endl;
+  Chi::log.Log() << "MeshGenerator: Local cells min = " << min_local_cells
+                 << ", max = " << max_local_cells;
+
+  return total_global_cells;
+}
+
 } // namespace chi_mesh
\ No newline at end of file
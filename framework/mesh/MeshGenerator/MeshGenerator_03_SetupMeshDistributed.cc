@@ -0,0 +1,429 @@
+#include "MeshGenerator.h"
+
+#include "mesh/Cell/cell.h"
+#include "graphs/GraphPartitioner.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mpi/chi_mpi_utils_map_all2all.h"
+#include "data_types/byte_array.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <algorithm>
+
+namespace chi_mesh
+{
+
+namespace
+{
+
+// ###################################################################
+/**Establishes the connectivity of the cells of all slabs. The faces are
+ * identified by their sorted vertex ids and are sent to the location
+ * owning the smallest of these vertex ids. There matching cell faces are
+ * connected and cell faces matching a boundary cell obtain the boundary
+ * id. Must be called by all locations.*/
+void ConnectSlabs(UnpartitionedMeshSlab& slab)
+{
+  typedef UnpartitionedMeshSlab Slab;
+  const int P = Chi::mpi.process_count;
+
+  const uint64_t CELL_FACE = 0;
+  const uint64_t BOUNDARY_CELL = 1;
+
+  auto KeyOwner = [&slab, P](const std::vector<uint64_t>& key)
+  { return Slab::BlockOwner(key.front(), slab.num_global_vertices, P); };
+
+  //============================================= Send the unconnected faces
+  // Each entry is [type, cell global id or boundary id, face index,
+  // number of vertices, sorted vertex ids]
+  std::map<int, std::vector<uint64_t>> face_entries;
+  auto AddEntry = [&](uint64_t type,
+                      uint64_t id,
+                      uint64_t f,
+                      std::vector<uint64_t> key)
+  {
+    std::sort(key.begin(), key.end());
+    auto& entries = face_entries[KeyOwner(key)];
+    entries.push_back(type);
+    entries.push_back(id);
+    entries.push_back(f);
+    entries.push_back(key.size());
+    entries.insert(entries.end(), key.begin(), key.end());
+  };
+
+  for (size_t c = 0; c < slab.cells.size(); ++c)
+  {
+    const auto& faces = slab.cells[c]->faces;
+    for (size_t f = 0; f < faces.size(); ++f)
+      if (not faces[f].has_neighbor)
+        AddEntry(CELL_FACE, slab.cell_offset + c, f, faces[f].vertex_ids);
+  }
+
+  for (const auto& bndry_cell : slab.boundary_cells)
+    AddEntry(BOUNDARY_CELL,
+             static_cast<uint64_t>(bndry_cell->material_id),
+             0,
+             bndry_cell->vertex_ids);
+
+  const auto received_entries =
+    chi_mpi_utils::MapAllToAll(face_entries, MPI_UINT64_T);
+  face_entries.clear();
+
+  //============================================= Match the faces
+  struct FaceMatches
+  {
+    // [source location, cell global id, face index]
+    std::vector<std::array<uint64_t, 3>> cell_faces;
+    bool on_boundary = false;
+    uint64_t boundary_id = 0;
+  };
+  std::map<std::vector<uint64_t>, FaceMatches> face_matches;
+
+  for (const auto& [pid, entries] : received_entries)
+  {
+    size_t k = 0;
+    while (k < entries.size())
+    {
+      const uint64_t type = entries[k];
+      const uint64_t id = entries[k + 1];
+      const uint64_t f = entries[k + 2];
+      const uint64_t num_verts = entries[k + 3];
+      k += 4;
+
+      std::vector<uint64_t> key(
+        entries.begin() + static_cast<int64_t>(k),
+        entries.begin() + static_cast<int64_t>(k + num_verts));
+      k += num_verts;
+
+      auto& matches = face_matches[key];
+      if (type == CELL_FACE)
+        matches.cell_faces.push_back({static_cast<uint64_t>(pid), id, f});
+      else
+      {
+        matches.on_boundary = true;
+        matches.boundary_id = id;
+      }
+    }
+  }
+
+  //============================================= Send back the neighbors
+  // Each entry is [cell global id, face index, has neighbor, neighbor]
+  std::map<int, std::vector<uint64_t>> neighbor_entries;
+  for (const auto& [key, matches] : face_matches)
+  {
+    const auto& cell_faces = matches.cell_faces;
+    if (cell_faces.size() == 2)
+    {
+      for (size_t i = 0; i < 2; ++i)
+      {
+        const auto& cell_face = cell_faces[i];
+        const auto& adj_cell_face = cell_faces[1 - i];
+        auto& entries = neighbor_entries[static_cast<int>(cell_face[0])];
+        entries.insert(entries.end(),
+                       {cell_face[1], cell_face[2], 1, adj_cell_face[1]});
+      }
+    }
+    else if (cell_faces.size() == 1 and matches.on_boundary)
+    {
+      const auto& cell_face = cell_faces.front();
+      auto& entries = neighbor_entries[static_cast<int>(cell_face[0])];
+      entries.insert(entries.end(),
+                     {cell_face[1], cell_face[2], 0, matches.boundary_id});
+    }
+    else
+      ChiLogicalErrorIf(cell_faces.size() > 2,
+                        "A face is shared by more than two cells.");
+  }
+  face_matches.clear();
+
+  const auto received_neighbors =
+    chi_mpi_utils::MapAllToAll(neighbor_entries, MPI_UINT64_T);
+
+  for (const auto& [pid, entries] : received_neighbors)
+    for (size_t k = 0; k < entries.size(); k += 4)
+    {
+      auto& face = slab.cells.at(entries[k] - slab.cell_offset)
+                     ->faces.at(entries[k + 1]);
+      face.has_neighbor = entries[k + 2] == 1;
+      face.neighbor = entries[k + 3];
+    }
+
+  slab.has_connectivity = true;
+}
+
+} // namespace
+
+// ###################################################################
+/**Connects, partitions and redistributes the slabs of all locations and
+ * configures the result as a real mesh.
+ *
+ * No location holds more than its own slab plus the cells, and their
+ * vertices, it receives. Vertex coordinates are fetched from the locations
+ * owning the vertex blocks. The graph of the cells is partitioned with
+ * GraphPartitioner::PartitionDistributed. Cells sharing a vertex with a cell
+ * of another partition are sent to that partition as ghost cells, which
+ * yields the same local and ghost cells as the replicated setup.*/
+std::shared_ptr<MeshContinuum> MeshGenerator::SetupMeshDistributed(
+  std::unique_ptr<UnpartitionedMeshSlab> slab_ptr)
+{
+  typedef UnpartitionedMeshSlab Slab;
+  auto& slab = *slab_ptr;
+
+  const int P = Chi::mpi.process_count;
+  const uint64_t num_global_vertices = slab.num_global_vertices;
+  const size_t num_local_cells = slab.cells.size();
+
+  ChiLogicalErrorIf(slab.num_global_cells == 0, "No cells in final input mesh");
+
+  auto VertexOwner = [num_global_vertices, P](uint64_t vid)
+  { return Slab::BlockOwner(vid, num_global_vertices, P); };
+
+  //============================================= Establish connectivity
+  if (not slab.has_connectivity) ConnectSlabs(slab);
+  slab.boundary_cells.clear();
+
+  //============================================= Fetch the cell vertices
+  std::map<uint64_t, chi_mesh::Vector3> cell_vertices;
+  {
+    std::set<uint64_t> needed_vids;
+    for (const auto& cell : slab.cells)
+      needed_vids.insert(cell->vertex_ids.begin(), cell->vertex_ids.end());
+
+    std::map<int, std::vector<uint64_t>> vid_queries;
+    for (uint64_t vid : needed_vids)
+      vid_queries[VertexOwner(vid)].push_back(vid);
+
+    const auto received_queries =
+      chi_mpi_utils::MapAllToAll(vid_queries, MPI_UINT64_T);
+
+    std::map<int, std::vector<double>> vertex_replies;
+    for (const auto& [pid, vids] : received_queries)
+    {
+      auto& coords = vertex_replies[pid];
+      coords.reserve(3 * vids.size());
+      for (uint64_t vid : vids)
+      {
+        const auto& vertex = slab.vertices.at(vid - slab.vertex_offset);
+        coords.insert(coords.end(), {vertex.x, vertex.y, vertex.z});
+      }
+    }
+
+    const auto received_replies =
+      chi_mpi_utils::MapAllToAll(vertex_replies, MPI_DOUBLE);
+
+    for (const auto& [pid, vids] : vid_queries)
+    {
+      const auto& coords = received_replies.at(pid);
+      ChiLogicalErrorIf(coords.size() != 3 * vids.size(),
+                        "Mismatch in the number of vertices received.");
+      for (size_t v = 0; v < vids.size(); ++v)
+        cell_vertices[vids[v]] = chi_mesh::Vector3(
+          coords[3 * v], coords[3 * v + 1], coords[3 * v + 2]);
+    }
+  }
+  slab.vertices.clear();
+  slab.vertices.shrink_to_fit();
+
+  //============================================= Build cell graph and centroids
+  typedef std::vector<uint64_t> CellGraphNode;
+  typedef std::vector<CellGraphNode> CellGraph;
+  CellGraph cell_graph;
+  std::vector<chi_mesh::Vector3> cell_centroids;
+
+  std::vector<double> cell_weights;
+
+  cell_graph.reserve(num_local_cells);
+  cell_centroids.reserve(num_local_cells);
+  cell_weights.reserve(num_local_cells);
+  for (size_t c = 0; c < num_local_cells; ++c)
+  {
+    auto& raw_cell = *slab.cells[c];
+
+    raw_cell.centroid = chi_mesh::Vertex(0.0, 0.0, 0.0);
+    for (uint64_t vid : raw_cell.vertex_ids)
+      raw_cell.centroid += cell_vertices.at(vid);
+    raw_cell.centroid =
+      raw_cell.centroid / static_cast<double>(raw_cell.vertex_ids.size());
+
+    CellGraphNode cell_graph_node = {slab.cell_offset + c};
+    for (auto& face : raw_cell.faces)
+      if (face.has_neighbor) cell_graph_node.push_back(face.neighbor);
+
+    cell_graph.push_back(std::move(cell_graph_node));
+    cell_centroids.push_back(raw_cell.centroid);
+    cell_weights.push_back(static_cast<double>(raw_cell.vertex_ids.size()));
+  }
+
+  //============================================= Execute partitioner
+  // Cells are weighted with their number of vertices
+  partitioner_->SetRowWeights(std::move(cell_weights));
+  const auto cell_pids = partitioner_->PartitionDistributed(
+    cell_graph, cell_centroids, slab.cell_offset, slab.num_global_cells, P);
+  cell_graph.clear();
+  cell_centroids.clear();
+
+  //============================================= Determine the partitions
+  //                                              subscribing to each vertex
+  // Each location sends [vertex id, partition id] pairs to the vertex
+  // owners, which return [vertex id, number of partitions, partition ids]
+  // to every location that referenced the vertex.
+  std::map<uint64_t, std::vector<uint64_t>> vertex_partitions;
+  {
+    std::map<int, std::vector<uint64_t>> vid_pid_pairs;
+    for (size_t c = 0; c < num_local_cells; ++c)
+      for (uint64_t vid : slab.cells[c]->vertex_ids)
+      {
+        auto& pairs = vid_pid_pairs[VertexOwner(vid)];
+        pairs.push_back(vid);
+        pairs.push_back(static_cast<uint64_t>(cell_pids[c]));
+      }
+
+    const auto received_pairs =
+      chi_mpi_utils::MapAllToAll(vid_pid_pairs, MPI_UINT64_T);
+    vid_pid_pairs.clear();
+
+    std::map<uint64_t, std::set<uint64_t>> vertex_pids;
+    std::map<uint64_t, std::set<int>> vertex_subscribers;
+    for (const auto& [pid, pairs] : received_pairs)
+      for (size_t k = 0; k < pairs.size(); k += 2)
+      {
+        vertex_pids[pairs[k]].insert(pairs[k + 1]);
+        vertex_subscribers[pairs[k]].insert(pid);
+      }
+
+    std::map<int, std::vector<uint64_t>> vertex_pid_lists;
+    for (const auto& [vid, subscribers] : vertex_subscribers)
+    {
+      const auto& pids = vertex_pids.at(vid);
+      for (int subscriber : subscribers)
+      {
+        auto& list = vertex_pid_lists[subscriber];
+        list.push_back(vid);
+        list.push_back(pids.size());
+        list.insert(list.end(), pids.begin(), pids.end());
+      }
+    }
+
+    const auto received_lists =
+      chi_mpi_utils::MapAllToAll(vertex_pid_lists, MPI_UINT64_T);
+
+    for (const auto& [pid, list] : received_lists)
+    {
+      size_t k = 0;
+      while (k < list.size())
+      {
+        const uint64_t vid = list[k];
+        const uint64_t num_pids = list[k + 1];
+        k += 2;
+        vertex_partitions[vid].assign(
+          list.begin() + static_cast<int64_t>(k),
+          list.begin() + static_cast<int64_t>(k + num_pids));
+        k += num_pids;
+      }
+    }
+  }
+
+  //============================================= Send cells to all locations
+  //                                              they are local or ghost on
+  // Each cell is serialized followed by its number of vertices and the
+  // vertex ids and coordinates.
+  std::map<int, std::vector<std::byte>> cell_bytes;
+  for (size_t c = 0; c < num_local_cells; ++c)
+  {
+    const auto& raw_cell = *slab.cells[c];
+
+    std::set<uint64_t> destinations = {static_cast<uint64_t>(cell_pids[c])};
+    for (uint64_t vid : raw_cell.vertex_ids)
+    {
+      const auto& pids = vertex_partitions.at(vid);
+      destinations.insert(pids.begin(), pids.end());
+    }
+
+    auto cell = SetupCell(raw_cell,
+                          slab.cell_offset + c,
+                          static_cast<uint64_t>(cell_pids[c]),
+                          cell_vertices);
+
+    chi_data_types::ByteArray raw = cell->Serialize();
+    raw.Write<size_t>(cell->vertex_ids_.size());
+    for (uint64_t vid : cell->vertex_ids_)
+    {
+      raw.Write<uint64_t>(vid);
+      raw.Write<chi_mesh::Vector3>(cell_vertices.at(vid));
+    }
+
+    for (uint64_t destination : destinations)
+    {
+      auto& bytes = cell_bytes[static_cast<int>(destination)];
+      bytes.insert(bytes.end(), raw.Data().begin(), raw.Data().end());
+    }
+  }
+  slab.cells.clear();
+  vertex_partitions.clear();
+  cell_vertices.clear();
+
+  const auto received_cell_bytes =
+    chi_mpi_utils::MapAllToAll(cell_bytes, MPI_BYTE);
+  cell_bytes.clear();
+
+  //============================================= Convert mesh
+  auto grid_ptr = chi_mesh::MeshContinuum::New();
+
+  grid_ptr->GetBoundaryIDMap() = slab.mesh_options.boundary_id_map;
+
+  // Cells are added in global id order, the same order as the
+  // replicated setup.
+  std::vector<std::unique_ptr<chi_mesh::Cell>> received_cells;
+  std::vector<std::pair<uint64_t, chi_mesh::Vector3>> received_vertices;
+  for (const auto& [pid, bytes] : received_cell_bytes)
+  {
+    const chi_data_types::ByteArray raw(bytes);
+    size_t address = 0;
+    while (address < raw.Size())
+    {
+      received_cells.push_back(std::make_unique<chi_mesh::Cell>(
+        chi_mesh::Cell::DeSerialize(raw, address)));
+
+      const auto num_vertices = raw.Read<size_t>(address, &address);
+      for (size_t v = 0; v < num_vertices; ++v)
+      {
+        const auto vid = raw.Read<uint64_t>(address, &address);
+        const auto vertex = raw.Read<chi_mesh::Vector3>(address, &address);
+        received_vertices.emplace_back(vid, vertex);
+      }
+    }
+  }
+
+  // Vertices are inserted in increasing id order, which appends them
+  std::sort(received_vertices.begin(),
+            received_vertices.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+  grid_ptr->vertices.Reserve(received_vertices.size());
+  for (const auto& [vid, vertex] : received_vertices)
+    grid_ptr->vertices.Insert(vid, vertex);
+  received_vertices.clear();
+
+  std::sort(received_cells.begin(),
+            received_cells.end(),
+            [](const std::unique_ptr<chi_mesh::Cell>& a,
+               const std::unique_ptr<chi_mesh::Cell>& b)
+            { return a->global_id_ < b->global_id_; });
+
+  for (auto& cell : received_cells)
+    grid_ptr->cells.push_back(std::move(cell));
+
+  grid_ptr->SetGlobalVertexCount(num_global_vertices);
+
+  //======================================== Concluding messages
+  const size_t total_global_cells = ReportCellCounts(*grid_ptr);
+
+  ChiLogicalErrorIf(total_global_cells != slab.num_global_cells,
+                    "The number of cells created does not match the number "
+                    "of cells generated.");
+
+  return grid_ptr;
+}
+
+} // namespace chi_mesh
@@ -2,7 +2,9 @@
 
 #include "ChiObjectFactory.h"
 
+#include "chi_runtime.h"
 #include "chi_log.h"
+#include "chi_mpi.h"
 
 namespace chi_mesh
 {
@@ -399,4 +401,204 @@ OrthogonalMeshGenerator::CreateUnpartitioned3DOrthoMesh(
   return umesh;
 }
 
-} // namespace chi_mesh
\ No newline at end of file
+// ##################################################################
+/**Generates this location's slab of the orthogonal mesh. The cells,
+ * vertices, faces and boundary ids are numbered exactly as in the
+ * replicated 1D, 2D and 3D meshes and, since the neighbors of a cell follow
+ * from its ijk-index, the slab is generated with its connectivity.*/
+std::unique_ptr<UnpartitionedMeshSlab>
+OrthogonalMeshGenerator::GenerateUnpartitionedMeshSlab()
+{
+  typedef UnpartitionedMesh::LightWeightCell LWCell;
+  typedef UnpartitionedMesh::LightWeightFace LWFace;
+  typedef UnpartitionedMeshSlab Slab;
+
+  auto slab = std::make_unique<Slab>();
+  auto& options = slab->mesh_options;
+
+  const size_t dimension = node_sets_.size();
+
+  //======================================== Map node sets to xyz
+  // 1D meshes are oriented along z
+  std::vector<double> x_nodes = {0.0}, y_nodes = {0.0}, z_nodes = {0.0};
+  if (dimension == 1) z_nodes = node_sets_[0];
+  if (dimension >= 2)
+  {
+    x_nodes = node_sets_[0];
+    y_nodes = node_sets_[1];
+  }
+  if (dimension == 3) z_nodes = node_sets_[2];
+
+  const uint64_t Nx = x_nodes.size();
+  const uint64_t Ny = y_nodes.size();
+  const uint64_t Nz = z_nodes.size();
+
+  // Number of cells per direction
+  const uint64_t Cx = (dimension >= 2) ? Nx - 1 : 1;
+  const uint64_t Cy = (dimension >= 2) ? Ny - 1 : 1;
+  const uint64_t Cz = (dimension != 2) ? Nz - 1 : 1;
+
+  options.ortho_Nx = Cx;
+  options.ortho_Ny = Cy;
+  options.ortho_Nz = Cz;
+  if (dimension >= 2)
+  {
+    options.boundary_id_map[0] = "XMAX";
+    options.boundary_id_map[1] = "XMIN";
+    options.boundary_id_map[2] = "YMAX";
+    options.boundary_id_map[3] = "YMIN";
+  }
+  if (dimension != 2)
+  {
+    options.boundary_id_map[4] = "ZMAX";
+    options.boundary_id_map[5] = "ZMIN";
+  }
+
+  if (dimension == 1) slab->attributes = DIMENSION_1 | ORTHOGONAL;
+  if (dimension == 2) slab->attributes = DIMENSION_2 | ORTHOGONAL;
+  if (dimension == 3) slab->attributes = DIMENSION_3 | ORTHOGONAL;
+
+  // i is the y-index, j the x-index and k the z-index, as in the
+  // replicated meshes
+  auto VID = [Nx, Nz](uint64_t i, uint64_t j, uint64_t k)
+  { return (i * Nx + j) * Nz + k; };
+  auto CID = [Cx, Cz](uint64_t i, uint64_t j, uint64_t k)
+  { return (i * Cx + j) * Cz + k; };
+
+  //======================================== Create vertices
+  slab->num_global_vertices = Nx * Ny * Nz;
+  const auto [v_begin, v_end] = Slab::BlockRange(
+    slab->num_global_vertices, Chi::mpi.location_id, Chi::mpi.process_count);
+  slab->vertex_offset = v_begin;
+  slab->vertices.reserve(v_end - v_begin);
+  for (uint64_t vid = v_begin; vid < v_end; ++vid)
+  {
+    const uint64_t k = vid % Nz;
+    const uint64_t j = (vid / Nz) % Nx;
+    const uint64_t i = vid / (Nz * Nx);
+    slab->vertices.emplace_back(x_nodes[j], y_nodes[i], z_nodes[k]);
+  }
+
+  //======================================== Create cells
+  auto MakeFace = [](std::vector<uint64_t> vertex_ids,
+                     bool has_neighbor,
+                     uint64_t neighbor,
+                     uint64_t boundary_id)
+  {
+    LWFace face(std::move(vertex_ids));
+    face.has_neighbor = has_neighbor;
+    face.neighbor = has_neighbor ? neighbor : boundary_id;
+    return face;
+  };
+
+  slab->num_global_cells = Cx * Cy * Cz;
+  const auto [c_begin, c_end] = Slab::BlockRange(
+    slab->num_global_cells, Chi::mpi.location_id, Chi::mpi.process_count);
+  slab->cell_offset = c_begin;
+  slab->cells.reserve(c_end - c_begin);
+  for (uint64_t cid = c_begin; cid < c_end; ++cid)
+  {
+    const uint64_t k = cid % Cz;
+    const uint64_t j = (cid / Cz) % Cx;
+    const uint64_t i = cid / (Cz * Cx);
+
+    std::unique_ptr<LWCell> cell;
+    if (dimension == 1)
+    {
+      cell = std::make_unique<LWCell>(CellType::SLAB, CellType::SLAB);
+      cell->vertex_ids = {k, k + 1};
+
+      cell->faces.push_back(MakeFace({k}, k > 0, k - 1, 5 /*ZMIN*/));
+      cell->faces.push_back(
+        MakeFace({k + 1}, k < Cz - 1, k + 1, 4 /*ZMAX*/));
+    }
+    else if (dimension == 2)
+    {
+      cell = std::make_unique<LWCell>(CellType::POLYGON,
+                                      CellType::QUADRILATERAL);
+      cell->vertex_ids = {
+        VID(i, j, 0), VID(i, j + 1, 0), VID(i + 1, j + 1, 0), VID(i + 1, j, 0)};
+      const auto& v = cell->vertex_ids;
+
+      cell->faces.push_back(
+        MakeFace({v[0], v[1]}, i > 0, CID(i - 1, j, 0), 3 /*YMIN*/));
+      cell->faces.push_back(
+        MakeFace({v[1], v[2]}, j < Cx - 1, CID(i, j + 1, 0), 0 /*XMAX*/));
+      cell->faces.push_back(
+        MakeFace({v[2], v[3]}, i < Cy - 1, CID(i + 1, j, 0), 2 /*YMAX*/));
+      cell->faces.push_back(
+        MakeFace({v[3], v[0]}, j > 0, CID(i, j - 1, 0), 1 /*XMIN*/));
+    }
+    else
+    {
+      cell = std::make_unique<LWCell>(CellType::POLYHEDRON,
+                                      CellType::HEXAHEDRON);
+      cell->vertex_ids = {VID(i, j, k),
+                          VID(i, j + 1, k),
+                          VID(i + 1, j + 1, k),
+                          VID(i + 1, j, k),
+
+                          VID(i, j, k + 1),
+                          VID(i, j + 1, k + 1),
+                          VID(i + 1, j + 1, k + 1),
+                          VID(i + 1, j, k + 1)};
+
+      // East face
+      cell->faces.push_back(MakeFace({VID(i, j + 1, k),
+                                      VID(i + 1, j + 1, k),
+                                      VID(i + 1, j + 1, k + 1),
+                                      VID(i, j + 1, k + 1)},
+                                     j < Cx - 1,
+                                     CID(i, j + 1, k),
+                                     0 /*XMAX*/));
+      // West face
+      cell->faces.push_back(MakeFace({VID(i, j, k),
+                                      VID(i, j, k + 1),
+                                      VID(i + 1, j, k + 1),
+                                      VID(i + 1, j, k)},
+                                     j > 0,
+                                     CID(i, j - 1, k),
+                                     1 /*XMIN*/));
+      // North face
+      cell->faces.push_back(MakeFace({VID(i + 1, j, k),
+                                      VID(i + 1, j, k + 1),
+                                      VID(i + 1, j + 1, k + 1),
+                                      VID(i + 1, j + 1, k)},
+                                     i < Cy - 1,
+                                     CID(i + 1, j, k),
+                                     2 /*YMAX*/));
+      // South face
+      cell->faces.push_back(MakeFace({VID(i, j, k),
+                                      VID(i, j + 1, k),
+                                      VID(i, j + 1, k + 1),
+                                      VID(i, j, k + 1)},
+                                     i > 0,
+                                     CID(i - 1, j, k),
+                                     3 /*YMIN*/));
+      // Top face
+      cell->faces.push_back(MakeFace({VID(i, j, k + 1),
+                                      VID(i, j + 1, k + 1),
+                                      VID(i + 1, j + 1, k + 1),
+                                      VID(i + 1, j, k + 1)},
+                                     k < Cz - 1,
+                                     CID(i, j, k + 1),
+                                     4 /*ZMAX*/));
+      // Bottom face
+      cell->faces.push_back(MakeFace({VID(i, j, k),
+                                      VID(i + 1, j, k),
+                                      VID(i + 1, j + 1, k),
+                                      VID(i, j + 1, k)},
+                                     k > 0,
+                                     CID(i, j, k - 1),
+                                     5 /*ZMIN*/));
+    }
+
+    slab->cells.push_back(std::move(cell));
+  } // for cid
+
+  slab->has_connectivity = true;
+
+  return slab;
+}
+
+} // namespace chi_mesh
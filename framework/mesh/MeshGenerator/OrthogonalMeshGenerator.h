@@ -16,6 +16,9 @@ protected:
   std::unique_ptr<UnpartitionedMesh> GenerateUnpartitionedMesh(
     std::unique_ptr<UnpartitionedMesh> input_umesh) override;
 
+  std::unique_ptr<UnpartitionedMeshSlab>
+  GenerateUnpartitionedMeshSlab() override;
+
   static std::unique_ptr<UnpartitionedMesh>
   CreateUnpartitioned1DOrthoMesh(const std::vector<double>& vertices);
 
@@ -97,5 +97,33 @@ int chiMeshHandlerExportMeshToExodus(lua_State* L)
   auto& grid = cur_hndlr.GetGrid();
   grid->ExportCellsToExodus(file_name, suppress_nodesets, suppress_sidesets);
 
+  return 0;
+}
+
+//###################################################################
+/**Exports the partitioned mesh to a binary checkpoint, one file per
+ * process named `<FileName>_<location_id>.cmesh`. With the same number of
+ * processes, the mesh can be reloaded with a
+ * chi_mesh.FromFileMeshGenerator with `filename = "<FileName>.cmesh"`,
+ * skipping all mesh preprocessing.
+\param FileName char Base name of the files to be used.
+\ingroup LuaMeshHandler
+*/
+int chiMeshHandlerExportMeshToCheckpoint(lua_State* L)
+{
+  //============================================= Check arguments
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+  if (num_args != 1)
+    LuaPostArgAmountError(fname, 1, num_args);
+
+  const std::string file_name = lua_tostring(L,1);
+
+  //============================================= Get current handler
+  auto& cur_hndlr = chi_mesh::GetCurrentHandler();
+
+  auto& grid = cur_hndlr.GetGrid();
+  grid->ExportCellsToCheckpoint(file_name);
+
   return 0;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "chi_lua.h"
 
 #include "../chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "chi_runtime.h"
 
 #include "chi_log.h"
@@ -11,9 +12,11 @@
 
 RegisterLuaFunctionAsIs(chiMeshHandlerCreate);
 RegisterLuaFunctionAsIs(chiMeshHandlerSetCurrent);
+RegisterLuaFunctionAsIs(chiMeshHandlerReorderLocalCells);
 RegisterLuaFunctionAsIs(chiMeshHandlerExportMeshToObj);
 RegisterLuaFunctionAsIs(chiMeshHandlerExportMeshToVTK);
 RegisterLuaFunctionAsIs(chiMeshHandlerExportMeshToExodus);
+RegisterLuaFunctionAsIs(chiMeshHandlerExportMeshToCheckpoint);
 
 //#############################################################################
 /** Creates a mesh handler and sets it as "current".
@@ -62,5 +65,31 @@ int chiMeshHandlerSetCurrent(lua_State *L)
   Chi::log.LogAllVerbose2()
     << "chiMeshHandlerSetCurrent: set to " << handle;
 
+  return 0;
+}
+
+//#############################################################################
+/** Renumbers the local cells of the current mesh to improve the memory
+ * locality of cell-wise data. Must be called before any solver is created
+ * on the mesh.
+
+\param Ordering char Either "none", "hilbert" (along a Hilbert curve through
+       the cell centroids) or "rcm" (reverse Cuthill-McKee on the local cell
+       graph).
+
+\ingroup LuaMeshHandler*/
+int chiMeshHandlerReorderLocalCells(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+  if (num_args != 1)
+    LuaPostArgAmountError(fname, 1, num_args);
+
+  LuaCheckStringValue(fname, L, 1);
+  const std::string ordering = lua_tostring(L, 1);
+
+  auto grid_ptr = chi_mesh::GetCurrentHandler().GetGrid();
+  grid_ptr->ReorderLocalCells(ordering);
+
   return 0;
 }
\ No newline at end of file
@@ -5,8 +5,10 @@
 
 int chiMeshHandlerCreate(lua_State *L);
 int chiMeshHandlerSetCurrent(lua_State *L);
+int chiMeshHandlerReorderLocalCells(lua_State* L);
 int chiMeshHandlerExportMeshToObj(lua_State* L);
 int chiMeshHandlerExportMeshToVTK(lua_State* L);
 int chiMeshHandlerExportMeshToExodus(lua_State* L);
+int chiMeshHandlerExportMeshToCheckpoint(lua_State* L);
 
 #endif //CHITECH_MESHHANDLER_LUA_H
@@ -19,6 +19,7 @@ AAH_AngleSet::AAH_AngleSet(
   std::vector<size_t>& angle_indices,
   std::map<uint64_t, std::shared_ptr<SweepBndry>>& sim_boundaries,
   int sweep_eager_limit,
+  bool use_persistent_requests,
   const chi::ChiMPICommunicatorSet& in_comm_set)
   : AngleSet(id,
              in_numgrps,
@@ -27,8 +28,12 @@ AAH_AngleSet::AAH_AngleSet(
              angle_indices,
              sim_boundaries,
              in_ref_subset),
-    async_comm_(
-      *in_fluds, num_grps, angle_indices.size(), sweep_eager_limit, in_comm_set)
+    async_comm_(*in_fluds,
+                num_grps,
+                angle_indices.size(),
+                sweep_eager_limit,
+                use_persistent_requests,
+                in_comm_set)
 {
 }
 
@@ -71,27 +76,43 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
   else if (status == Status::READY_TO_EXECUTE and
            permission == ExecutionPermission::EXECUTE)
   {
-    async_comm_.InitializeLocalAndDownstreamBuffers();
+    PrepareThreadedExecution();
 
     Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
     sweep_chunk.Sweep(*this); // Execute chunk
     Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
 
-    // Send outgoing psi and clear local and receive buffers
-    async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
-    async_comm_.ClearLocalAndReceiveBuffers();
-
-    // Update boundary readiness
-    for (auto& [bid, bndry] : ref_boundaries_)
-      bndry->UpdateAnglesReadyStatus(angles_, ref_group_subset_);
-
-    executed_ = true;
-    return AngleSetStatus::FINISHED;
+    return CompleteThreadedExecution();
   }
   else
     return AngleSetStatus::READY_TO_EXECUTE;
 }
 
+// ###################################################################
+/**Initializes the local and downstream buffers ahead of executing the
+ * sweep chunk.*/
+void AAH_AngleSet::PrepareThreadedExecution()
+{
+  async_comm_.InitializeLocalAndDownstreamBuffers();
+}
+
+// ###################################################################
+/**Sends outgoing psi, clears the local and receive buffers and updates
+ * the boundary readiness after the sweep chunk was executed.*/
+AngleSetStatus AAH_AngleSet::CompleteThreadedExecution()
+{
+  // Send outgoing psi and clear local and receive buffers
+  async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
+  async_comm_.ClearLocalAndReceiveBuffers();
+
+  // Update boundary readiness
+  for (auto& [bid, bndry] : ref_boundaries_)
+    bndry->UpdateAnglesReadyStatus(angles_, ref_group_subset_);
+
+  executed_ = true;
+  return AngleSetStatus::FINISHED;
+}
+
 // ###################################################################
 /***/
 AngleSetStatus AAH_AngleSet::FlushSendBuffers()
@@ -143,13 +164,14 @@ const double* AAH_AngleSet::PsiBndry(uint64_t bndry_map,
                                      size_t gs_ss_begin,
                                      bool surface_source_active)
 {
-  if (ref_boundaries_[bndry_map]->IsReflecting())
-    return ref_boundaries_[bndry_map]->HeterogeneousPsiIncoming(
+  if (ref_boundaries_.at(bndry_map)->IsReflecting())
+    return ref_boundaries_.at(bndry_map)->HeterogeneousPsiIncoming(
       cell_local_id, face_num, fi, angle_num, g, gs_ss_begin);
 
-  if (not surface_source_active) return ref_boundaries_[bndry_map]->ZeroFlux(g);
+  if (not surface_source_active)
+    return ref_boundaries_.at(bndry_map)->ZeroFlux(g);
 
-  return ref_boundaries_[bndry_map]->HeterogeneousPsiIncoming(
+  return ref_boundaries_.at(bndry_map)->HeterogeneousPsiIncoming(
     cell_local_id, face_num, fi, angle_num, g, gs_ss_begin);
 }
 
@@ -162,7 +184,7 @@ double* AAH_AngleSet::ReflectingPsiOutBoundBndry(uint64_t bndry_map,
                                                  unsigned int fi,
                                                  size_t gs_ss_begin)
 {
-  return ref_boundaries_[bndry_map]->HeterogeneousPsiOutgoing(
+  return ref_boundaries_.at(bndry_map)->HeterogeneousPsiOutgoing(
     cell_local_id, face_num, fi, angle_num, gs_ss_begin);
 }
 
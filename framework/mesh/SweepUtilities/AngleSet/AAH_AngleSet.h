@@ -19,6 +19,7 @@ public:
                std::vector<size_t>& angle_indices,
                std::map<uint64_t, std::shared_ptr<SweepBndry>>& sim_boundaries,
                int sweep_eager_limit,
+               bool use_persistent_requests,
                const chi::ChiMPICommunicatorSet& in_comm_set);
 
   void InitializeDelayedUpstreamData() override;
@@ -32,6 +33,11 @@ public:
     const std::vector<size_t>& timing_tags,
     ExecutionPermission permission) override;
   AngleSetStatus FlushSendBuffers() override;
+
+  bool SupportsThreadedExecution() const override { return true; }
+  void PrepareThreadedExecution() override;
+  AngleSetStatus CompleteThreadedExecution() override;
+
   void ResetSweepBuffers() override;
   bool ReceiveDelayedData() override;
 
@@ -55,9 +55,53 @@ std::map<uint64_t, AngleSet::SweepBndryPtr>& AngleSet::GetBoundaries()
 size_t AngleSet::GetNumGroups() const { return num_grps; }
 size_t AngleSet::GetNumAngles() const { return angles_.size(); }
 
+// ###################################################################
+/**Attaches sweep data derived from this angle set. The data is shared
+ * with the other angle sets it is attached to and lives as long as the
+ * last of them.*/
+void AngleSet::SetSweepData(
+  std::shared_ptr<const AngleSetSweepData> sweep_data)
+{
+  sweep_data_ = std::move(sweep_data);
+}
+
+// ###################################################################
+/**Returns the attached sweep data, or nullptr if none is attached.*/
+const AngleSetSweepData* AngleSet::GetSweepData() const
+{
+  return sweep_data_.get();
+}
+
 AsynchronousCommunicator* AngleSet::GetCommunicator()
 {
   ChiLogicalError("Method not implemented");
 }
 
+// ###################################################################
+/**Sets up the buffers required to execute the sweep chunk of an angle set
+ * that reported READY_TO_EXECUTE. Only called on the main thread.*/
+void AngleSet::PrepareThreadedExecution()
+{
+  ChiLogicalError("Method not implemented");
+}
+
+// ###################################################################
+/**Communicates the results of an executed sweep chunk and marks the angle
+ * set as executed. Only called on the main thread.*/
+AngleSetStatus AngleSet::CompleteThreadedExecution()
+{
+  ChiLogicalError("Method not implemented");
+}
+
+// ###################################################################
+/**Supplies the thread pool and the per-worker sweep chunks with which
+ * tasks are executed. The chunk with index `i` is used exclusively by the
+ * worker with id `i`.*/
+void AngleSet::SetTaskExecutionThreads(
+  chi::ThreadPool* thread_pool,
+  const std::vector<SweepChunk*>& worker_sweep_chunks)
+{
+  ChiLogicalError("Method not implemented");
+}
+
 } // namespace chi_mesh::sweep_management
\ No newline at end of file
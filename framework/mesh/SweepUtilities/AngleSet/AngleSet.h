@@ -12,9 +12,24 @@ typedef chi_mesh::sweep_management::SweepBoundary SweepBndry;
 
 #include <memory>
 
+namespace chi
+{
+class ThreadPool;
+}
+
 namespace chi_mesh::sweep_management
 {
 
+/**Base class for data that a sweep chunk derives once from an angle set
+ * and reuses for every sweep of it, e.g. AAH sweep plans. The data is
+ * immutable and can be shared by angle sets with the same SPDS and
+ * directions.*/
+class AngleSetSweepData
+{
+public:
+  virtual ~AngleSetSweepData() = default;
+};
+
 class AngleSet
 {
 public:
@@ -37,6 +52,9 @@ public:
   size_t GetNumGroups() const;
   size_t GetNumAngles() const;
 
+  void SetSweepData(std::shared_ptr<const AngleSetSweepData> sweep_data);
+  const AngleSetSweepData* GetSweepData() const;
+
 
   // Virtual methods
   virtual AsynchronousCommunicator* GetCommunicator();
@@ -51,6 +69,22 @@ public:
     const std::vector<size_t>& timing_tags,
     ExecutionPermission permission) = 0;
   virtual AngleSetStatus FlushSendBuffers() = 0;
+
+  /**Returns true if the angle set can have its sweep chunk executed on a
+   * worker thread, i.e., if the execution can be split into
+   * PrepareThreadedExecution, the chunk execution, and
+   * CompleteThreadedExecution.*/
+  virtual bool SupportsThreadedExecution() const { return false; }
+  virtual void PrepareThreadedExecution();
+  virtual AngleSetStatus CompleteThreadedExecution();
+
+  /**Returns true if the angle set can distribute the tasks of a single
+   * angle set execution (e.g. cells) over the threads of a pool.*/
+  virtual bool SupportsThreadedTaskExecution() const { return false; }
+  virtual void SetTaskExecutionThreads(
+    chi::ThreadPool* thread_pool,
+    const std::vector<SweepChunk*>& worker_sweep_chunks);
+
   virtual void ResetSweepBuffers() = 0;
   virtual bool ReceiveDelayedData() = 0;
 
@@ -79,6 +113,7 @@ protected:
   const std::vector<size_t> angles_;
   std::map<uint64_t, SweepBndryPtr>& ref_boundaries_;
   const size_t ref_group_subset_;
+  std::shared_ptr<const AngleSetSweepData> sweep_data_;
 
   bool executed_ = false;
 };
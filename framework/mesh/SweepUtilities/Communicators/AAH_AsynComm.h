@@ -31,6 +31,12 @@ private:
   bool data_initialized;
   bool upstream_data_initialized;
 
+  /**When true, the non-local angular fluxes are communicated with
+   * persistent requests bound to the FLUDS buffers. The requests are
+   * created on first use and only re-created when the buffers moved or the
+   * message tags changed.*/
+  const bool use_persistent_requests_;
+
   u_ll_int EAGER_LIMIT = 32000;
 
   std::vector<int> prelocI_message_count;
@@ -49,6 +55,12 @@ private:
   std::vector<std::vector<bool>> delayed_prelocI_message_received;
 
   std::vector<std::vector<MPI_Request>> deplocI_message_request;
+  std::vector<std::vector<MPI_Request>> prelocI_message_request;
+
+  std::vector<const void*> deplocI_bound_buffer;
+  std::vector<const void*> prelocI_bound_buffer;
+  int deplocI_bound_tag_base = -1;
+  int prelocI_bound_tag_base = -1;
 
 public:
   int max_num_mess;
@@ -57,7 +69,9 @@ public:
               size_t num_groups,
               size_t num_angles,
               int sweep_eager_limit,
+              bool use_persistent_requests,
               const chi::ChiMPICommunicatorSet& in_comm_set);
+  ~AAH_ASynchronousCommunicator() override;
   bool DoneSending() const;
   void InitializeDelayedUpstreamData();
   void InitializeLocalAndDownstreamBuffers();
@@ -70,6 +84,17 @@ public:
 
 protected:
   void BuildMessageStructure();
+
+  void* DeplocIMessageData(size_t deplocI,
+                           u_ll_int block_addr,
+                           MPI_Datatype& message_type);
+  void* PrelocIMessageData(size_t prelocI,
+                           u_ll_int block_addr,
+                           MPI_Datatype& message_type);
+
+  void BindPersistentSendRequests(int angle_set_num);
+  void BindPersistentReceiveRequests(int angle_set_num);
+  static void FreeRequests(std::vector<MPI_Request>& requests);
 };
 } // namespace chi_mesh::sweep_management
 #endif // CHI_AAH_ASYNCOMM_H
\ No newline at end of file
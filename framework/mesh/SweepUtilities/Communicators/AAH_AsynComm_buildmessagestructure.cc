@@ -18,6 +18,10 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
   const auto& spds =  fluds_.GetSPDS();
   auto& aah_fluds = dynamic_cast<AAH_FLUDS&>(fluds_);
 
+  // Delayed data is always double precision, see FLUDS::IsSinglePrecision
+  const u_ll_int bytes_per_unknown =
+    aah_fluds.IsSinglePrecision() ? sizeof(float) : sizeof(double);
+
   //============================================= Predecessor locations
   size_t num_dependencies = spds.GetLocationDependencies().size();
 
@@ -25,6 +29,8 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
   prelocI_message_size.resize(num_dependencies);
   prelocI_message_blockpos.resize(num_dependencies);
   prelocI_message_received.clear();
+  prelocI_message_request.clear();
+  prelocI_bound_buffer.clear();
 
   for (int prelocI=0; prelocI<num_dependencies; prelocI++)
   {
@@ -33,14 +39,15 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
 
     u_ll_int message_size;
     int      message_count;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*bytes_per_unknown)<=EAGER_LIMIT)
     {
       message_count = static_cast<int>(num_angles_);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)(num_unknowns*bytes_per_unknown)/
+                           (double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -61,6 +68,7 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
     }
 
     prelocI_message_received.emplace_back(message_count, false);
+    prelocI_message_request.emplace_back(message_count, MPI_REQUEST_NULL);
   }//for prelocI
 
   //============================================= Delayed Predecessor locations
@@ -117,6 +125,7 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
   deplocI_message_blockpos.resize(num_successors);
 
   deplocI_message_request.clear();
+  deplocI_bound_buffer.clear();
 
   for (int deplocI=0; deplocI<num_successors; deplocI++)
   {
@@ -125,14 +134,15 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
 
     u_ll_int message_size;
     int      message_count;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*bytes_per_unknown)<=EAGER_LIMIT)
     {
       message_count = static_cast<int>(num_angles_);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)(num_unknowns*bytes_per_unknown)/
+                           (double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -152,7 +162,7 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::BuildMessageStruc
       deplocI_message_size[deplocI].push_back(num_unknowns);
     }
 
-    deplocI_message_request.emplace_back(message_count,MPI_Request());
+    deplocI_message_request.emplace_back(message_count,MPI_REQUEST_NULL);
   }
 
   //================================================== All reduce to get
@@ -3,6 +3,10 @@
 #include "mesh/SweepUtilities/AngleSet/AngleSet.h"
 #include "mesh/SweepUtilities/SPDS/SPDS.h"
 
+#include "mpi/chi_mpi_commset.h"
+
+#include "chi_mpi.h"
+
 // ###################################################################
 /**Constructor.*/
 chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
@@ -10,10 +14,12 @@ chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
                                size_t num_groups,
                                size_t num_angles,
                                int sweep_eager_limit,
+                               bool use_persistent_requests,
                                const chi::ChiMPICommunicatorSet& in_comm_set)
   : AsynchronousCommunicator(fluds, in_comm_set),
     num_groups_(num_groups),
-    num_angles_(num_angles)
+    num_angles_(num_angles),
+    use_persistent_requests_(use_persistent_requests)
 {
   done_sending = false;
   data_initialized = false;
@@ -25,6 +31,22 @@ chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
   this->BuildMessageStructure();
 }
 
+// ###################################################################
+/**Destructor. Completes or cancels outstanding requests and frees the
+ * persistent requests.*/
+chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  ~AAH_ASynchronousCommunicator()
+{
+  int mpi_finalized = 0;
+  MPI_Finalized(&mpi_finalized);
+  if (mpi_finalized) return;
+
+  for (auto& requests : deplocI_message_request)
+    FreeRequests(requests);
+  for (auto& requests : prelocI_message_request)
+    FreeRequests(requests);
+}
+
 // ###################################################################
 /**Returns the private flag done_sending.*/
 bool chi_mesh::sweep_management::AAH_ASynchronousCommunicator::DoneSending()
@@ -39,7 +61,10 @@ bool chi_mesh::sweep_management::AAH_ASynchronousCommunicator::DoneSending()
 void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
   ClearLocalAndReceiveBuffers()
 {
-  fluds_.ClearLocalAndReceivePsi();
+  // Persistent requests are bound to the receive buffers
+  if (use_persistent_requests_) fluds_.ClearLocalPsi();
+  else
+    fluds_.ClearLocalAndReceivePsi();
 }
 
 // ###################################################################
@@ -62,7 +87,8 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
       }
     }
 
-  if (done_sending) fluds_.ClearSendPsi();
+  // Persistent requests are bound to the send buffers
+  if (done_sending and not use_persistent_requests_) fluds_.ClearSendPsi();
 }
 
 // ###################################################################
@@ -78,4 +104,156 @@ void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::Reset()
 
   for (auto& message_flags : delayed_prelocI_message_received)
     message_flags.assign(message_flags.size(), false);
-}
\ No newline at end of file
+}
+
+// ###################################################################
+/**Returns the address of unknown `block_addr` of the outgoing buffer of
+ * the given successor location and sets the MPI datatype of the
+ * unknowns.*/
+void* chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  DeplocIMessageData(size_t deplocI,
+                     u_ll_int block_addr,
+                     MPI_Datatype& message_type)
+{
+  if (fluds_.IsSinglePrecision())
+  {
+    message_type = MPI_FLOAT;
+    return fluds_.DeplocIOutgoingPsiSingle()[deplocI].data() + block_addr;
+  }
+
+  message_type = MPI_DOUBLE;
+  return fluds_.DeplocIOutgoingPsi()[deplocI].data() + block_addr;
+}
+
+// ###################################################################
+/**Returns the address of unknown `block_addr` of the incoming buffer of
+ * the given predecessor location and sets the MPI datatype of the
+ * unknowns.*/
+void* chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  PrelocIMessageData(size_t prelocI,
+                     u_ll_int block_addr,
+                     MPI_Datatype& message_type)
+{
+  if (fluds_.IsSinglePrecision())
+  {
+    message_type = MPI_FLOAT;
+    return fluds_.PrelocIOutgoingPsiSingle()[prelocI].data() + block_addr;
+  }
+
+  message_type = MPI_DOUBLE;
+  return fluds_.PrelocIOutgoingPsi()[prelocI].data() + block_addr;
+}
+
+// ###################################################################
+/**Creates the persistent send requests of all the successor messages.
+ * Requests that are bound to the current outgoing buffers, with the
+ * current tags, are kept.*/
+void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  BindPersistentSendRequests(int angle_set_num)
+{
+  const auto& location_successors = fluds_.GetSPDS().GetLocationSuccessors();
+  const int tag_base = max_num_mess * angle_set_num;
+
+  const size_t num_successors = location_successors.size();
+  deplocI_bound_buffer.resize(num_successors, nullptr);
+  for (size_t deplocI = 0; deplocI < num_successors; ++deplocI)
+  {
+    MPI_Datatype message_type;
+    const void* buffer = DeplocIMessageData(deplocI, 0, message_type);
+    if (buffer == deplocI_bound_buffer[deplocI] and
+        tag_base == deplocI_bound_tag_base)
+      continue;
+
+    const int locJ = location_successors[deplocI];
+    auto& requests = deplocI_message_request[deplocI];
+    FreeRequests(requests);
+
+    const int num_mess = deplocI_message_count[deplocI];
+    for (int m = 0; m < num_mess; ++m)
+    {
+      const u_ll_int block_addr = deplocI_message_blockpos[deplocI][m];
+      const u_ll_int message_size = deplocI_message_size[deplocI][m];
+
+      MPI_Send_init(DeplocIMessageData(deplocI, block_addr, message_type),
+                    static_cast<int>(message_size),
+                    message_type,
+                    comm_set_.MapIonJ(locJ, locJ),
+                    tag_base + m, // tag
+                    comm_set_.LocICommunicator(locJ),
+                    &requests[m]);
+    }
+    deplocI_bound_buffer[deplocI] = buffer;
+  } // for deplocI
+
+  deplocI_bound_tag_base = tag_base;
+}
+
+// ###################################################################
+/**Creates the persistent receive requests of all the predecessor
+ * messages. Requests that are bound to the current incoming buffers, with
+ * the current tags, are kept.*/
+void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
+  BindPersistentReceiveRequests(int angle_set_num)
+{
+  const auto& location_dependencies =
+    fluds_.GetSPDS().GetLocationDependencies();
+  const int tag_base = max_num_mess * angle_set_num;
+
+  const size_t num_dependencies = location_dependencies.size();
+  prelocI_bound_buffer.resize(num_dependencies, nullptr);
+  for (size_t prelocI = 0; prelocI < num_dependencies; ++prelocI)
+  {
+    MPI_Datatype message_type;
+    const void* buffer = PrelocIMessageData(prelocI, 0, message_type);
+    if (buffer == prelocI_bound_buffer[prelocI] and
+        tag_base == prelocI_bound_tag_base)
+      continue;
+
+    const int locJ = location_dependencies[prelocI];
+    auto& requests = prelocI_message_request[prelocI];
+    FreeRequests(requests);
+
+    const int num_mess = prelocI_message_count[prelocI];
+    for (int m = 0; m < num_mess; ++m)
+    {
+      const u_ll_int block_addr = prelocI_message_blockpos[prelocI][m];
+      const u_ll_int message_size = prelocI_message_size[prelocI][m];
+
+      MPI_Recv_init(PrelocIMessageData(prelocI, block_addr, message_type),
+                    static_cast<int>(message_size),
+                    message_type,
+                    comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
+                    tag_base + m, // tag
+                    comm_set_.LocICommunicator(Chi::mpi.location_id),
+                    &requests[m]);
+    }
+    prelocI_bound_buffer[prelocI] = buffer;
+  } // for prelocI
+
+  prelocI_bound_tag_base = tag_base;
+}
+
+// ###################################################################
+/**Frees the given requests and sets them to MPI_REQUEST_NULL. Requests
+ * that are still active are cancelled and completed first, so that no
+ * buffer is left attached to a pending operation.*/
+void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::FreeRequests(
+  std::vector<MPI_Request>& requests)
+{
+  for (auto& request : requests)
+  {
+    if (request == MPI_REQUEST_NULL) continue;
+
+    // Inactive persistent requests test as complete
+    int completed = 0;
+    MPI_Test(&request, &completed, MPI_STATUS_IGNORE);
+    if (not completed)
+    {
+      MPI_Cancel(&request);
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+    }
+
+    // Completed non-persistent requests are already MPI_REQUEST_NULL
+    if (request != MPI_REQUEST_NULL) MPI_Request_free(&request);
+  }
+}
@@ -23,6 +23,16 @@ chi_mesh::sweep_management::AAH_ASynchronousCommunicator::ReceiveUpstreamPsi(int
     fluds_.AllocatePrelocIOutgoingPsi(
       num_groups_, num_angles_, num_loc_deps);
 
+    //============================ Persistent receives are posted once per
+    //                               sweep
+    if (use_persistent_requests_)
+    {
+      BindPersistentReceiveRequests(angle_set_num);
+      for (auto& requests : prelocI_message_request)
+        if (not requests.empty())
+          MPI_Startall(static_cast<int>(requests.size()), requests.data());
+    }
+
     upstream_data_initialized = true;
   }
 
@@ -36,7 +46,18 @@ chi_mesh::sweep_management::AAH_ASynchronousCommunicator::ReceiveUpstreamPsi(int
     size_t num_mess = prelocI_message_count[prelocI];
     for (int m = 0; m < num_mess; m++)
     {
-      if (!prelocI_message_received[prelocI][m])
+      if (!prelocI_message_received[prelocI][m] and use_persistent_requests_)
+      {
+        int message_received = 0;
+        MPI_Test(&prelocI_message_request[prelocI][m],
+                 &message_received,
+                 MPI_STATUS_IGNORE);
+
+        if (not message_received) ready_to_execute = false;
+        else
+          prelocI_message_received[prelocI][m] = true;
+      }
+      else if (!prelocI_message_received[prelocI][m])
       {
         int message_available = 0;
         MPI_Iprobe(comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
@@ -52,15 +73,17 @@ chi_mesh::sweep_management::AAH_ASynchronousCommunicator::ReceiveUpstreamPsi(int
         } // if message is not available
 
         //============================ Receive upstream data
-        auto& upstream_psi = fluds_.PrelocIOutgoingPsi()[prelocI];
-
         u_ll_int block_addr = prelocI_message_blockpos[prelocI][m];
         u_ll_int message_size = prelocI_message_size[prelocI][m];
 
+        MPI_Datatype message_type;
+        void* message_data =
+          PrelocIMessageData(prelocI, block_addr, message_type);
+
         int error_code =
-          MPI_Recv(&upstream_psi[block_addr],
+          MPI_Recv(message_data,
                    static_cast<int>(message_size),
-                   MPI_DOUBLE,
+                   message_type,
                    comm_set_.MapIonJ(locJ, Chi::mpi.location_id),
                    max_num_mess * angle_set_num + m, // tag
                    comm_set_.LocICommunicator(Chi::mpi.location_id),
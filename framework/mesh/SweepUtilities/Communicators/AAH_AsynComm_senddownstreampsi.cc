@@ -11,6 +11,17 @@
 void chi_mesh::sweep_management::AAH_ASynchronousCommunicator::
 SendDownstreamPsi(int angle_set_num)
 {
+  //============================ Persistent requests are bound to the
+  //                               outgoing buffers and only restarted
+  if (use_persistent_requests_)
+  {
+    BindPersistentSendRequests(angle_set_num);
+    for (auto& requests : deplocI_message_request)
+      if (not requests.empty())
+        MPI_Startall(static_cast<int>(requests.size()), requests.data());
+    return;
+  }
+
   const auto& spds = fluds_.GetSPDS();
 
   const auto& location_successors = spds.GetLocationSuccessors();
@@ -26,11 +37,13 @@ SendDownstreamPsi(int angle_set_num)
       u_ll_int block_addr   = deplocI_message_blockpos[deplocI][m];
       u_ll_int message_size = deplocI_message_size[deplocI][m];
 
-      const auto& outgoing_psi = fluds_.DeplocIOutgoingPsi()[deplocI];
+      MPI_Datatype message_type;
+      void* message_data =
+        DeplocIMessageData(deplocI, block_addr, message_type);
 
-      MPI_Isend(&outgoing_psi[block_addr],
+      MPI_Isend(message_data,
                 static_cast<int>(message_size),
-                MPI_DOUBLE,
+                message_type,
                 comm_set_.MapIonJ(locJ,locJ),
                 max_num_mess*angle_set_num + m, //tag
                 comm_set_.LocICommunicator(locJ),
@@ -11,12 +11,9 @@ AsynchronousCommunicator::AsynchronousCommunicator(
 {
 }
 
-std::vector<double>&
-AsynchronousCommunicator::InitGetDownwindMessageData(int location_id,
-                                                 uint64_t cell_global_id,
-                                                 unsigned int face_id,
-                                                 size_t angle_set_id,
-                                                 size_t data_size)
+double*
+AsynchronousCommunicator::InitGetDownwindMessageData(uint64_t cell_local_id,
+                                                     unsigned int face_id)
 {
   ChiLogicalError("Method not implemented");
 }
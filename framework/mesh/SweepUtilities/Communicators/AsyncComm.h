@@ -22,14 +22,10 @@ public:
                                     const chi::ChiMPICommunicatorSet& comm_set);
   virtual ~AsynchronousCommunicator() = default;
 
-  /**Obtains a data vector holding a spot into which outgoing data can be
-   * written.*/
-  virtual std::vector<double>&
-  InitGetDownwindMessageData(int location_id,
-                                                      uint64_t cell_global_id,
-                                                      unsigned int face_id,
-                                                      size_t angle_set_id,
-                                                      size_t data_size);
+  /**Obtains the storage into which the outgoing data of a non-local face
+   * of a local cell can be written and queues the data for sending.*/
+  virtual double* InitGetDownwindMessageData(uint64_t cell_local_id,
+                                             unsigned int face_id);
 
 protected:
   FLUDS& fluds_;
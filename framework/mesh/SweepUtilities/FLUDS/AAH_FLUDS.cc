@@ -14,10 +14,13 @@ namespace chi_mesh::sweep_management
  * primary FLUDS.*/
 AAH_FLUDS::AAH_FLUDS(size_t num_groups,
                      size_t num_angles,
-                     const AAH_FLUDSCommonData& common_data)
+                     const AAH_FLUDSCommonData& common_data,
+                     bool single_precision)
   : FLUDS(num_groups, num_angles, common_data.GetSPDS()),
     common_data_(common_data)
 {
+  single_precision_ = single_precision;
+
   //============================== Adjusting for different group aggregate
   for (auto& val : common_data_.local_psi_n_block_stride)
     local_psi_Gn_block_strideG.push_back(val * num_groups_);
@@ -29,12 +32,11 @@ AAH_FLUDS::AAH_FLUDS(size_t num_groups,
 // ###################################################################
 /**Given a sweep ordering index, the outgoing face counter,
  * the outgoing face dof, this function computes the location
- * of this position's upwind psi in the local upwind psi vector
- * and returns a reference to it.*/
-double* AAH_FLUDS::OutgoingPsi(int cell_so_index,
-                               int outb_face_counter,
-                               int face_dof,
-                               int n)
+ * of this position's upwind psi in the local upwind psi vector.*/
+AAH_FLUDS::PsiIndex AAH_FLUDS::OutgoingPsiIndex(int cell_so_index,
+                                                int outb_face_counter,
+                                                int face_dof,
+                                                int n) const
 {
   // Face category
   int fc = common_data_
@@ -49,7 +51,7 @@ double* AAH_FLUDS::OutgoingPsi(int cell_so_index,
         common_data_.local_psi_stride[fc] * num_groups_ +
       face_dof * num_groups_;
 
-    return &local_psi_[fc][index];
+    return {fc, index, false};
   }
   else
   {
@@ -60,14 +62,15 @@ double* AAH_FLUDS::OutgoingPsi(int cell_so_index,
         common_data_.delayed_local_psi_stride * num_groups_ +
       face_dof * num_groups_;
 
-    return &delayed_local_psi_[index];
+    return {fc, index, true};
   }
 }
 
 // ###################################################################
-/**Given a outbound face counter this method returns a pointer
- * to the location*/
-double* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
+/**Given a outbound face counter this method computes the location
+ * in the non-local outgoing psi vectors.*/
+AAH_FLUDS::PsiIndex
+AAH_FLUDS::NLOutgoingPsiIndex(int outb_face_counter, int face_dof, int n) const
 {
   if (outb_face_counter > common_data_.nonlocal_outb_face_deplocI_slot.size())
   {
@@ -87,25 +90,26 @@ double* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
   int index = nonlocal_psi_Gn_blockstride * num_groups_ * n +
               slot * num_groups_ + face_dof * num_groups_;
 
-  if ((index < 0) || (index > deplocI_outgoing_psi_[depLocI].size()))
+  const size_t buffer_size =
+    single_precision_ ? deplocI_outgoing_psi_single_[depLocI].size()
+                      : deplocI_outgoing_psi_[depLocI].size();
+  if ((index < 0) || (index > buffer_size))
   {
     Chi::log.LogAllError() << "Invalid index " << index
                            << " encountered in non-local outgoing Psi"
-                           << " max allowed "
-                           << deplocI_outgoing_psi_[depLocI].size();
+                           << " max allowed " << buffer_size;
     Chi::Exit(EXIT_FAILURE);
   }
 
-  return &deplocI_outgoing_psi_[depLocI][index];
+  return {depLocI, static_cast<size_t>(index), false};
 }
 
 // ###################################################################
 /**Given a sweep ordering index, the incoming face counter,
  * the incoming face dof, this function computes the location
- * where to store this position's outgoing psi and returns a reference
- * to it.*/
-double* AAH_FLUDS::UpwindPsi(
-  int cell_so_index, int inc_face_counter, int face_dof, int g, int n)
+ * where to store this position's outgoing psi.*/
+AAH_FLUDS::PsiIndex AAH_FLUDS::UpwindPsiIndex(
+  int cell_so_index, int inc_face_counter, int face_dof, int g, int n) const
 {
   // Face category
   int fc = common_data_
@@ -125,7 +129,7 @@ double* AAH_FLUDS::UpwindPsi(
         num_groups_ +
       g;
 
-    return &local_psi_[fc][index];
+    return {fc, index, false};
   }
   else
   {
@@ -141,7 +145,7 @@ double* AAH_FLUDS::UpwindPsi(
         num_groups_ +
       g;
 
-    return &delayed_local_psi_old_[index];
+    return {fc, index, true};
   }
 }
 
@@ -149,8 +153,10 @@ double* AAH_FLUDS::UpwindPsi(
 /**Given a sweep ordering index, the incoming face counter,
  * the incoming face dof, this function computes the location
  * where to obtain the position's upwind psi.*/
-double*
-AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
+AAH_FLUDS::PsiIndex AAH_FLUDS::NLUpwindPsiIndex(int nonl_inc_face_counter,
+                                                int face_dof,
+                                                int g,
+                                                int n) const
 {
   int prelocI =
     common_data_.nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter]
@@ -171,7 +177,7 @@ AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
     int index = nonlocal_psi_Gn_blockstride * num_groups_ * n +
                 slot * num_groups_ + mapped_dof * num_groups_ + g;
 
-    return &prelocI_outgoing_psi_[prelocI][index];
+    return {prelocI, static_cast<size_t>(index), false};
   }
   else
   {
@@ -195,10 +201,111 @@ AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
     int index = nonlocal_psi_Gn_blockstride * num_groups_ * n +
                 slot * num_groups_ + mapped_dof * num_groups_ + g;
 
-    return &delayed_prelocI_outgoing_psi_old_[prelocI][index];
+    return {prelocI, static_cast<size_t>(index), true};
   }
 }
 
+// ###################################################################
+/**Returns a pointer to the outgoing psi of a face dof.*/
+double* AAH_FLUDS::OutgoingPsi(int cell_so_index,
+                               int outb_face_counter,
+                               int face_dof,
+                               int n)
+{
+  const auto loc =
+    OutgoingPsiIndex(cell_so_index, outb_face_counter, face_dof, n);
+
+  if (not loc.delayed) return &local_psi_[loc.buffer][loc.index];
+  else
+    return &delayed_local_psi_[loc.index];
+}
+
+// ###################################################################
+/**Returns a pointer to the non-local outgoing psi of a face dof.*/
+double* AAH_FLUDS::NLOutgoingPsi(int outb_face_counter, int face_dof, int n)
+{
+  const auto loc = NLOutgoingPsiIndex(outb_face_counter, face_dof, n);
+
+  return &deplocI_outgoing_psi_[loc.buffer][loc.index];
+}
+
+// ###################################################################
+/**Returns a pointer to the local upwind psi of a face dof.*/
+double* AAH_FLUDS::UpwindPsi(
+  int cell_so_index, int inc_face_counter, int face_dof, int g, int n)
+{
+  const auto loc =
+    UpwindPsiIndex(cell_so_index, inc_face_counter, face_dof, g, n);
+
+  if (not loc.delayed) return &local_psi_[loc.buffer][loc.index];
+  else
+    return &delayed_local_psi_old_[loc.index];
+}
+
+// ###################################################################
+/**Returns a pointer to the non-local upwind psi of a face dof.*/
+double*
+AAH_FLUDS::NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n)
+{
+  const auto loc = NLUpwindPsiIndex(nonl_inc_face_counter, face_dof, g, n);
+
+  if (not loc.delayed) return &prelocI_outgoing_psi_[loc.buffer][loc.index];
+  else
+    return &delayed_prelocI_outgoing_psi_old_[loc.buffer][loc.index];
+}
+
+// ###################################################################
+/**Single precision version of OutgoingPsi. Returns nullptr for delayed
+ * data.*/
+float* AAH_FLUDS::OutgoingPsiSingle(int cell_so_index,
+                                    int outb_face_counter,
+                                    int face_dof,
+                                    int n)
+{
+  const auto loc =
+    OutgoingPsiIndex(cell_so_index, outb_face_counter, face_dof, n);
+
+  if (loc.delayed) return nullptr;
+  return &local_psi_single_[loc.buffer][loc.index];
+}
+
+// ###################################################################
+/**Single precision version of NLOutgoingPsi.*/
+float*
+AAH_FLUDS::NLOutgoingPsiSingle(int outb_face_counter, int face_dof, int n)
+{
+  const auto loc = NLOutgoingPsiIndex(outb_face_counter, face_dof, n);
+
+  return &deplocI_outgoing_psi_single_[loc.buffer][loc.index];
+}
+
+// ###################################################################
+/**Single precision version of UpwindPsi. Returns nullptr for delayed
+ * data.*/
+float* AAH_FLUDS::UpwindPsiSingle(
+  int cell_so_index, int inc_face_counter, int face_dof, int g, int n)
+{
+  const auto loc =
+    UpwindPsiIndex(cell_so_index, inc_face_counter, face_dof, g, n);
+
+  if (loc.delayed) return nullptr;
+  return &local_psi_single_[loc.buffer][loc.index];
+}
+
+// ###################################################################
+/**Single precision version of NLUpwindPsi. Returns nullptr for delayed
+ * data.*/
+float* AAH_FLUDS::NLUpwindPsiSingle(int nonl_inc_face_counter,
+                                    int face_dof,
+                                    int g,
+                                    int n)
+{
+  const auto loc = NLUpwindPsiIndex(nonl_inc_face_counter, face_dof, g, n);
+
+  if (loc.delayed) return nullptr;
+  return &prelocI_outgoing_psi_single_[loc.buffer][loc.index];
+}
+
 size_t AAH_FLUDS::GetPrelocIFaceDOFCount(int prelocI) const
 {
   return common_data_.prelocI_face_dof_count[prelocI];
@@ -219,12 +326,43 @@ void AAH_FLUDS::ClearLocalAndReceivePsi()
 
   empty_vector = std::vector<std::vector<double>>(0);
   prelocI_outgoing_psi_.swap(empty_vector);
+
+  auto empty_single_vector = std::vector<std::vector<float>>(0);
+  local_psi_single_.swap(empty_single_vector);
+
+  empty_single_vector = std::vector<std::vector<float>>(0);
+  prelocI_outgoing_psi_single_.swap(empty_single_vector);
+}
+
+void AAH_FLUDS::ClearLocalPsi()
+{
+  auto empty_vector = std::vector<std::vector<double>>(0);
+  local_psi_.swap(empty_vector);
+
+  auto empty_single_vector = std::vector<std::vector<float>>(0);
+  local_psi_single_.swap(empty_single_vector);
 }
 
-void AAH_FLUDS::ClearSendPsi() { deplocI_outgoing_psi_.clear(); }
+void AAH_FLUDS::ClearSendPsi()
+{
+  deplocI_outgoing_psi_.clear();
+  deplocI_outgoing_psi_single_.clear();
+}
 
 void AAH_FLUDS::AllocateInternalLocalPsi(size_t num_grps, size_t num_angles)
 {
+  if (single_precision_)
+  {
+    local_psi_single_.resize(common_data_.num_face_categories);
+    // fc = face category
+    for (size_t fc = 0; fc < common_data_.num_face_categories; fc++)
+      local_psi_single_[fc].resize(common_data_.local_psi_stride[fc] *
+                                     common_data_.local_psi_max_elements[fc] *
+                                     num_grps * num_angles,
+                                   0.0f);
+    return;
+  }
+
   local_psi_.resize(common_data_.num_face_categories);
   // fc = face category
   for (size_t fc = 0; fc < common_data_.num_face_categories; fc++)
@@ -240,6 +378,16 @@ void AAH_FLUDS::AllocateOutgoingPsi(size_t num_grps,
                                     size_t num_angles,
                                     size_t num_loc_sucs)
 {
+  if (single_precision_)
+  {
+    deplocI_outgoing_psi_single_.resize(num_loc_sucs, std::vector<float>());
+    for (size_t deplocI = 0; deplocI < num_loc_sucs; deplocI++)
+      deplocI_outgoing_psi_single_[deplocI].resize(
+        common_data_.deplocI_face_dof_count[deplocI] * num_grps * num_angles,
+        0.0f);
+    return;
+  }
+
   deplocI_outgoing_psi_.resize(num_loc_sucs, std::vector<double>());
   for (size_t deplocI = 0; deplocI < num_loc_sucs; deplocI++)
   {
@@ -266,6 +414,16 @@ void AAH_FLUDS::AllocatePrelocIOutgoingPsi(size_t num_grps,
                                            size_t num_angles,
                                            size_t num_loc_deps)
 {
+  if (single_precision_)
+  {
+    prelocI_outgoing_psi_single_.resize(num_loc_deps, std::vector<float>());
+    for (size_t prelocI = 0; prelocI < num_loc_deps; prelocI++)
+      prelocI_outgoing_psi_single_[prelocI].resize(
+        common_data_.prelocI_face_dof_count[prelocI] * num_grps * num_angles,
+        0.0f);
+    return;
+  }
+
   prelocI_outgoing_psi_.resize(num_loc_deps, std::vector<double>());
   for (size_t prelocI = 0; prelocI < num_loc_deps; prelocI++)
   {
@@ -322,4 +480,14 @@ std::vector<std::vector<double>>& AAH_FLUDS::DelayedPrelocIOutgoingPsiOld()
   return delayed_prelocI_outgoing_psi_old_;
 }
 
+std::vector<std::vector<float>>& AAH_FLUDS::DeplocIOutgoingPsiSingle()
+{
+  return deplocI_outgoing_psi_single_;
+}
+
+std::vector<std::vector<float>>& AAH_FLUDS::PrelocIOutgoingPsiSingle()
+{
+  return prelocI_outgoing_psi_single_;
+}
+
 } // namespace chi_mesh::sweep_management
\ No newline at end of file
@@ -14,9 +14,19 @@ class AAH_FLUDS : public FLUDS
 public:
   AAH_FLUDS(size_t num_groups,
             size_t num_angles,
-            const AAH_FLUDSCommonData& common_data);
+            const AAH_FLUDSCommonData& common_data,
+            bool single_precision = false);
 
 private:
+  /**Location of a face dof's angular fluxes. `buffer` is the face category
+   * for local data and the location index for non-local data.*/
+  struct PsiIndex
+  {
+    int buffer = 0;
+    size_t index = 0;
+    bool delayed = false;
+  };
+
   const AAH_FLUDSCommonData& common_data_;
 
   // local_psi_n_block_stride[fc]. Given face category fc, the value is
@@ -36,7 +46,24 @@ private:
   std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_;
   std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_old_;
 
+  std::vector<std::vector<float>> local_psi_single_;
+  std::vector<std::vector<float>> deplocI_outgoing_psi_single_;
+  std::vector<std::vector<float>> prelocI_outgoing_psi_single_;
+
+  PsiIndex OutgoingPsiIndex(int cell_so_index,
+                            int outb_face_counter,
+                            int face_dof,
+                            int n) const;
+  PsiIndex UpwindPsiIndex(
+    int cell_so_index, int inc_face_counter, int face_dof, int g, int n) const;
+  PsiIndex NLOutgoingPsiIndex(int outb_face_count, int face_dof, int n) const;
+  PsiIndex
+  NLUpwindPsiIndex(int nonl_inc_face_counter, int face_dof, int g, int n) const;
+
 public:
+  /**When the FLUDS stores psi in single precision, the double precision
+   * accessors below are only valid for delayed data, i.e., when the
+   * corresponding single precision accessor returns nullptr.*/
   double* OutgoingPsi(int cell_so_index,
                       int outb_face_counter,
                       int face_dof,
@@ -52,11 +79,24 @@ public:
   double*
   NLUpwindPsi(int nonl_inc_face_counter, int face_dof, int g, int n);
 
+  /**Single precision accessors. These return nullptr for data that is
+   * held in the (double precision) delayed buffers.*/
+  float* OutgoingPsiSingle(int cell_so_index,
+                           int outb_face_counter,
+                           int face_dof,
+                           int n);
+  float* UpwindPsiSingle(
+    int cell_so_index, int inc_face_counter, int face_dof, int g, int n);
+  float* NLOutgoingPsiSingle(int outb_face_count, int face_dof, int n);
+  float*
+  NLUpwindPsiSingle(int nonl_inc_face_counter, int face_dof, int g, int n);
+
   size_t GetPrelocIFaceDOFCount(int prelocI) const;
   size_t GetDelayedPrelocIFaceDOFCount(int prelocI) const;
   size_t GetDeplocIFaceDOFCount(int deplocI) const;
 
   void ClearLocalAndReceivePsi() override;
+  void ClearLocalPsi() override;
   void ClearSendPsi() override;
   void AllocateInternalLocalPsi(size_t num_grps, size_t num_angles) override;
   void AllocateOutgoingPsi(size_t num_grps,
@@ -80,6 +120,9 @@ public:
 
   std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() override;
   std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() override;
+
+  std::vector<std::vector<float>>& DeplocIOutgoingPsiSingle() override;
+  std::vector<std::vector<float>>& PrelocIOutgoingPsiSingle() override;
 };
 
 } // namespace chi_mesh::sweep_management
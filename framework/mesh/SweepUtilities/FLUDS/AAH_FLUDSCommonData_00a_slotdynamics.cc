@@ -20,6 +20,7 @@ void AAH_FLUDSCommonData::SlotDynamics(
   std::set<int>& location_boundary_dependency_set)
 {
   const chi_mesh::MeshContinuum& grid = spds.Grid();
+  const auto& face_associations = grid.FaceAssociations();
 
   chi_mesh::Vector3 ihat(1.0, 0.0, 0.0);
   chi_mesh::Vector3 jhat(0.0, 1.0, 0.0);
@@ -40,7 +41,7 @@ void AAH_FLUDSCommonData::SlotDynamics(
     {
 
       //$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ LOCAL CELL DEPENDENCE
-      if (face.IsNeighborLocal(grid))
+      if (face_associations.NeighborIsLocal(cell.local_id_, f))
       {
         size_t num_face_dofs = face.vertex_ids_.size();
         size_t face_categ = grid_face_histogram.MapFaceHistogramBins(num_face_dofs);
@@ -57,7 +58,7 @@ void AAH_FLUDSCommonData::SlotDynamics(
           int a = cyclic_dependency.first;
           int b = cyclic_dependency.second;
           int c = cell.local_id_;
-          int d = face.GetNeighborLocalID(grid);
+          int d = face_associations.NeighborLocalID(cell.local_id_, f);
 
           if ((a == c) && (b == d) )
           {
@@ -77,7 +78,8 @@ void AAH_FLUDSCommonData::SlotDynamics(
 
         //======================================== Find associated face for
         //                                         dof mapping and lock box
-        auto ass_face = (short)face.GetNeighborAssociatedFace(grid);
+        auto ass_face =
+          (short)face_associations.AssociatedFace(cell.local_id_, f);
 
         //Now find the cell (index,face) pair in the lock box and empty slot
         bool found = false;
@@ -100,7 +102,7 @@ void AAH_FLUDSCommonData::SlotDynamics(
             << cell.local_id_
             << " face " << f
             << " looking for cell "
-            << face.GetNeighborLocalID(grid)
+            << face_associations.NeighborLocalID(cell.local_id_, f)
             << " face " << ass_face
             << " cat: " << face_categ
             << " omg=" << spds.Omega().PrintS()
@@ -163,14 +165,14 @@ void AAH_FLUDSCommonData::SlotDynamics(
 
       //========================================== Check if part of cyclic
       //                                           dependency
-      if (face.IsNeighborLocal(grid))
+      if (face_associations.NeighborIsLocal(cell.local_id_, f))
       {
         for (auto cyclic_dependency : spds.GetLocalCyclicDependencies())
         {
           int a = cyclic_dependency.first;
           int b = cyclic_dependency.second;
           int c = cell.local_id_;
-          int d = face.GetNeighborLocalID(grid);
+          int d = face_associations.NeighborLocalID(cell.local_id_, f);
 
           if ((a == c) && (b == d) )
           {
@@ -219,7 +221,8 @@ void AAH_FLUDSCommonData::SlotDynamics(
       }
 
       //========================================== Non-local outgoing
-      if (face.has_neighbor_ and (not face.IsNeighborLocal(grid)))
+      if (face.has_neighbor_ and
+          (not face_associations.NeighborIsLocal(cell.local_id_, f)))
       {
         int locJ         = face.GetNeighborPartitionID(grid);
         int deplocI      = spds.MapLocJToDeplocI(locJ);
@@ -30,7 +30,16 @@ public:
 
   const SPDS& GetSPDS() const { return spds_; }
 
+  /**Returns true if the local and non-local (non-delayed) face angular
+   * fluxes are stored in single precision. The delayed data is always
+   * stored in double precision since it is part of the iterative solution
+   * vector.*/
+  bool IsSinglePrecision() const { return single_precision_; }
+
   virtual void ClearLocalAndReceivePsi() {}
+  /**Clears only the local psi, keeping the non-local buffers allocated,
+   * e.g. because persistent MPI requests are bound to them.*/
+  virtual void ClearLocalPsi() {}
   virtual void ClearSendPsi() {}
   virtual void AllocateInternalLocalPsi(size_t num_grps, size_t num_angles) {}
   virtual void
@@ -61,6 +70,11 @@ public:
 
   virtual std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() = 0;
 
+  /**Single precision counterparts of DeplocIOutgoingPsi and
+   * PrelocIOutgoingPsi, used when IsSinglePrecision is true.*/
+  virtual std::vector<std::vector<float>>& DeplocIOutgoingPsiSingle() = 0;
+  virtual std::vector<std::vector<float>>& PrelocIOutgoingPsiSingle() = 0;
+
   virtual ~FLUDS() = default;
 
 protected:
@@ -68,6 +82,7 @@ protected:
   const size_t num_angles_;
   const size_t num_groups_and_angles_;
   const SPDS& spds_;
+  bool single_precision_ = false;
 };
 
 } // namespace chi_mesh::sweep_management
@@ -60,6 +60,8 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
   constexpr auto FOINCOMING = FaceOrientation::INCOMING;
   constexpr auto FOOUTGOING = FaceOrientation::OUTGOING;
 
+  const auto& face_associations = grid_.FaceAssociations();
+
   cell_face_orientations_.assign(grid_.local_cells.size(), {});
   for (auto& cell : grid_.local_cells)
     cell_face_orientations_[cell.local_id_].assign(cell.faces_.size(),
@@ -67,6 +69,7 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
 
   for (auto& cell : grid_.local_cells)
   {
+    const uint64_t c = cell.local_id_;
     size_t f = 0;
     for (auto& face : cell.faces_)
     {
@@ -75,9 +78,11 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
       FaceOrientation orientation = FOPARALLEL;
       const double mu = omega.Dot(face.normal_);
 
+      const bool neighbor_is_local =
+        face.has_neighbor_ and face_associations.NeighborIsLocal(c, f);
+
       bool owns_face = true;
-      if (face.has_neighbor_ and cell.global_id_ > face.neighbor_id_ and
-          grid_.IsCellLocal(face.neighbor_id_))
+      if (neighbor_is_local and cell.global_id_ > face.neighbor_id_)
         owns_face = false;
 
       if (owns_face)
@@ -88,12 +93,11 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
 
         cell_face_orientations_[cell.local_id_][f] = orientation;
 
-        if (face.has_neighbor_ and grid_.IsCellLocal(face.neighbor_id_))
+        if (neighbor_is_local)
         {
-          const auto& adj_cell = grid_.cells[face.neighbor_id_];
-          const auto ass_face = face.GetNeighborAssociatedFace(grid_);
-          auto& adj_face_ori =
-            cell_face_orientations_[adj_cell.local_id_][ass_face];
+          const auto adj_local_id = face_associations.NeighborLocalID(c, f);
+          const auto ass_face = face_associations.AssociatedFace(c, f);
+          auto& adj_face_ori = cell_face_orientations_[adj_local_id][ass_face];
 
           switch (orientation)
           {
@@ -104,10 +108,10 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
         }
         // clang-format on
       } // if face owned
-      else if (face.has_neighbor_ and not grid_.IsCellLocal(face.neighbor_id_))
+      else if (face.has_neighbor_ and not neighbor_is_local)
       {
         const auto& adj_cell = grid_.cells[face.neighbor_id_];
-        const auto ass_face = face.GetNeighborAssociatedFace(grid_);
+        const auto ass_face = face_associations.AssociatedFace(c, f);
         const auto& adj_face = adj_cell.faces_[ass_face];
 
         auto& cur_face_ori = cell_face_orientations_[cell.local_id_][f];
@@ -151,11 +155,11 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
         if (face.has_neighbor_)
         {
           //========================= If it is in the current location
-          if (face.IsNeighborLocal(grid_))
+          if (face_associations.NeighborIsLocal(c, f))
           {
             double weight = mu * face.ComputeFaceArea(grid_);
             cell_successors[c].insert(
-              std::make_pair(face.GetNeighborLocalID(grid_), weight));
+              std::make_pair(face_associations.NeighborLocalID(c, f), weight));
           }
           else
             location_successors.insert(face.GetNeighborPartitionID(grid_));
@@ -166,7 +170,7 @@ void chi_mesh::sweep_management::SPDS::PopulateCellRelationships(
       else
       {
         //================================if it is a cell and not bndry
-        if (face.has_neighbor_ and not face.IsNeighborLocal(grid_))
+        if (face.has_neighbor_ and not face_associations.NeighborIsLocal(c, f))
           location_dependencies.insert(face.GetNeighborPartitionID(grid_));
       }
       ++f;
@@ -317,4 +317,30 @@ void chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins::
   }
 }
 
+// ###################################################################
+/**Returns the parallel efficiency of this sweep ordering given the work of
+ * every location, i.e., the total work divided by the number of locations
+ * times the sweep time, where the sweep time is the sum, over the global
+ * sweep planes, of the largest work of a location in the plane.*/
+double SPDS_AdamsAdamsHawkins::ParallelEfficiency(
+  const std::vector<double>& location_work) const
+{
+  double total_work = 0.0;
+  for (double work : location_work)
+    total_work += work;
+
+  double sweep_time = 0.0;
+  for (const auto& sweep_plane : global_sweep_planes_)
+  {
+    double max_work = 0.0;
+    for (int location : sweep_plane.item_id)
+      max_work = std::max(max_work, location_work.at(location));
+    sweep_time += max_work;
+  }
+
+  if (sweep_time <= 0.0) return 1.0;
+  return total_work /
+         (static_cast<double>(location_work.size()) * sweep_time);
+}
+
 } // namespace chi_mesh::sweep_management
\ No newline at end of file
@@ -18,6 +18,8 @@ public:
     return global_sweep_planes_;
   }
 
+  double ParallelEfficiency(const std::vector<double>& location_work) const;
+
 private:
   void BuildTaskDependencyGraph(
     const std::vector<std::vector<int>>& global_dependencies,
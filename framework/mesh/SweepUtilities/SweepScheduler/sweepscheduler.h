@@ -4,13 +4,16 @@
 #include "mesh/SweepUtilities/AngleAggregation/angleaggregation.h"
 #include "mesh/SweepUtilities/sweepchunk_base.h"
 
+#include "utils/chi_thread_pool.h"
+
 
 namespace chi_mesh::sweep_management
 {
   enum class SchedulingAlgorithm
   {
     FIRST_IN_FIRST_OUT = 1, ///< FIFO
-    DEPTH_OF_GRAPH = 2      ///< DOG
+    DEPTH_OF_GRAPH = 2,     ///< DOG
+    PIPELINED_DEPTH_OF_GRAPH = 3 ///< DOG with pipelined group subsets
   };
 }
 
@@ -47,10 +50,25 @@ private:
   };
   std::vector<RULE_VALUES> rule_values_;
 
+  /**Angle sets of the same directions, one per group subset, in group
+   * subset order. Only used by the pipelined algorithm.*/
+  std::vector<std::vector<std::shared_ptr<TAngleSet>>> pipelines_;
+
   SweepChunk& sweep_chunk_;
   const size_t sweep_event_tag_;
   const std::vector<size_t> sweep_timing_events_tag_;
 
+  /**Additional sweep chunks, one per worker thread beyond the first. Each
+   * holds its own scratch data.*/
+  std::vector<std::shared_ptr<SweepChunk>> worker_sweep_chunks_;
+  /**Private flux moments of the worker sweep chunks, added to the
+   * destination phi after each threaded sweep.*/
+  std::vector<std::vector<double>> worker_phi_;
+  std::unique_ptr<chi::ThreadPool> thread_pool_;
+  /**True if whole angle sets are executed concurrently, false if the
+   * angle sets distribute their own tasks over the threads.*/
+  bool concurrent_angle_sets_ = false;
+
 
 public:
   SweepScheduler(SchedulingAlgorithm in_scheduler_type,
@@ -72,6 +90,27 @@ private:
   //02
   void InitializeAlgoDOG();
   void ScheduleAlgoDOG(SweepChunk& sweep_chunk);
+  void CompleteSweep();
+
+  //05
+  void InitializeAlgoPipelined();
+  void ScheduleAlgoPipelined(SweepChunk& sweep_chunk);
+  void ProgressPipelineSends(const std::vector<size_t>& num_executed);
+
+  //04
+  void ScheduleAlgoThreaded();
+
+public:
+  void EnableThreadedExecution(
+    std::vector<std::shared_ptr<SweepChunk>> worker_sweep_chunks);
+  size_t NumThreads() const;
+
+  static size_t OptimalNumPipelineChunks(size_t num_stages,
+                                         double work_time,
+                                         double message_latency,
+                                         size_t max_num_chunks);
+
+private:
 
   //03 utils
 public:
@@ -22,6 +22,8 @@ chi_mesh::sweep_management::SweepScheduler::SweepScheduler(
 
   if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
     InitializeAlgoDOG();
+  else if (scheduler_type_ == SchedulingAlgorithm::PIPELINED_DEPTH_OF_GRAPH)
+    InitializeAlgoPipelined();
 
   //=================================== Initialize delayed upstream data
   for (auto& angsetgrp : in_angle_agg.angle_set_groups)
@@ -192,6 +192,19 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG(
     } // for each angleset rule
   }   // while not finished
 
+  CompleteSweep();
+
+  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_END);
+}
+
+// ###################################################################
+/**Receives the delayed data, flushes the remaining send buffers and resets
+ * the angle sets and reflecting boundaries once all the angle sets of a
+ * sweep have executed.*/
+void chi_mesh::sweep_management::SweepScheduler::CompleteSweep()
+{
+  typedef AngleSetStatus Status;
+
   //================================================== Receive delayed data
   Chi::mpi.Barrier();
   bool received_delayed_data = false;
@@ -224,6 +237,4 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG(
       rbndry->ResetAnglesReadyStatus();
     }
   }
-
-  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_END);
-}
\ No newline at end of file
+}
@@ -0,0 +1,171 @@
+#include "sweepscheduler.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <sstream>
+#include <algorithm>
+#include <map>
+#include <cmath>
+
+// ###################################################################
+/**Initializes the pipelined Depth-Of-Graph algorithm.
+ *
+ * The angle sets are ordered by the Depth-Of-Graph rules, after which the
+ * angle sets sweeping the same directions are chained, in group subset
+ * order, into pipelines. Each group subset is a chunk of the pipeline. The
+ * pipelines are ordered by the position of their first chunk in the
+ * Depth-Of-Graph order.*/
+void chi_mesh::sweep_management::SweepScheduler::InitializeAlgoPipelined()
+{
+  InitializeAlgoDOG();
+
+  std::map<std::vector<size_t>, size_t> angles_to_pipeline;
+  for (auto& rule_value : rule_values_)
+  {
+    auto& angle_set = rule_value.angle_set;
+    const auto& angles = angle_set->GetAngleIndices();
+
+    auto it = angles_to_pipeline.find(angles);
+    if (it == angles_to_pipeline.end())
+    {
+      it = angles_to_pipeline.emplace(angles, pipelines_.size()).first;
+      pipelines_.emplace_back();
+    }
+    pipelines_[it->second].push_back(angle_set);
+  }
+
+  for (auto& pipeline : pipelines_)
+    std::stable_sort(pipeline.begin(),
+                     pipeline.end(),
+                     [](const std::shared_ptr<TAngleSet>& a,
+                        const std::shared_ptr<TAngleSet>& b)
+                     { return a->GetRefGroupSubset() < b->GetRefGroupSubset(); });
+}
+
+// ###################################################################
+/**Executes the pipelined Depth-Of-Graph algorithm.
+ *
+ * Within a pipeline the chunks execute strictly in group subset order. As
+ * soon as chunk k has executed its downstream messages are posted and,
+ * before chunk k+1 is swept, the send requests of all executed chunks are
+ * progressed. Downstream locations therefore receive chunk k while this
+ * location sweeps chunk k+1, which overlaps the communication with the
+ * computation in the same way as KBA pipelining over groups.*/
+void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoPipelined(
+  SweepChunk& sweep_chunk)
+{
+  typedef ExecutionPermission ExePerm;
+  typedef AngleSetStatus Status;
+
+  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_BEGIN);
+
+  auto ev_info =
+    std::make_shared<chi::ChiLog::EventInfo>(std::string("Sweep initiated"));
+
+  Chi::log.LogEvent(
+    sweep_event_tag_, chi::ChiLog::EventType::SINGLE_OCCURRENCE, ev_info);
+
+  //==================================================== Loop till done
+  std::vector<size_t> num_executed(pipelines_.size(), 0);
+  bool finished = false;
+  while (not finished)
+  {
+    finished = true;
+    for (size_t p = 0; p < pipelines_.size(); ++p)
+    {
+      auto& pipeline = pipelines_[p];
+      size_t& k = num_executed[p];
+
+      //=============================== Execute the ready chunks in order
+      while (k < pipeline.size())
+      {
+        auto& angleset = pipeline[k];
+
+        Status status = angleset->AngleSetAdvance(sweep_chunk,
+                                                  sweep_timing_events_tag_,
+                                                  ExePerm::NO_EXEC_IF_READY);
+        if (status != Status::READY_TO_EXECUTE) break;
+
+        std::stringstream message_i;
+        message_i << "Angleset " << angleset->GetID() << " executed on location "
+                  << Chi::mpi.location_id;
+
+        auto ev_info_i =
+          std::make_shared<chi::ChiLog::EventInfo>(message_i.str());
+
+        Chi::log.LogEvent(sweep_event_tag_,
+                          chi::ChiLog::EventType::SINGLE_OCCURRENCE,
+                          ev_info_i);
+
+        angleset->AngleSetAdvance(
+          sweep_chunk, sweep_timing_events_tag_, ExePerm::EXECUTE);
+
+        std::stringstream message_f;
+        message_f << "Angleset " << angleset->GetID() << " finished on location "
+                  << Chi::mpi.location_id;
+
+        auto ev_info_f =
+          std::make_shared<chi::ChiLog::EventInfo>(message_f.str());
+
+        Chi::log.LogEvent(sweep_event_tag_,
+                          chi::ChiLog::EventType::SINGLE_OCCURRENCE,
+                          ev_info_f);
+
+        ++k;
+
+        //======================== Push the messages of this chunk out
+        //                         before sweeping the next one
+        ProgressPipelineSends(num_executed);
+      } // while chunks ready
+
+      if (k < pipeline.size()) finished = false;
+    } // for pipeline
+  }   // while not finished
+
+  CompleteSweep();
+
+  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_END);
+}
+
+// ###################################################################
+/**Tests the pending send requests of all the executed chunks. MPI only
+ * progresses non-blocking messages inside MPI calls, messages larger than
+ * the eager limit would otherwise only move once the scheduler returns to
+ * the executed angle sets.*/
+void chi_mesh::sweep_management::SweepScheduler::ProgressPipelineSends(
+  const std::vector<size_t>& num_executed)
+{
+  for (size_t p = 0; p < pipelines_.size(); ++p)
+    for (size_t k = 0; k < num_executed[p]; ++k)
+      pipelines_[p][k]->FlushSendBuffers();
+}
+
+// ###################################################################
+/**Returns the number of group chunks minimizing the modeled time of a
+ * pipelined sweep.
+ *
+ * With S pipeline stages (locations along the sweep), n chunks, W the time
+ * a location needs to sweep and send all the groups of an angle set and L
+ * the latency of a message, the modeled time is
+ * \f$ T(n) = (S + n - 1)(W/n + L) \f$, which is minimal for
+ * \f$ n = \sqrt{(S-1) W / L} \f$. The result is clamped to
+ * [1, max_num_chunks].*/
+size_t chi_mesh::sweep_management::SweepScheduler::OptimalNumPipelineChunks(
+  size_t num_stages,
+  double work_time,
+  double message_latency,
+  size_t max_num_chunks)
+{
+  if (num_stages <= 1 or max_num_chunks <= 1 or work_time <= 0.0)
+    return 1;
+  if (message_latency <= 0.0) return max_num_chunks;
+
+  const double num_chunks = std::sqrt(static_cast<double>(num_stages - 1) *
+                                      work_time / message_latency);
+
+  const auto n = static_cast<size_t>(std::round(num_chunks));
+
+  return std::clamp(n, size_t{1}, max_num_chunks);
+}
@@ -8,10 +8,14 @@
 void chi_mesh::sweep_management::SweepScheduler::
      Sweep()
 {
-  if (scheduler_type_ == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
+  if (thread_pool_ and concurrent_angle_sets_)
+    ScheduleAlgoThreaded();
+  else if (scheduler_type_ == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO(sweep_chunk_);
   else if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
     ScheduleAlgoDOG(sweep_chunk_);
+  else if (scheduler_type_ == SchedulingAlgorithm::PIPELINED_DEPTH_OF_GRAPH)
+    ScheduleAlgoPipelined(sweep_chunk_);
 }
 
 //###################################################################
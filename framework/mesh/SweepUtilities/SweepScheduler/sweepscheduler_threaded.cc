@@ -0,0 +1,255 @@
+#include "sweepscheduler.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+
+// ###################################################################
+/**Enables multithreaded execution on this location. The scheduler's own
+ * sweep chunk is used by the first worker thread and each of the supplied
+ * chunks adds another worker. Every chunk must be a fully independent
+ * instance (own scratch data) writing to the same destination psi as the
+ * scheduler's sweep chunk. When whole angle sets are executed concurrently
+ * the supplied chunks accumulate the flux moments, and the other quantities
+ * summed over angle sets, privately (see ScheduleAlgoThreaded).
+ *
+ * If the angle sets can split their execution into phases (see
+ * AngleSet::SupportsThreadedExecution) whole angle sets are executed
+ * concurrently. Otherwise, if they can distribute their tasks over threads
+ * (see AngleSet::SupportsThreadedTaskExecution), the angle sets are
+ * scheduled as usual and use the threads internally. If neither is
+ * supported the scheduler remains serial.*/
+void chi_mesh::sweep_management::SweepScheduler::EnableThreadedExecution(
+  std::vector<std::shared_ptr<SweepChunk>> worker_sweep_chunks)
+{
+  if (worker_sweep_chunks.empty()) return;
+
+  bool all_support_angle_sets = true;
+  bool all_support_tasks = true;
+  for (auto& angle_set_group : angle_agg_.angle_set_groups)
+    for (auto& angle_set : angle_set_group.AngleSets())
+    {
+      if (not angle_set->SupportsThreadedExecution())
+        all_support_angle_sets = false;
+      if (not angle_set->SupportsThreadedTaskExecution())
+        all_support_tasks = false;
+    }
+
+  if (not(all_support_angle_sets or all_support_tasks))
+  {
+    Chi::log.Log0Warning()
+      << "SweepScheduler: The angle sets in use do not support threaded "
+         "execution. Sweeps will be executed with a single thread.";
+    return;
+  }
+
+  worker_sweep_chunks_ = std::move(worker_sweep_chunks);
+  thread_pool_ =
+    std::make_unique<chi::ThreadPool>(worker_sweep_chunks_.size() + 1);
+  concurrent_angle_sets_ = all_support_angle_sets;
+
+  if (concurrent_angle_sets_)
+  {
+    worker_phi_.resize(worker_sweep_chunks_.size());
+    for (auto& worker_chunk : worker_sweep_chunks_)
+      worker_chunk->EnablePrivateAccumulators();
+    return;
+  }
+
+  std::vector<SweepChunk*> chunk_ptrs = {&sweep_chunk_};
+  for (auto& worker_chunk : worker_sweep_chunks_)
+    chunk_ptrs.push_back(worker_chunk.get());
+
+  for (auto& angle_set_group : angle_agg_.angle_set_groups)
+    for (auto& angle_set : angle_set_group.AngleSets())
+      angle_set->SetTaskExecutionThreads(thread_pool_.get(), chunk_ptrs);
+}
+
+// ###################################################################
+/**Returns the number of threads used to execute sweep chunks.*/
+size_t chi_mesh::sweep_management::SweepScheduler::NumThreads() const
+{
+  return thread_pool_ ? thread_pool_->NumThreads() : 1;
+}
+
+// ###################################################################
+/**Executes angle sets concurrently on the worker threads of the pool.
+ *
+ * The main thread remains the only thread making MPI calls. It polls the
+ * angle sets in scheduling order (the depth-of-graph rule order when that
+ * algorithm, or its pipelined variant, is selected), prepares ready angle
+ * sets, hands their sweep chunk execution to the thread pool and
+ * communicates their results once the workers have finished them.
+ *
+ * Any ready angle set is dispatched, also when angle sets of the same
+ * group subset are in flight. The angular fluxes, FLUDS and reflecting
+ * boundary entries an angle set writes belong to its own directions. The
+ * flux moments and outflows, which are summed over directions, are
+ * accumulated by every worker chunk other than the scheduler's in private
+ * storage that is added to the destination after all angle sets finished.
+ *
+ * Sweep chunk only timing events are not recorded in this mode.*/
+void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoThreaded()
+{
+  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_BEGIN);
+
+  auto ev_info =
+    std::make_shared<chi::ChiLog::EventInfo>(std::string("Sweep initiated"));
+
+  Chi::log.LogEvent(
+    sweep_event_tag_, chi::ChiLog::EventType::SINGLE_OCCURRENCE, ev_info);
+
+  //==================================================== Build execution order
+  std::vector<AngleSet*> angle_sets;
+  if (not rule_values_.empty())
+    for (auto& rule_value : rule_values_)
+      angle_sets.push_back(rule_value.angle_set.get());
+  else
+    for (auto& angle_set_group : angle_agg_.angle_set_groups)
+      for (auto& angle_set : angle_set_group.AngleSets())
+        angle_sets.push_back(angle_set.get());
+
+  const size_t num_angle_sets = angle_sets.size();
+
+  //==================================================== Private accumulators
+  auto& destination_phi = sweep_chunk_.GetDestinationPhi();
+  for (size_t w = 0; w < worker_sweep_chunks_.size(); ++w)
+  {
+    worker_phi_[w].assign(destination_phi.size(), 0.0);
+    worker_sweep_chunks_[w]->SetDestinationPhi(worker_phi_[w]);
+    worker_sweep_chunks_[w]->ZeroPrivateAccumulators();
+  }
+
+  std::vector<bool> dispatched(num_angle_sets, false);
+  std::vector<bool> finished(num_angle_sets, false);
+  std::vector<std::exception_ptr> chunk_errors(num_angle_sets, nullptr);
+  std::vector<std::atomic<bool>> chunk_done(num_angle_sets);
+  for (auto& flag : chunk_done)
+    flag.store(false);
+
+  // Workers signal completed chunks so that the master thread can sleep
+  // instead of spinning when nothing can be progressed.
+  std::mutex done_mutex;
+  std::condition_variable done_cv;
+  size_t num_done = 0;
+
+  auto GetWorkerChunk = [this](size_t worker_id) -> SweepChunk&
+  {
+    if (worker_id == 0) return sweep_chunk_;
+    return *worker_sweep_chunks_[worker_id - 1];
+  };
+
+  //==================================================== Loop till done
+  size_t num_finished = 0;
+  while (num_finished < num_angle_sets)
+  {
+    bool progressed = false;
+    for (size_t k = 0; k < num_angle_sets; ++k)
+    {
+      auto& angle_set = *angle_sets[k];
+
+      //=============================== Complete executed chunks
+      if (dispatched[k] and not finished[k])
+      {
+        if (not chunk_done[k].load(std::memory_order_acquire)) continue;
+
+        if (chunk_errors[k])
+        {
+          thread_pool_->Wait(); // Outstanding tasks reference local data
+          std::rethrow_exception(chunk_errors[k]);
+        }
+
+        angle_set.CompleteThreadedExecution();
+
+        std::stringstream message_f;
+        message_f << "Angleset " << angle_set.GetID()
+                  << " finished on location " << Chi::mpi.location_id;
+
+        Chi::log.LogEvent(
+          sweep_event_tag_,
+          chi::ChiLog::EventType::SINGLE_OCCURRENCE,
+          std::make_shared<chi::ChiLog::EventInfo>(message_f.str()));
+
+        finished[k] = true;
+        ++num_finished;
+        progressed = true;
+        continue;
+      }
+
+      //=============================== Progress communication
+      // For finished angle sets this clears the downstream buffers, for the
+      // others it receives upstream data.
+      const auto status =
+        angle_set.AngleSetAdvance(sweep_chunk_,
+                                  sweep_timing_events_tag_,
+                                  ExecutionPermission::NO_EXEC_IF_READY);
+
+      if (finished[k]) continue;
+      if (status != AngleSetStatus::READY_TO_EXECUTE) continue;
+
+      //=============================== Dispatch ready angle sets
+      std::stringstream message_i;
+      message_i << "Angleset " << angle_set.GetID() << " executed on location "
+                << Chi::mpi.location_id;
+
+      Chi::log.LogEvent(
+        sweep_event_tag_,
+        chi::ChiLog::EventType::SINGLE_OCCURRENCE,
+        std::make_shared<chi::ChiLog::EventInfo>(message_i.str()));
+
+      angle_set.PrepareThreadedExecution();
+
+      dispatched[k] = true;
+      progressed = true;
+
+      thread_pool_->Submit(
+        [&, k](size_t worker_id)
+        {
+          try
+          {
+            GetWorkerChunk(worker_id).Sweep(*angle_sets[k]);
+          }
+          catch (...)
+          {
+            chunk_errors[k] = std::current_exception();
+          }
+          chunk_done[k].store(true, std::memory_order_release);
+          {
+            std::lock_guard<std::mutex> lock(done_mutex);
+            ++num_done;
+          }
+          done_cv.notify_one();
+        });
+    } // for angle set
+
+    //=============================== Wait for a chunk
+    // The wait is bounded because upstream MPI messages can also make an
+    // angle set ready and those are only detected by polling.
+    if (not progressed)
+    {
+      std::unique_lock<std::mutex> lock(done_mutex);
+      done_cv.wait_for(lock,
+                       std::chrono::microseconds(100),
+                       [&num_done, num_finished]
+                       { return num_done > num_finished; });
+    }
+  } // while not finished
+
+  //==================================================== Reduce accumulators
+  for (size_t w = 0; w < worker_sweep_chunks_.size(); ++w)
+  {
+    const auto& phi = worker_phi_[w];
+    for (size_t i = 0; i < phi.size(); ++i)
+      destination_phi[i] += phi[i];
+    worker_sweep_chunks_[w]->ReducePrivateAccumulators();
+  }
+
+  CompleteSweep();
+
+  Chi::log.LogEvent(sweep_event_tag_, chi::ChiLog::EventType::EVENT_END);
+}
@@ -3,10 +3,13 @@
 using namespace chi_mesh::sweep_management;
 
 //=============================================== Phi functions
-/**Sets the location where flux moments are to be written.*/
+/**Sets the location where flux moments are to be written. Worker chunks
+ * that accumulate privately are redirected at the start of every sweep.*/
 void SweepScheduler::SetDestinationPhi(std::vector<double> &in_destination_phi)
 {
   sweep_chunk_.SetDestinationPhi(in_destination_phi);
+  for (auto& worker_chunk : worker_sweep_chunks_)
+    worker_chunk->SetDestinationPhi(in_destination_phi);
 }
 
 /**Sets all elements of the output vector to zero.*/
@@ -26,6 +29,8 @@ std::vector<double>& SweepScheduler::GetDestinationPhi()
 void SweepScheduler::SetDestinationPsi(std::vector<double>& in_destination_psi)
 {
   sweep_chunk_.SetDestinationPsi(in_destination_psi);
+  for (auto& worker_chunk : worker_sweep_chunks_)
+    worker_chunk->SetDestinationPsi(in_destination_psi);
 }
 
 /**Sets all elements of the output angular flux vector to zero.*/
@@ -68,4 +73,6 @@ void SweepScheduler::ZeroOutputFluxDataStructures()
 void SweepScheduler::SetBoundarySourceActiveFlag(bool flag_value)
 {
   sweep_chunk_.SetBoundarySourceActiveFlag(flag_value);
+  for (auto& worker_chunk : worker_sweep_chunks_)
+    worker_chunk->SetBoundarySourceActiveFlag(flag_value);
 }
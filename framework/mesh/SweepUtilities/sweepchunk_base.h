@@ -83,6 +83,18 @@ protected:
   /**Returns a reference to the output angular flux vector.*/
   std::vector<double>& GetDestinationPsi() { return *destination_psi; }
 
+  /**Makes the chunk accumulate the quantities, other than the flux moments,
+   * that are summed over angle sets (e.g. outflows) in private storage
+   * instead of in the shared storage. Used by the worker chunks of threaded
+   * sweeps, which execute angle sets concurrently.*/
+  virtual void EnablePrivateAccumulators() {}
+
+  /**Sets the private accumulators to zero.*/
+  virtual void ZeroPrivateAccumulators() {}
+
+  /**Adds the private accumulators to the shared storage.*/
+  virtual void ReducePrivateAccumulators() {}
+
   /**Activates or deactives the surface src flag.*/
   void SetBoundarySourceActiveFlag(bool flag_value) // Done
   {
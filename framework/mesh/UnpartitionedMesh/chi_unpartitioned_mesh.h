@@ -3,6 +3,7 @@
 
 #include "mesh/chi_mesh.h"
 #include "mesh/Cell/cell.h"
+#include "mesh/chi_mesh_arrayview.h"
 
 class vtkCell;
 class vtkUnstructuredGrid;
@@ -55,10 +56,40 @@ public:
     size_t ortho_Nx = 0;
     size_t ortho_Ny = 0;
     size_t ortho_Nz = 0;
+    /**Number of threads used to establish the cell connectivity.*/
+    size_t connectivity_num_threads = 1;
 
     std::map<uint64_t, std::string> boundary_id_map;
   };
 
+  /**The cells subscribing to each vertex, in CSR form. The subscribing
+   * cells of a vertex are sorted by cell id.*/
+  class VertexCellSubscriptions
+  {
+  private:
+    std::vector<size_t> offsets_;
+    std::vector<uint64_t> cell_ids_;
+
+  public:
+    void Build(const std::vector<LightWeightCell*>& cells,
+               size_t num_vertices);
+
+    ConstArrayView<uint64_t> operator[](uint64_t vid) const
+    {
+      return {cell_ids_.data() + offsets_[vid],
+              offsets_[vid + 1] - offsets_[vid]};
+    }
+    size_t size() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+
+    void Clear()
+    {
+      offsets_.clear();
+      offsets_.shrink_to_fit();
+      cell_ids_.clear();
+      cell_ids_.shrink_to_fit();
+    }
+  };
+
   struct BoundBox
   {
     double xmin = 0.0, xmax = 0.0, ymin = 0.0, ymax = 0.0, zmin = 0.0,
@@ -69,7 +100,7 @@ protected:
   std::vector<chi_mesh::Vertex> vertices_;
   std::vector<LightWeightCell*> raw_cells_;
   std::vector<LightWeightCell*> raw_boundary_cells_;
-  std::vector<std::set<uint64_t>> vertex_cell_subscriptions_;
+  VertexCellSubscriptions vertex_cell_subscriptions_;
 
   MeshAttributes attributes_ = NONE;
   Options mesh_options_;
@@ -99,7 +130,7 @@ public:
   MeshAttributes& GetMeshAttributes() { return attributes_; }
   const MeshAttributes& GetMeshAttributes() const { return attributes_; }
 
-  const std::vector<std::set<uint64_t>>& GetVertextCellSubscriptions() const
+  const VertexCellSubscriptions& GetVertextCellSubscriptions() const
   {
     return vertex_cell_subscriptions_;
   }
@@ -118,7 +149,7 @@ public:
   const std::vector<chi_mesh::Vertex>& GetVertices() const { return vertices_; }
   std::vector<chi_mesh::Vertex>& GetVertices() { return vertices_; }
 
-  void BuildMeshConnectivity();
+  void BuildMeshConnectivity(size_t num_threads = 1);
   void ComputeCentroidsAndCheckQuality();
   /**Makes or gets a boundary that uniquely identifies the given name.*/
   uint64_t MakeBoundaryID(const std::string& boundary_name);
@@ -154,8 +185,7 @@ public:
     raw_cells_.shrink_to_fit();
     raw_boundary_cells_.clear();
     raw_boundary_cells_.shrink_to_fit();
-    vertex_cell_subscriptions_.clear();
-    vertex_cell_subscriptions_.shrink_to_fit();
+    vertex_cell_subscriptions_.Clear();
   }
 };
 
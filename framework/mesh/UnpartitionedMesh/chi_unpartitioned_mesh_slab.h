@@ -0,0 +1,59 @@
+#ifndef CHITECH_UNPARTITIONED_MESH_SLAB_H
+#define CHITECH_UNPARTITIONED_MESH_SLAB_H
+
+#include "chi_unpartitioned_mesh.h"
+
+#include <memory>
+
+namespace chi_mesh
+{
+
+// ###################################################################
+/**The portion of an unpartitioned mesh read or generated by a single
+ * location when a mesh is set up in a distributed fashion.
+ *
+ * The global cells and the global vertices are each divided into contiguous
+ * blocks, one per location, in the same way as chi::MakeSubSets does. A slab
+ * holds the cells of its cell block, with global ids starting at
+ * `cell_offset`, and the coordinates of the vertices in its vertex block,
+ * starting at `vertex_offset`. The cells may reference any global vertex.
+ *
+ * If `has_connectivity` is false the interior faces of the cells have not
+ * been connected yet, in which case the boundary cells (with their
+ * `material_id` being the boundary id) are used to assign boundary ids.*/
+struct UnpartitionedMeshSlab
+{
+  typedef UnpartitionedMesh::LightWeightCell LightWeightCell;
+  typedef std::unique_ptr<LightWeightCell> LightWeightCellPtr;
+
+  uint64_t num_global_cells = 0;
+  uint64_t cell_offset = 0;
+  std::vector<LightWeightCellPtr> cells;
+
+  uint64_t num_global_vertices = 0;
+  uint64_t vertex_offset = 0;
+  std::vector<chi_mesh::Vertex> vertices;
+
+  std::vector<LightWeightCellPtr> boundary_cells;
+  bool has_connectivity = false;
+
+  MeshAttributes attributes = NONE;
+  UnpartitionedMesh::Options mesh_options;
+
+  /**Reads this location's slab of a gmsh .msh legacy ASCII format 2 file.
+   * Must be called by all locations.*/
+  void ReadFromMsh(const UnpartitionedMesh::Options& options);
+
+  /**Returns the [begin, end) range of the block of `num_items` items owned
+   * by location `block_id` out of `num_blocks` locations.*/
+  static std::pair<uint64_t, uint64_t>
+  BlockRange(uint64_t num_items, int block_id, int num_blocks);
+
+  /**Returns the location owning `item` when `num_items` items are divided
+   * into `num_blocks` blocks.*/
+  static int BlockOwner(uint64_t item, uint64_t num_items, int num_blocks);
+};
+
+} // namespace chi_mesh
+
+#endif // CHITECH_UNPARTITIONED_MESH_SLAB_H
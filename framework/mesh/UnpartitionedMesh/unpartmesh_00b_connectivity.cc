@@ -4,15 +4,132 @@
 #include "chi_log.h"
 
 #include "utils/chi_timer.h"
+#include "utils/chi_thread_pool.h"
 
 #include "chi_mpi.h"
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+
+namespace
+{
+
+/**An unconnected face of a raw cell, identified by the hash of its
+ * vertex ids.*/
+struct FaceRecord
+{
+  uint64_t key;
+  uint64_t cell_id;
+  uint32_t face_id;
+
+  bool operator<(const FaceRecord& other) const
+  {
+    if (key != other.key) return key < other.key;
+    if (cell_id != other.cell_id) return cell_id < other.cell_id;
+    return face_id < other.face_id;
+  }
+};
+
+/**Returns the sorted, unique vertex ids of a face or cell, i.e., the
+ * vertex set that faces are matched on.*/
+std::vector<uint64_t> SortedVertexSet(const std::vector<uint64_t>& vids)
+{
+  std::vector<uint64_t> vertex_set(vids);
+  std::sort(vertex_set.begin(), vertex_set.end());
+  vertex_set.erase(std::unique(vertex_set.begin(), vertex_set.end()),
+                   vertex_set.end());
+  return vertex_set;
+}
+
+/**Hash of a sorted vertex set. Faces with the same vertices, in any
+ * order, get the same key.*/
+uint64_t VertexSetKey(const std::vector<uint64_t>& vertex_set)
+{
+  uint64_t key = vertex_set.size();
+  for (uint64_t vid : vertex_set)
+  {
+    // SplitMix64 finalizer of the combined value
+    uint64_t x = key ^ (vid + 0x9e3779b97f4a7c15ULL);
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    key = x;
+  }
+  return key;
+}
+
+/**Runs `func(t)` for t in [0, num_tasks), on a thread pool when more than
+ * one thread is requested.*/
+void ForEachTask(size_t num_tasks,
+                 size_t num_threads,
+                 const std::function<void(size_t)>& func)
+{
+  if (num_threads <= 1)
+  {
+    for (size_t t = 0; t < num_tasks; ++t)
+      func(t);
+    return;
+  }
+
+  chi::ThreadPool pool(num_threads);
+  for (size_t t = 0; t < num_tasks; ++t)
+    pool.Submit([&func, t](size_t) { func(t); });
+  pool.Wait();
+}
+
+} // namespace
+
 //###################################################################
-/**Establishes neighbor connectivity for the light-weight mesh.*/
-void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
+/**Builds the CSR list of the cells subscribing to each vertex.*/
+void chi_mesh::UnpartitionedMesh::VertexCellSubscriptions::Build(
+  const std::vector<LightWeightCell*>& cells, size_t num_vertices)
+{
+  const uint64_t NO_CELL = std::numeric_limits<uint64_t>::max();
+
+  // Count, skipping repeated vertices within a cell
+  std::vector<uint64_t> last_cell(num_vertices, NO_CELL);
+  offsets_.assign(num_vertices + 1, 0);
+  for (uint64_t c = 0; c < cells.size(); ++c)
+    for (uint64_t vid : cells[c]->vertex_ids)
+      if (last_cell[vid] != c)
+      {
+        last_cell[vid] = c;
+        ++offsets_[vid + 1];
+      }
+
+  for (size_t v = 0; v < num_vertices; ++v)
+    offsets_[v + 1] += offsets_[v];
+
+  // Fill, in increasing cell order
+  cell_ids_.assign(offsets_[num_vertices], 0);
+  std::vector<size_t> cursor(offsets_.begin(), offsets_.end() - 1);
+  last_cell.assign(num_vertices, NO_CELL);
+  for (uint64_t c = 0; c < cells.size(); ++c)
+    for (uint64_t vid : cells[c]->vertex_ids)
+      if (last_cell[vid] != c)
+      {
+        last_cell[vid] = c;
+        cell_ids_[cursor[vid]++] = c;
+      }
+}
+
+//###################################################################
+/**Establishes neighbor connectivity for the light-weight mesh.
+ *
+ * Every unconnected face is keyed by a hash of its vertex set. The face
+ * records are distributed over `num_threads` buckets by key, after which
+ * each bucket is sorted and faces with equal keys are matched by comparing
+ * their vertex sets. Buckets hold disjoint sets of faces, so the buckets
+ * are processed concurrently without locking, and since the matching
+ * follows the sorted order the result does not depend on the number of
+ * threads.*/
+void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity(size_t num_threads)
 {
   const size_t num_raw_cells = raw_cells_.size();
   const size_t num_raw_vertices = vertices_.size();
+  num_threads = std::max<size_t>(num_threads, 1);
 
   //======================================== Reset all cell neighbors
   int num_bndry_faces = 0;
@@ -25,136 +142,122 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
                                  "before connectivity: " << num_bndry_faces;
 
   Chi::log.Log() << Chi::program_timer.GetTimeString()
-                << " Establishing cell connectivity.";
+                << " Establishing cell connectivity using "
+                << num_threads << " thread(s).";
 
-  //======================================== Establish internal connectivity
-  // Populate vertex subscriptions to internal cells
-  vertex_cell_subscriptions_.resize(num_raw_vertices);
-  {
-    uint64_t cur_cell_id=0;
-    for (const auto& cell : raw_cells_)
-    {
-      for (auto vid : cell->vertex_ids)
-        vertex_cell_subscriptions_.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
-    }
-  }
+  chi::Timer connectivity_timer;
+  connectivity_timer.Reset();
+
+  //======================================== Populate vertex subscriptions
+  vertex_cell_subscriptions_.Build(raw_cells_, num_raw_vertices);
 
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Vertex cell subscriptions complete.";
 
-  // Process raw cells
+  //======================================== Bucket the unconnected faces
+  // Each task t collects the faces of a contiguous range of cells into
+  // its own row of buckets.
+  const size_t num_buckets = num_threads;
+  const size_t num_tasks = num_threads;
+  std::vector<std::vector<std::vector<FaceRecord>>> task_buckets(
+    num_tasks, std::vector<std::vector<FaceRecord>>(num_buckets));
+
+  ForEachTask(num_tasks, num_threads, [&](size_t t)
   {
-    uint64_t aux_counter = 0;
-    uint64_t cur_cell_id=0;
-    for (auto& cell : raw_cells_)
+    const size_t c0 = num_raw_cells * t / num_tasks;
+    const size_t c1 = num_raw_cells * (t + 1) / num_tasks;
+    for (size_t c = c0; c < c1; ++c)
     {
-      for (auto& cur_cell_face : cell->faces)
+      const auto& faces = raw_cells_[c]->faces;
+      for (uint32_t f = 0; f < faces.size(); ++f)
       {
-        if (cur_cell_face.has_neighbor) {continue;}
-        const std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
-                                        cur_cell_face.vertex_ids.end());
+        if (faces[f].has_neighbor) continue;
+        const uint64_t key =
+          VertexSetKey(SortedVertexSet(faces[f].vertex_ids));
+        task_buckets[t][key % num_buckets].push_back({key, c, f});
+      }
+    }
+  });
 
-        std::set<size_t> cells_to_search;
-        for (uint64_t vid : cfvids)
-          for (uint64_t cell_id : vertex_cell_subscriptions_.at(vid))
-            if (cell_id != cur_cell_id)
-              cells_to_search.insert(cell_id);
+  //======================================== Establish internal connectivity
+  // Each task b sorts bucket b and pairs faces with equal vertex sets
+  // belonging to different cells.
+  ForEachTask(num_buckets, num_threads, [&](size_t b)
+  {
+    std::vector<FaceRecord> records;
+    for (size_t t = 0; t < num_tasks; ++t)
+      records.insert(records.end(),
+                     task_buckets[t][b].begin(),
+                     task_buckets[t][b].end());
+    std::sort(records.begin(), records.end());
 
-        for (uint64_t adj_cell_id : cells_to_search)
-        {
-          auto adj_cell = raw_cells_.at(adj_cell_id);
+    auto FaceOf = [this](const FaceRecord& record) -> LightWeightFace&
+    { return raw_cells_[record.cell_id]->faces[record.face_id]; };
 
-          for (auto& adj_cell_face : adj_cell->faces)
-          {
-            if (adj_cell_face.has_neighbor) {continue;}
-            const std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
-                                            adj_cell_face.vertex_ids.end());
+    for (size_t i = 0; i < records.size(); )
+    {
+      size_t run_end = i + 1;
+      while (run_end < records.size() and
+             records[run_end].key == records[i].key)
+        ++run_end;
 
-            if (cfvids == afvids)
-            {
-              cur_cell_face.neighbor = adj_cell_id;
-              adj_cell_face.neighbor = cur_cell_id;
+      for (size_t r = i; r < run_end; ++r)
+      {
+        auto& cur_face = FaceOf(records[r]);
+        if (cur_face.has_neighbor) continue;
+        const auto cfvids = SortedVertexSet(cur_face.vertex_ids);
 
-              cur_cell_face.has_neighbor = true;
-              adj_cell_face.has_neighbor = true;
+        for (size_t s = r + 1; s < run_end; ++s)
+        {
+          if (records[s].cell_id == records[r].cell_id) continue;
+          auto& adj_face = FaceOf(records[s]);
+          if (adj_face.has_neighbor) continue;
+          if (SortedVertexSet(adj_face.vertex_ids) != cfvids) continue;
 
-              goto face_neighbor_found;
-            }
-          }//for adjacent cell face
-        }
-        face_neighbor_found:;
-      }//for face
+          cur_face.neighbor = records[s].cell_id;
+          adj_face.neighbor = records[r].cell_id;
 
-      ++cur_cell_id;
-      const double fraction_complete = static_cast<double>(cur_cell_id)/
-                                       static_cast<double>(num_raw_cells);
-      if (fraction_complete >= static_cast<double>(aux_counter+1)*0.1)
-      {
-        Chi::log.Log() << Chi::program_timer.GetTimeString()
-                      << " Surpassing cell " << cur_cell_id
-                      << " of " << num_raw_cells
-                      << " (" << (aux_counter+1)*10 << "%)";
-        ++aux_counter;
+          cur_face.has_neighbor = true;
+          adj_face.has_neighbor = true;
+          break;
+        }
       }
-    }//for cell
-  }
+      i = run_end;
+    }
+  });
+
+  task_buckets.clear();
 
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Establishing cell boundary connectivity.";
 
   //======================================== Establish boundary connectivity
-  // Make list of internal cells on the boundary
-  std::vector<LightWeightCell*> internal_cells_on_boundary;
-  for (auto& cell : raw_cells_)
-  {
-    bool cell_on_boundary = false;
-    for (auto& face : cell->faces)
-      if (not face.has_neighbor)
-      { cell_on_boundary = true; break; }
+  // Key the boundary cells by their vertex sets
+  std::unordered_multimap<uint64_t, size_t> bndry_cell_keys;
+  bndry_cell_keys.reserve(raw_boundary_cells_.size());
+  for (size_t bc = 0; bc < raw_boundary_cells_.size(); ++bc)
+    bndry_cell_keys.emplace(
+      VertexSetKey(SortedVertexSet(raw_boundary_cells_[bc]->vertex_ids)), bc);
 
-    if (cell_on_boundary) internal_cells_on_boundary.push_back(cell);
-  }
-
-  // Populate vertex subscriptions to boundary cells
-  std::vector<std::set<uint64_t>> vertex_bndry_cell_subscriptions(vertices_.size());
-  {
-    uint64_t cur_cell_id=0;
-    for (auto& cell : raw_boundary_cells_)
-    {
-      for (auto vid : cell->vertex_ids)
-        vertex_bndry_cell_subscriptions.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
-    }
-  }
-
-  // Process boundary cells
-  for (auto& cell : internal_cells_on_boundary)
-    for (auto& face : cell->faces)
-    {
-      if (face.has_neighbor) continue;
-      std::set<uint64_t> cfvids(face.vertex_ids.begin(),
-                                face.vertex_ids.end());
-
-      std::set<size_t> cells_to_search;
-      for (uint64_t vid : face.vertex_ids)
-        for (uint64_t cell_id : vertex_bndry_cell_subscriptions[vid])
-          cells_to_search.insert(cell_id);
-
-      for (uint64_t adj_cell_id : cells_to_search)
+  // Process the remaining unconnected faces
+  if (not bndry_cell_keys.empty())
+    for (auto& cell : raw_cells_)
+      for (auto& face : cell->faces)
       {
-        auto& adj_cell = raw_boundary_cells_[adj_cell_id];
-
-        std::set<uint64_t> afvids(adj_cell->vertex_ids.begin(),
-                                  adj_cell->vertex_ids.end());
+        if (face.has_neighbor) continue;
+        const auto cfvids = SortedVertexSet(face.vertex_ids);
 
-        if (cfvids == afvids)
+        const auto range = bndry_cell_keys.equal_range(VertexSetKey(cfvids));
+        for (auto it = range.first; it != range.second; ++it)
         {
-          face.neighbor = adj_cell->material_id;
-          break;
-        }
-      }//for adj_cell_id
-    }//for face
+          const auto& adj_cell = raw_boundary_cells_[it->second];
+          if (SortedVertexSet(adj_cell->vertex_ids) == cfvids)
+          {
+            face.neighbor = adj_cell->material_id;
+            break;
+          }
+        }//for adj_cell
+      }//for face
 
   num_bndry_faces = 0;
   for (auto cell : raw_cells_)
@@ -165,8 +268,13 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
                               << " Number of boundary faces "
                                  "after connectivity: " << num_bndry_faces;
 
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                << " Cell connectivity established in "
+                << connectivity_timer.GetTime() / 1000.0 << " s using "
+                << num_threads << " thread(s).";
+
   Chi::mpi.Barrier();
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Done establishing cell connectivity.";
 
-}
\ No newline at end of file
+}
@@ -86,7 +86,7 @@ void chi_mesh::UnpartitionedMesh::ReadFromVTU(
   attributes_ = dimension | UNSTRUCTURED;
 
   ComputeCentroidsAndCheckQuality();
-  BuildMeshConnectivity();
+  BuildMeshConnectivity(options.connectivity_num_threads);
 
   Chi::log.Log() << "Done reading VTU file: " << options.file_name << ".";
 }
@@ -78,7 +78,7 @@ void chi_mesh::UnpartitionedMesh::
   attributes_ = dimension | UNSTRUCTURED;
 
   ComputeCentroidsAndCheckQuality();
-  BuildMeshConnectivity();
+  BuildMeshConnectivity(options.connectivity_num_threads);
 
   Chi::log.Log() << "Done reading PVTU file: " << options.file_name << ".";
 }
@@ -318,7 +318,7 @@ void chi_mesh::UnpartitionedMesh::ReadFromWavefrontOBJ(const Options &options)
   attributes_ = DIMENSION_2 | UNSTRUCTURED;
 
   ComputeCentroidsAndCheckQuality();
-  BuildMeshConnectivity();
+  BuildMeshConnectivity(options.connectivity_num_threads);
 
   //======================================================= Set boundary ids
   if (bndry_block_ids.empty())
@@ -387,7 +387,7 @@ void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
   attributes_ = dimension | UNSTRUCTURED;
 
   ComputeCentroidsAndCheckQuality();
-  BuildMeshConnectivity();
+  BuildMeshConnectivity(options.connectivity_num_threads);
 
   Chi::log.Log() << "Done processing " << options.file_name << ".\n"
                  << "Number of nodes read: " << vertices_.size() << "\n"
@@ -123,7 +123,7 @@ void chi_mesh::UnpartitionedMesh::
   attributes_ = dimension | UNSTRUCTURED;
 
   ComputeCentroidsAndCheckQuality();
-  BuildMeshConnectivity();
+  BuildMeshConnectivity(options.connectivity_num_threads);
 
   //======================================== Set boundary ids
   SetBoundaryIDsFromBlocks(bndry_grid_blocks);
@@ -0,0 +1,36 @@
+#include "chi_unpartitioned_mesh_slab.h"
+
+// ###################################################################
+/**Returns the [begin, end) range of the block of `num_items` items owned
+ * by location `block_id` out of `num_blocks` locations. The first
+ * `num_items % num_blocks` blocks hold one more item than the others.*/
+std::pair<uint64_t, uint64_t> chi_mesh::UnpartitionedMeshSlab::BlockRange(
+  uint64_t num_items, int block_id, int num_blocks)
+{
+  const auto P = static_cast<uint64_t>(num_blocks);
+  const auto b = static_cast<uint64_t>(block_id);
+  const uint64_t div = num_items / P;
+  const uint64_t rem = num_items % P;
+
+  const uint64_t begin = b * div + std::min(b, rem);
+  const uint64_t end = begin + div + ((b < rem) ? 1 : 0);
+
+  return {begin, end};
+}
+
+// ###################################################################
+/**Returns the location owning `item` when `num_items` items are divided
+ * into `num_blocks` blocks.*/
+int chi_mesh::UnpartitionedMeshSlab::BlockOwner(uint64_t item,
+                                                uint64_t num_items,
+                                                int num_blocks)
+{
+  const auto P = static_cast<uint64_t>(num_blocks);
+  const uint64_t div = num_items / P;
+  const uint64_t rem = num_items % P;
+
+  const uint64_t num_in_large_blocks = rem * (div + 1);
+  if (item < num_in_large_blocks) return static_cast<int>(item / (div + 1));
+
+  return static_cast<int>(rem + (item - num_in_large_blocks) / div);
+}
@@ -0,0 +1,366 @@
+#include "chi_unpartitioned_mesh_slab.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "chi_mpi.h"
+
+#include <fstream>
+
+namespace
+{
+
+/**Returns the set of all the locations' values.*/
+std::set<int> GlobalSet(const std::set<int>& local_set)
+{
+  const std::vector<int> local_values(local_set.begin(), local_set.end());
+  const int local_count = static_cast<int>(local_values.size());
+
+  std::vector<int> counts(Chi::mpi.process_count, 0);
+  MPI_Allgather(
+    &local_count, 1, MPI_INT, counts.data(), 1, MPI_INT, Chi::mpi.comm);
+
+  std::vector<int> displs(Chi::mpi.process_count, 0);
+  int total_count = 0;
+  for (int p = 0; p < Chi::mpi.process_count; ++p)
+  {
+    displs[p] = total_count;
+    total_count += counts[p];
+  }
+
+  std::vector<int> values(total_count, 0);
+  MPI_Allgatherv(local_values.data(),
+                 local_count,
+                 MPI_INT,
+                 values.data(),
+                 counts.data(),
+                 displs.data(),
+                 MPI_INT,
+                 Chi::mpi.comm);
+
+  return {values.begin(), values.end()};
+}
+
+} // namespace
+
+//###################################################################
+/**Reads this location's slab of a gmsh .msh legacy ASCII format 2 file.
+ * Must be called by all locations.
+ *
+ * Every location streams through the file but only stores the vertices of
+ * its vertex block and the volume and boundary elements of its blocks of
+ * these. Elements are numbered, materials are mapped and faces are created
+ * exactly as UnpartitionedMesh::ReadFromMsh does.*/
+void chi_mesh::UnpartitionedMeshSlab::ReadFromMsh(
+  const UnpartitionedMesh::Options& options)
+{
+  const std::string fname = "chi_mesh::UnpartitionedMeshSlab::ReadFromMsh";
+
+  const int location_id = Chi::mpi.location_id;
+  const int num_locations = Chi::mpi.process_count;
+
+  mesh_options = options;
+
+  //===================================================== Opening the file
+  std::ifstream file;
+  file.open(options.file_name);
+  if (!file.is_open())
+    throw std::runtime_error(fname + ": Failed to open file: " +
+                             options.file_name);
+
+  Chi::log.Log() << "Making unpartitioned mesh slabs from msh format file "
+                 << options.file_name;
+
+  //===================================================== Declarations
+  std::string file_line;
+  std::istringstream iss;
+  const std::string node_section_name = "$Nodes";
+  const std::string elements_section_name = "$Elements";
+  const std::string format_section_name = "$MeshFormat";
+
+  auto SeekSection = [&file, &file_line](const std::string& section_name)
+  {
+    file.clear();
+    file.seekg(0);
+    while (std::getline(file, file_line))
+      if (section_name == file_line) break;
+  };
+
+  //=================================================== Check the format
+  SeekSection(format_section_name);
+
+  std::getline(file, file_line);
+  iss = std::istringstream(file_line);
+  double format;
+  if (!(iss >> format))
+    throw std::logic_error(fname + ": Failed to read the file format.");
+  else if (format != 2.2)
+    throw std::logic_error(fname +
+                           ": Currently, only msh format 2.2 is supported.");
+
+  //=================================================== Read the vertex block
+  SeekSection(node_section_name);
+
+  std::getline(file, file_line);
+  iss = std::istringstream(file_line);
+  int num_nodes;
+  if (!(iss >> num_nodes))
+    throw std::logic_error(fname + ": Failed while trying to read "
+                                   "the number of nodes.");
+
+  num_global_vertices = static_cast<uint64_t>(num_nodes);
+  const auto [v_begin, v_end] =
+    BlockRange(num_global_vertices, location_id, num_locations);
+  vertex_offset = v_begin;
+  vertices.assign(v_end - v_begin, chi_mesh::Vertex(0.0, 0.0, 0.0));
+
+  for (int n = 0; n < num_nodes; n++)
+  {
+    std::getline(file, file_line);
+    iss = std::istringstream(file_line);
+
+    int vert_index;
+    if (!(iss >> vert_index))
+      throw std::logic_error(fname + ": Failed to read vertex index.");
+
+    const auto vid = static_cast<uint64_t>(vert_index - 1);
+    if (vid < v_begin or vid >= v_end) continue;
+
+    auto& vertex = vertices[vid - v_begin];
+    if (!(iss >> vertex.x >> vertex.y >> vertex.z))
+      throw std::logic_error(fname + ": Failed while reading the vertex "
+                                     "coordinates.");
+  }
+
+  //================================================== Element reading utils
+  struct ElementHeader
+  {
+    int elem_type = 0;
+    int physical_reg = 0;
+  };
+
+  /**Reads the header of the next element line, leaving the node indices
+   * in the stream.*/
+  auto ReadElementHeader = [&file, &file_line, &iss, &fname]()
+  {
+    ElementHeader header;
+    int num_tags, tag, element_index;
+
+    std::getline(file, file_line);
+    iss = std::istringstream(file_line);
+
+    if (!(iss >> element_index >> header.elem_type >> num_tags))
+      throw std::logic_error(fname + ": Failed while reading element index, "
+                                     "element type, and number of tags.");
+
+    if (!(iss >> header.physical_reg))
+      throw std::logic_error(fname + ": Failed while reading physical region.");
+
+    for (int i = 1; i < num_tags; i++)
+      if (!(iss >> tag))
+        throw std::logic_error(fname + ": Failed when reading tags.");
+
+    return header;
+  };
+
+  auto ReadNumElements = [&file, &file_line, &iss, &fname]()
+  {
+    std::getline(file, file_line);
+    iss = std::istringstream(file_line);
+    int num_elems;
+    if (!(iss >> num_elems))
+      throw std::logic_error(fname + ": Failed to read number of elements.");
+    return num_elems;
+  };
+
+  auto IsElementType1D = [](int elem_type) { return elem_type == 1; };
+  auto IsElementType2D = [](int elem_type)
+  { return elem_type == 2 or elem_type == 3; };
+  auto IsElementType3D = [](int elem_type)
+  { return elem_type >= 4 and elem_type <= 7; };
+  /**Prisms and pyramids are skipped, as in UnpartitionedMesh::ReadFromMsh.*/
+  auto IsElementRead = [](int elem_type)
+  { return elem_type >= 1 and elem_type <= 5; };
+
+  //================================================== Determine mesh type and
+  //                                                   count the elements
+  bool mesh_is_2D = true;
+  uint64_t num_elems_1D = 0, num_elems_2D = 0, num_elems_3D = 0;
+  SeekSection(elements_section_name);
+  int num_elems = ReadNumElements();
+  for (int n = 0; n < num_elems; n++)
+  {
+    const int elem_type = ReadElementHeader().elem_type;
+
+    if (elem_type == 15) continue; // skip point type element
+
+    if (elem_type < 1 or elem_type > 7)
+      throw std::logic_error(fname + ": Unsupported element encountered.");
+
+    if (IsElementType3D(elem_type)) mesh_is_2D = false;
+
+    if (not IsElementRead(elem_type)) continue;
+    if (IsElementType1D(elem_type)) ++num_elems_1D;
+    if (IsElementType2D(elem_type)) ++num_elems_2D;
+    if (IsElementType3D(elem_type)) ++num_elems_3D;
+  }
+
+  auto IsVolumeElement = [&](int elem_type)
+  {
+    if (not IsElementRead(elem_type)) return false;
+    return mesh_is_2D ? IsElementType2D(elem_type)
+                      : IsElementType3D(elem_type);
+  };
+  auto IsBoundaryElement = [&](int elem_type)
+  {
+    if (not IsElementRead(elem_type)) return false;
+    return mesh_is_2D ? IsElementType1D(elem_type)
+                      : IsElementType2D(elem_type);
+  };
+
+  num_global_cells = mesh_is_2D ? num_elems_2D : num_elems_3D;
+  const uint64_t num_global_bndry_cells =
+    mesh_is_2D ? num_elems_1D : num_elems_2D;
+
+  const auto [c_begin, c_end] =
+    BlockRange(num_global_cells, location_id, num_locations);
+  const auto [b_begin, b_end] =
+    BlockRange(num_global_bndry_cells, location_id, num_locations);
+  cell_offset = c_begin;
+
+  //================================================== Read the element blocks
+  SeekSection(elements_section_name);
+  num_elems = ReadNumElements();
+  uint64_t cell_counter = 0;
+  uint64_t bndry_cell_counter = 0;
+  for (int n = 0; n < num_elems; n++)
+  {
+    const auto header = ReadElementHeader();
+    const int elem_type = header.elem_type;
+
+    LightWeightCellPtr raw_cell = nullptr;
+    if (IsVolumeElement(elem_type))
+    {
+      const uint64_t c = cell_counter++;
+      if (c < c_begin or c >= c_end) continue;
+
+      if (mesh_is_2D)
+        raw_cell = std::make_unique<LightWeightCell>(
+          CellType::POLYGON,
+          elem_type == 2 ? CellType::TRIANGLE : CellType::QUADRILATERAL);
+      else
+        raw_cell = std::make_unique<LightWeightCell>(
+          CellType::POLYHEDRON,
+          elem_type == 4 ? CellType::TETRAHEDRON : CellType::HEXAHEDRON);
+    }
+    else if (IsBoundaryElement(elem_type))
+    {
+      const uint64_t b = bndry_cell_counter++;
+      if (b < b_begin or b >= b_end) continue;
+
+      if (mesh_is_2D)
+        raw_cell = std::make_unique<LightWeightCell>(CellType::SLAB,
+                                                     CellType::SLAB);
+      else
+        raw_cell = std::make_unique<LightWeightCell>(
+          CellType::POLYGON,
+          elem_type == 2 ? CellType::TRIANGLE : CellType::QUADRILATERAL);
+    }
+    else
+      continue;
+
+    auto& cell = *raw_cell;
+    cell.material_id = header.physical_reg;
+
+    int num_cell_nodes = 4;
+    if (elem_type == 1) num_cell_nodes = 2;
+    else if (elem_type == 2)
+      num_cell_nodes = 3;
+    else if (elem_type == 5)
+      num_cell_nodes = 8;
+
+    cell.vertex_ids.assign(num_cell_nodes, 0);
+    for (int i = 0; i < num_cell_nodes; ++i)
+    {
+      int raw_node;
+      if (!(iss >> raw_node))
+        throw std::logic_error(fname + ": Failed when reading element "
+                                       "node index.");
+      if ((raw_node - 1) >= 0) cell.vertex_ids[i] = raw_node - 1;
+    }
+
+    //====================================== Populate faces
+    auto& v = cell.vertex_ids;
+    if (elem_type == 1) // 2-node edge
+    {
+      cell.faces.emplace_back(std::vector<uint64_t>{v[0]});
+      cell.faces.emplace_back(std::vector<uint64_t>{v[1]});
+    }
+    else if (elem_type == 2 or elem_type == 3) // triangle or quadrangle
+    {
+      const size_t num_verts = v.size();
+      for (size_t e = 0; e < num_verts; e++)
+      {
+        const size_t ep1 = (e < (num_verts - 1)) ? e + 1 : 0;
+        cell.faces.emplace_back(std::vector<uint64_t>{v[e], v[ep1]});
+      }
+    }
+    else if (elem_type == 4) // 4-node tetrahedron
+    {
+      cell.faces.emplace_back(std::vector<uint64_t>{v[0], v[2], v[1]});
+      cell.faces.emplace_back(std::vector<uint64_t>{v[0], v[3], v[2]});
+      cell.faces.emplace_back(std::vector<uint64_t>{v[3], v[1], v[2]});
+      cell.faces.emplace_back(std::vector<uint64_t>{v[3], v[0], v[1]});
+    }
+    else if (elem_type == 5) // 8-node hexahedron
+    {
+      cell.faces.emplace_back(std::vector<uint64_t>{v[5], v[1], v[2], v[6]});
+      cell.faces.emplace_back(std::vector<uint64_t>{v[0], v[4], v[7], v[3]});
+      cell.faces.emplace_back(std::vector<uint64_t>{v[0], v[3], v[2], v[1]});
+      cell.faces.emplace_back(std::vector<uint64_t>{v[4], v[5], v[6], v[7]});
+      cell.faces.emplace_back(std::vector<uint64_t>{v[2], v[3], v[7], v[6]});
+      cell.faces.emplace_back(std::vector<uint64_t>{v[0], v[1], v[5], v[4]});
+    }
+
+    if (IsVolumeElement(elem_type)) cells.push_back(std::move(raw_cell));
+    else
+      boundary_cells.push_back(std::move(raw_cell));
+  } // for elements
+
+  file.close();
+
+  //======================================== Remap material-ids
+  // The mapping must be over the ids of all the slabs.
+  std::set<int> local_material_ids, local_boundary_ids;
+  for (const auto& cell : cells)
+    local_material_ids.insert(cell->material_id);
+  for (const auto& cell : boundary_cells)
+    local_boundary_ids.insert(cell->material_id);
+
+  std::map<int, int> material_mapping, boundary_mapping;
+  {
+    int m = 0;
+    for (int mat_id : GlobalSet(local_material_ids))
+      material_mapping[mat_id] = m++;
+
+    int b = 0;
+    for (int bndry_id : GlobalSet(local_boundary_ids))
+      boundary_mapping[bndry_id] = b++;
+  }
+
+  for (auto& cell : cells)
+    cell->material_id = material_mapping[cell->material_id];
+  for (auto& cell : boundary_cells)
+    cell->material_id = boundary_mapping[cell->material_id];
+
+  //======================================== Always do this
+  chi_mesh::MeshAttributes dimension = DIMENSION_2;
+  if (not mesh_is_2D) dimension = DIMENSION_3;
+
+  attributes = dimension | UNSTRUCTURED;
+  has_connectivity = false;
+
+  Chi::log.Log() << "Done processing " << options.file_name << ".\n"
+                 << "Number of nodes: " << num_global_vertices << "\n"
+                 << "Number of cells: " << num_global_cells;
+}
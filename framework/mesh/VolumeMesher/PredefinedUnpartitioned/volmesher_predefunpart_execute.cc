@@ -65,6 +65,7 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::Execute()
 
   //======================================== Load up the cells
   auto& vertex_subs = umesh_ptr_->GetVertextCellSubscriptions();
+  std::vector<uint64_t> local_vids;
   size_t cell_globl_id = 0;
   for (auto raw_cell : umesh_ptr_->GetRawCells())
   {
@@ -73,8 +74,8 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::Execute()
       auto cell = MakeCell(*raw_cell, cell_globl_id,
                            cell_pids[cell_globl_id], umesh_ptr_->GetVertices());
 
-      for (uint64_t vid : cell->vertex_ids_)
-        grid->vertices.Insert(vid, umesh_ptr_->GetVertices()[vid]);
+      local_vids.insert(local_vids.end(),
+                        cell->vertex_ids_.begin(), cell->vertex_ids_.end());
 
       grid->cells.push_back(std::move(cell));
     }
@@ -82,6 +83,14 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::Execute()
     ++cell_globl_id;
   }//for raw_cell
 
+  //Vertices are inserted in increasing id order, which appends them
+  std::sort(local_vids.begin(), local_vids.end());
+  local_vids.erase(std::unique(local_vids.begin(), local_vids.end()),
+                   local_vids.end());
+  grid->vertices.Reserve(local_vids.size());
+  for (uint64_t vid : local_vids)
+    grid->vertices.Insert(vid, umesh_ptr_->GetVertices()[vid]);
+
   grid->SetGlobalVertexCount(umesh_ptr_->GetVertices().size());
 
   Chi::log.Log() << "Cells loaded.";
@@ -15,7 +15,7 @@ bool chi_mesh::VolumeMesherPredefinedUnpartitioned::
   CellHasLocalScope(
     const chi_mesh::UnpartitionedMesh::LightWeightCell& lwcell,
     uint64_t cell_global_id,
-    const std::vector<std::set<uint64_t>>& vertex_subscriptions,
+    const UnpartitionedMesh::VertexCellSubscriptions& vertex_subscriptions,
     const std::vector<int64_t>& cell_partition_ids)
 {
   //First determine if the cell is a local cell
@@ -0,0 +1,30 @@
+#ifndef CHI_MESH_ARRAYVIEW_H
+#define CHI_MESH_ARRAYVIEW_H
+
+#include <cstddef>
+
+namespace chi_mesh
+{
+
+//##################################################
+/**Read-only view of a contiguous range of values.*/
+template <typename T>
+class ConstArrayView
+{
+private:
+  const T* data_ = nullptr;
+  size_t size_ = 0;
+
+public:
+  ConstArrayView(const T* data, size_t size) : data_(data), size_(size) {}
+
+  const T* begin() const { return data_; }
+  const T* end() const { return data_ + size_; }
+  const T& operator[](size_t i) const { return data_[i]; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+};
+
+}//namespace chi_mesh
+
+#endif //CHI_MESH_ARRAYVIEW_H
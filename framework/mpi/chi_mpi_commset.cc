@@ -0,0 +1,153 @@
+#include "chi_mpi_commset.h"
+
+#include <algorithm>
+
+namespace
+{
+
+/**Creates a distributed graph communicator with the given neighbors as
+ * both the sources and the destinations. Defined outside of namespace chi,
+ * where `MPI_INFO_NULL` would resolve to chi::MPI_Info.*/
+MPI_Comm MakeNeighborhoodCommunicator(MPI_Comm comm,
+                                      const std::vector<int>& neighbors)
+{
+  const int num_neighbors = static_cast<int>(neighbors.size());
+
+  MPI_Comm neighborhood_comm = MPI_COMM_NULL;
+  MPI_Dist_graph_create_adjacent(comm,
+                                 num_neighbors,
+                                 neighbors.data(),
+                                 MPI_UNWEIGHTED,
+                                 num_neighbors,
+                                 neighbors.data(),
+                                 MPI_UNWEIGHTED,
+                                 MPI_INFO_NULL,
+                                 /*reorder=*/0,
+                                 &neighborhood_comm);
+  return neighborhood_comm;
+}
+
+} // namespace
+
+// ###################################################################
+/**Builds the communicator set from the neighbors of this location. Must
+ * be called by all locations of `comm`.
+ *
+ * Only the neighbors exchange information: the neighbor lists are shared
+ * with a neighborhood allgather over a distributed graph communicator,
+ * after which every location creates, with `MPI_Comm_create_group`, the
+ * communicators it is a member of. Each location creates these in
+ * increasing order of the location owning the communicator, which makes
+ * the order consistent amongst all members and the creation deadlock
+ * free. No collective over all locations, other than creating the
+ * distributed graph communicator, is involved.*/
+chi::ChiMPICommunicatorSet::ChiMPICommunicatorSet(
+  const std::vector<int>& neighbors, MPI_Comm comm)
+{
+  int location_id = 0;
+  MPI_Comm_rank(comm, &location_id);
+
+  //============================================= Sort the neighbors
+  neighbors_ = neighbors;
+  std::sort(neighbors_.begin(), neighbors_.end());
+  neighbors_.erase(std::unique(neighbors_.begin(), neighbors_.end()),
+                   neighbors_.end());
+  neighbors_.erase(
+    std::remove(neighbors_.begin(), neighbors_.end(), location_id),
+    neighbors_.end());
+
+  const int num_neighbors = static_cast<int>(neighbors_.size());
+
+  //============================================= Create the neighborhood
+  neighborhood_comm_ = MakeNeighborhoodCommunicator(comm, neighbors_);
+
+  //============================================= Exchange neighbor lists
+  std::vector<int> counts(num_neighbors, 0);
+  MPI_Neighbor_allgather(&num_neighbors,
+                         1,
+                         MPI_INT,
+                         counts.data(),
+                         1,
+                         MPI_INT,
+                         neighborhood_comm_);
+
+  std::vector<int> displacements(num_neighbors, 0);
+  int total_count = 0;
+  for (int k = 0; k < num_neighbors; ++k)
+  {
+    displacements[k] = total_count;
+    total_count += counts[k];
+  }
+
+  std::vector<int> neighbor_lists(total_count, 0);
+  MPI_Neighbor_allgatherv(neighbors_.data(),
+                          num_neighbors,
+                          MPI_INT,
+                          neighbor_lists.data(),
+                          counts.data(),
+                          displacements.data(),
+                          MPI_INT,
+                          neighborhood_comm_);
+
+  //============================================= Determine members
+  auto& own_members = location_members_[location_id];
+  own_members = neighbors_;
+  own_members.push_back(location_id);
+  std::sort(own_members.begin(), own_members.end());
+
+  for (int k = 0; k < num_neighbors; ++k)
+  {
+    auto& members = location_members_[neighbors_[k]];
+    members.assign(neighbor_lists.begin() + displacements[k],
+                   neighbor_lists.begin() + displacements[k] + counts[k]);
+    members.push_back(neighbors_[k]);
+    std::sort(members.begin(), members.end());
+  }
+
+  //============================================= Build communicators
+  MPI_Group world_group;
+  MPI_Comm_group(comm, &world_group);
+
+  for (const auto& [locI, members] : location_members_)
+  {
+    MPI_Group location_group;
+    MPI_Group_incl(world_group,
+                   static_cast<int>(members.size()),
+                   members.data(),
+                   &location_group);
+
+    MPI_Comm location_comm = MPI_COMM_NULL;
+    MPI_Comm_create_group(comm, location_group, 0, &location_comm);
+    communicators_[locI] = location_comm;
+
+    MPI_Group_free(&location_group);
+  }
+
+  MPI_Group_free(&world_group);
+}
+
+// ###################################################################
+/**Frees the communicators, unless MPI has already been finalized.*/
+chi::ChiMPICommunicatorSet::~ChiMPICommunicatorSet()
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (finalized) return;
+
+  for (auto& [locI, location_comm] : communicators_)
+    if (location_comm != MPI_COMM_NULL) MPI_Comm_free(&location_comm);
+
+  if (neighborhood_comm_ != MPI_COMM_NULL) MPI_Comm_free(&neighborhood_comm_);
+}
+
+// ###################################################################
+/**Returns the rank of locI in the communicator of locJ, or
+ * `MPI_UNDEFINED` if locI is not a member of it.*/
+int chi::ChiMPICommunicatorSet::MapIonJ(int locI, int locJ) const
+{
+  const auto& members = location_members_.at(locJ);
+  const auto it = std::lower_bound(members.begin(), members.end(), locI);
+  if (it == members.end() or *it != locI) return MPI_UNDEFINED;
+
+  return static_cast<int>(it - members.begin());
+}
@@ -5,6 +5,8 @@
 #include "mesh/chi_mesh.h"
 #include "chi_runtime.h"
 
+#include <map>
+
 namespace chi
 {
 
@@ -12,41 +14,53 @@ namespace chi
 /**Simple implementation a communicator set.
  * Definitions:
  * P = total amount of processors.
- * locI = process I in [0,P]*/
+ * locI = process I in [0,P]
+ *
+ * The communicator of locI contains locI and its neighbors. A location only
+ * holds the communicators it is a member of, i.e., its own and those of its
+ * neighbors, which requires the neighbor relation to be symmetric. The set
+ * is built with a distributed graph communicator over the neighbors, which
+ * is also available for neighborhood collectives.*/
 class ChiMPICommunicatorSet
 {
 private:
-  /**A list of communicators, size P, contains a communicator for
-   * only communicating with the neighbors of locI.*/
-  std::vector<MPI_Comm>  communicators_;
-  /**A list of groupings, size P, allows mapping of the rank of locJ
-   * relative to the local communicator.*/
-  std::vector<MPI_Group> location_groups_;
-  /**Used to translate ranks.*/
-  MPI_Group              world_group_;
+  /**The neighbors of this location, sorted, excluding this location.*/
+  std::vector<int> neighbors_;
+  /**Distributed graph communicator with the neighbors as both sources and
+   * destinations, in the order of `neighbors_`.*/
+  MPI_Comm neighborhood_comm_ = MPI_COMM_NULL;
+  /**The communicators of this location and its neighbors.*/
+  std::map<int, MPI_Comm> communicators_;
+  /**The sorted members of the communicators, allowing mapping of the rank
+   * of locJ relative to the local communicator.*/
+  std::map<int, std::vector<int>> location_members_;
 
 public:
-  ChiMPICommunicatorSet(std::vector<MPI_Comm>&  communicators,
-                        std::vector<MPI_Group>& location_groups,
-                        MPI_Group&               world_group) :
-    communicators_(communicators),
-    location_groups_(location_groups),
-    world_group_(world_group)
-  {}
+  /**Builds the communicator set from the neighbors of this location. Must
+   * be called by all locations of `comm`.*/
+  ChiMPICommunicatorSet(const std::vector<int>& neighbors, MPI_Comm comm);
+  ~ChiMPICommunicatorSet();
+
+  ChiMPICommunicatorSet(const ChiMPICommunicatorSet&) = delete;
+  ChiMPICommunicatorSet& operator=(const ChiMPICommunicatorSet&) = delete;
 
+  /**Returns the communicator of locI, which must be this location or one
+   * of its neighbors.*/
   MPI_Comm LocICommunicator(int locI) const
   {
-    return communicators_[locI];
+    return communicators_.at(locI);
   }
 
-  int MapIonJ(int locI, int locJ) const
-  {
-    int group_rank;
-    MPI_Group_translate_ranks(world_group_, 1, &locI,
-                              location_groups_[locJ], &group_rank);
+  /**Returns the rank of locI in the communicator of locJ.*/
+  int MapIonJ(int locI, int locJ) const;
 
-    return group_rank;
-  }
+  /**Returns the neighbors of this location in the order of the
+   * neighborhood communicator.*/
+  const std::vector<int>& Neighbors() const { return neighbors_; }
+
+  /**Returns the distributed graph communicator over the neighbors, for use
+   * with neighborhood collectives such as MPI_Neighbor_alltoallv.*/
+  MPI_Comm NeighborhoodCommunicator() const { return neighborhood_comm_; }
 };
 }//namespace chi_objects
 
@@ -35,6 +35,12 @@ void MPI_Info::SetProcessCount(int in_process_count)
   process_count_set_ = true;
 }
 
+/**Sets the level of thread support provided by the MPI library.*/
+void MPI_Info::SetThreadSupport(int in_thread_support)
+{
+  thread_support_ = in_thread_support;
+}
+
 void MPI_Info::Barrier() const
 {
   MPI_Barrier(this->communicator_);
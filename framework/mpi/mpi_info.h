@@ -18,6 +18,7 @@ private:
   MPI_Comm communicator_ = MPI_COMM_WORLD;
   int location_id_ = 0;
   int process_count_ = 1;
+  int thread_support_ = MPI_THREAD_SINGLE;
 
   bool location_id_set_ = false;
   bool process_count_set_ = false;
@@ -26,6 +27,8 @@ public:
   const int& location_id = location_id_;     ///< Current process rank.
   const int& process_count = process_count_; ///< Total number of processes.
   const MPI_Comm& comm = communicator_; ///< MPI communicator
+  /**Level of thread support provided by the MPI library.*/
+  const int& thread_support = thread_support_;
 
 private:
   MPI_Info() = default;
@@ -44,6 +47,8 @@ protected:
   void SetLocationID(int in_location_id);
   /**Sets the number of processes in the communicator.*/
   void SetProcessCount(int in_process_count);
+  /**Sets the level of thread support provided by the MPI library.*/
+  void SetThreadSupport(int in_thread_support);
 
 public:
   /**Calls the generic `MPI_Barrier` with the current communicator.*/
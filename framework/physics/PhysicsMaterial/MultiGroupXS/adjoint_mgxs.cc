@@ -25,12 +25,14 @@ AdjointMGXS(const MultiGroupXS& xs) : xs_(xs)
   if (xs_.IsFissionable())
   {
     const auto& F = xs_.ProductionMatrix();
+    std::vector<std::vector<double>> F_transpose;
     for (size_t g = 0; g < xs_.NumGroups(); ++g)
     {
       std::vector<double> F_g_transpose;
       for (size_t gp = 0; gp < xs_.NumGroups(); ++gp)
-        F_g_transpose.emplace_back(F[gp][g]);
-      transposed_production_matrices_.push_back(F_g_transpose);
+        F_g_transpose.emplace_back(F(gp, g));
+      F_transpose.push_back(F_g_transpose);
     }
+    transposed_production_matrix_ = FlatProductionMatrix(F_transpose);
   }
 }
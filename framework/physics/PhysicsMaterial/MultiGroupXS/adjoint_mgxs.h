@@ -25,7 +25,7 @@ class AdjointMGXS : public MultiGroupXS
 private:
   const MultiGroupXS& xs_;
   std::vector<chi_math::SparseMatrix> transposed_transfer_matrices_;
-  std::vector<std::vector<double>> transposed_production_matrices_;
+  FlatProductionMatrix transposed_production_matrix_;
 
 public:
   AdjointMGXS() = delete;
@@ -78,8 +78,8 @@ public:
   const chi_math::SparseMatrix& TransferMatrix(unsigned int ell) const override
   { return transposed_transfer_matrices_.at(ell); }
 
-  const std::vector<std::vector<double>> ProductionMatrix() const override
-  { return transposed_production_matrices_; }
+  const FlatProductionMatrix& ProductionMatrix() const override
+  { return transposed_production_matrix_; }
 
   const std::vector<Precursor>& Precursors() const override
   { return xs_.Precursors(); }
@@ -0,0 +1,35 @@
+#include "flat_production_matrix.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+//######################################################################
+/**Builds the dense and sparse storage from a list of rows.*/
+chi_physics::FlatProductionMatrix::
+FlatProductionMatrix(const std::vector<std::vector<double>>& F) :
+  num_groups_(F.size())
+{
+  dense_.reserve(num_groups_ * num_groups_);
+  row_offsets_.reserve(num_groups_ + 1);
+  row_offsets_.push_back(0);
+
+  for (size_t g = 0; g < num_groups_; ++g)
+  {
+    ChiInvalidArgumentIf(F[g].size() != num_groups_,
+                         "Production matrix row " + std::to_string(g) +
+                         " has " + std::to_string(F[g].size()) +
+                         " entries where " + std::to_string(num_groups_) +
+                         " are expected.");
+
+    for (size_t gp = 0; gp < num_groups_; ++gp)
+    {
+      dense_.push_back(F[g][gp]);
+      if (F[g][gp] != 0.0)
+      {
+        cols_.push_back(gp);
+        vals_.push_back(F[g][gp]);
+      }
+    }
+    row_offsets_.push_back(cols_.size());
+  }
+}
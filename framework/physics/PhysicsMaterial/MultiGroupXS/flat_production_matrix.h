@@ -0,0 +1,56 @@
+#ifndef CHI_PHYSICS_FLAT_PRODUCTION_MATRIX_H
+#define CHI_PHYSICS_FLAT_PRODUCTION_MATRIX_H
+
+#include <cstddef>
+#include <vector>
+
+namespace chi_physics
+{
+
+//######################################################################
+/**Production matrix of a multi-group cross section set, stored in flat,
+ * contiguous arrays. Entry F[g][gp] is the production into group g from
+ * fission in group gp. The matrix is available both densely, as row-major
+ * rows, and sparsely, as the non-zero entries of each row in CSR form.
+ * Accessors return references or pointers into the storage, no copies.*/
+class FlatProductionMatrix
+{
+private:
+  size_t num_groups_ = 0;
+  std::vector<double> dense_;       ///< Row-major, num_groups^2 entries
+  std::vector<size_t> row_offsets_; ///< CSR offsets of the non-zeros
+  std::vector<size_t> cols_;        ///< CSR column indices
+  std::vector<double> vals_;        ///< CSR values
+
+public:
+  FlatProductionMatrix() = default;
+  /**Builds the matrix from rows F[g], each of length F.size(). An empty
+   * list gives an empty matrix.*/
+  explicit FlatProductionMatrix(const std::vector<std::vector<double>>& F);
+
+  bool Empty() const { return num_groups_ == 0; }
+  size_t NumGroups() const { return num_groups_; }
+
+  /**Dense row g, i.e., F[g][gp] for gp in [0, NumGroups()).*/
+  const double* Row(size_t g) const
+  {
+    return dense_.data() + g * num_groups_;
+  }
+  double operator()(size_t g, size_t gp) const
+  {
+    return dense_[g * num_groups_ + gp];
+  }
+
+  /**Sparse row g: the non-zero entries k in [SparseRowBegin(g),
+   * SparseRowEnd(g)) have column SparseCols()[k] and value
+   * SparseValues()[k].*/
+  size_t SparseRowBegin(size_t g) const { return row_offsets_[g]; }
+  size_t SparseRowEnd(size_t g) const { return row_offsets_[g + 1]; }
+  const size_t* SparseCols() const { return cols_.data(); }
+  const double* SparseValues() const { return vals_.data(); }
+  size_t NumNonZeros() const { return vals_.size(); }
+};
+
+}//namespace chi_physics
+
+#endif //CHI_PHYSICS_FLAT_PRODUCTION_MATRIX_H
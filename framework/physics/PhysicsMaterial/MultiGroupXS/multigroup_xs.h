@@ -3,6 +3,7 @@
 
 #include "physics/PhysicsMaterial/material_property_base.h"
 #include "math/SparseMatrix/chi_math_sparse_matrix.h"
+#include "flat_production_matrix.h"
 
 
 namespace chi_physics
@@ -24,7 +25,7 @@ public:
 
   MultiGroupXS()
       : MaterialProperty(PropertyType::TRANSPORT_XSECTIONS)
-  {}
+  { UpdateVersion(); }
 
   void ExportToChiXSFile(const std::string& file_name,
                          const double fission_scaling = 1.0) const;
@@ -62,7 +63,7 @@ public:
   virtual const chi_math::SparseMatrix&
   TransferMatrix(unsigned int ell) const = 0;
 
-  virtual const std::vector <std::vector<double>> ProductionMatrix() const = 0;
+  virtual const FlatProductionMatrix& ProductionMatrix() const = 0;
 
   virtual const std::vector <Precursor>& Precursors() const = 0;
 
@@ -73,6 +74,21 @@ public:
   virtual const std::vector<double>& SigmaRemoval() const = 0;
 
   virtual const std::vector<double>& SigmaSGtoG() const = 0;
+
+  /**Version of the data of the cross sections. It is unique across all
+   * instances and changes every time the data is rebuilt, so that consumers
+   * holding data derived from the cross sections know when to recompute.*/
+  size_t Version() const { return version_; }
+
+protected:
+  void UpdateVersion()
+  {
+    static size_t version_counter = 0;
+    version_ = ++version_counter;
+  }
+
+private:
+  size_t version_ = 0;
 };
 
 }//namespace chi_physics
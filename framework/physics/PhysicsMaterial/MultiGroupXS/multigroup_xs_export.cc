@@ -177,7 +177,7 @@ ExportToChiXSFile(const std::string &file_name,
     ofile << "TRANSFER_MOMENTS_END\n";
   }//if has transfer matrices
 
-  if (not ProductionMatrix().empty())
+  if (not ProductionMatrix().Empty())
   {
     const auto& F = ProductionMatrix();
 
@@ -185,7 +185,7 @@ ExportToChiXSFile(const std::string &file_name,
     ofile << "PRODUCTION_MATRIX_BEGIN\n";
     for (unsigned int g = 0; g < NumGroups(); ++g)
     {
-      const auto& prod = F[g];
+      const double* prod = F.Row(g);
       for (unsigned int gp = 0; gp < NumGroups(); ++gp)
       {
         const double value =
@@ -152,17 +152,17 @@ void chi_physics::MultiGroupXS::PushLuaTable(lua_State *L) const
   lua_pushstring(L, "production_matrix");
   lua_newtable(L);
   {
-    unsigned int g = 0;
-    for (const auto& prod : ProductionMatrix())
+    const auto& F = ProductionMatrix();
+    for (unsigned int g = 0; g < F.NumGroups(); ++g)
     {
-      lua_pushinteger(L, ++g);
+      lua_pushinteger(L, g + 1);
       lua_newtable(L);
       {
-        unsigned int gp = 0;
-        for (const auto& val : prod)
+        const double* prod = F.Row(g);
+        for (unsigned int gp = 0; gp < F.NumGroups(); ++gp)
         {
-          lua_pushinteger(L, ++gp);
-          lua_pushnumber(L, val);
+          lua_pushinteger(L, gp + 1);
+          lua_pushnumber(L, prod[gp]);
           lua_settable(L, -3);
         }
         lua_settable(L, -3);
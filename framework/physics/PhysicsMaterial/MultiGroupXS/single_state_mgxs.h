@@ -36,7 +36,7 @@ protected:
   std::vector<double> inv_velocity_;
 
   std::vector<chi_math::SparseMatrix> transfer_matrices_;
-  std::vector<std::vector<double>> production_matrix_;
+  FlatProductionMatrix production_matrix_;
 
   std::vector<Precursor> precursors_;
 
@@ -116,7 +116,7 @@ public:
   const chi_math::SparseMatrix& TransferMatrix(unsigned int ell) const override
   { return transfer_matrices_.at(ell); }
 
-  const std::vector<std::vector<double>> ProductionMatrix() const override
+  const FlatProductionMatrix& ProductionMatrix() const override
   { return production_matrix_; }
 
   const std::vector<Precursor>& Precursors() const override
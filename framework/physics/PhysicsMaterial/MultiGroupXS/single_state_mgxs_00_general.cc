@@ -9,6 +9,8 @@
 //######################################################################
 void chi_physics::SingleStateMGXS::Clear()
 {
+  UpdateVersion();
+
   num_groups_ = 0;
   scattering_order_ = 0;
   num_precursors_ = 0;
@@ -25,7 +27,7 @@ void chi_physics::SingleStateMGXS::Clear()
   inv_velocity_.clear();
 
   transfer_matrices_.clear();
-  production_matrix_.clear();
+  production_matrix_ = FlatProductionMatrix();
 
   precursors_.clear();
 
@@ -201,11 +203,12 @@ MakeCombined(std::vector<std::pair<int, double> > &combinations)
                               chi_math::SparseMatrix(num_groups_, num_groups_));
 
   //init fission data
+  std::vector<std::vector<double>> production_matrix;
   if (is_fissionable_)
   {
     sigma_f_.assign(n_grps, 0.0);
     nu_sigma_f_.assign(n_grps, 0.0);
-    production_matrix_.assign(
+    production_matrix.assign(
         num_groups_, std::vector<double>(num_groups_, 0.0));
 
     //init prompt/delayed fission data
@@ -255,7 +258,7 @@ MakeCombined(std::vector<std::pair<int, double> > &combinations)
         sigma_f_[g] += sig_f[g] * N_i;
         nu_sigma_f_[g] += sig_f[g] * N_i;
         for (unsigned int gp = 0; gp < num_groups_; ++gp)
-          production_matrix_[g][gp] += F[g][gp] * N_i;
+          production_matrix[g][gp] += F(g, gp) * N_i;
 
         if (n_precs > 0)
         {
@@ -332,5 +335,7 @@ MakeCombined(std::vector<std::pair<int, double> > &combinations)
     }
   }//for cross sections
 
+  production_matrix_ = FlatProductionMatrix(production_matrix);
+
   ComputeDiffusionParameters();
 }
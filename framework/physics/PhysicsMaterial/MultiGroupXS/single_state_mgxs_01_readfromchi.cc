@@ -256,6 +256,7 @@ void chi_physics::SingleStateMGXS::
   std::vector<std::vector<double>> emission_spectra;
   std::vector<double> nu, nu_prompt, nu_delayed, beta;
   std::vector<double> chi, chi_prompt;
+  std::vector<std::vector<double>> production_matrix;
 
   std::string word, line;
   unsigned int line_number = 0;
@@ -639,7 +640,7 @@ void chi_physics::SingleStateMGXS::
 
       if (fw == "PRODUCTION_MATRIX_BEGIN")
         Read2DData("PRODUCTION_MATRIX", "GPRIME_G_VAL",
-                   production_matrix_, num_groups_, num_groups_, f, ls, ln);
+                   production_matrix, num_groups_, num_groups_, f, ls, ln);
     }//try
 
     catch (const std::runtime_error& err)
@@ -681,7 +682,7 @@ void chi_physics::SingleStateMGXS::
 
   //determine if the material is fissionable
   is_fissionable_ = not sigma_f_.empty() or not nu_sigma_f_.empty() or
-                    not production_matrix_.empty();
+                    not production_matrix.empty();
 
   //clear fission data if not fissionable
   if (not is_fissionable_)
@@ -697,7 +698,7 @@ void chi_physics::SingleStateMGXS::
   else
   {
     //check vector data inputs
-    if (production_matrix_.empty())
+    if (production_matrix.empty())
     {
       //check for non-delayed fission neutron yield data
       if (nu.empty() and nu_prompt.empty())
@@ -823,7 +824,7 @@ void chi_physics::SingleStateMGXS::
         std::vector<double> prod;
         for (unsigned int gp = 0.0; gp < num_groups_; ++gp)
           prod.push_back(chi_[g] * nu_sigma_f[gp]);
-        production_matrix_.push_back(prod);
+        production_matrix.push_back(prod);
       }
     }//if production_matrix empty
 
@@ -852,7 +853,7 @@ void chi_physics::SingleStateMGXS::
       nu_sigma_f_.assign(num_groups_, 0.0);
       for (unsigned int g = 0; g < num_groups_; ++g)
         for (unsigned int gp = 0; gp < num_groups_; ++gp)
-          nu_sigma_f_[gp] += production_matrix_[g][gp];
+          nu_sigma_f_[gp] += production_matrix[g][gp];
 
       //check for reasonable fission neutron yield
       nu.assign(num_groups_, 0.0);
@@ -872,4 +873,6 @@ void chi_physics::SingleStateMGXS::
     ChiLogicalErrorIf(sigma_f_.empty(), "After reading xs, a fissionable "
                                         "material's sigma_f is not defined");
   }//if fissionable
+
+  production_matrix_ = FlatProductionMatrix(production_matrix);
 }
@@ -0,0 +1,143 @@
+#include "chi_thread_pool.h"
+
+#include "chi_log_exceptions.h"
+
+//################################################################### Constructor
+/**Creates the pool and starts `num_threads` workers.*/
+chi::ThreadPool::ThreadPool(size_t num_threads)
+{
+  ChiInvalidArgumentIf(num_threads == 0,
+                       "A thread pool requires at least one thread.");
+
+  queues_.reserve(num_threads);
+  for (size_t w = 0; w < num_threads; ++w)
+    queues_.push_back(std::make_unique<WorkerQueue>());
+
+  threads_.reserve(num_threads);
+  for (size_t w = 0; w < num_threads; ++w)
+    threads_.emplace_back(&ThreadPool::WorkerLoop, this, w);
+}
+
+//################################################################### Destructor
+/**Finishes all outstanding work and joins the workers.*/
+chi::ThreadPool::~ThreadPool()
+{
+  {
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    all_done_cv_.wait(lock, [this] { return num_unfinished_ == 0; });
+    stop_ = true;
+  }
+  work_available_cv_.notify_all();
+
+  for (auto& thread : threads_)
+    thread.join();
+}
+
+//################################################################### Submit
+/**Queues a task for execution by one of the workers.*/
+void chi::ThreadPool::Submit(Task task)
+{
+  const size_t q = next_queue_.fetch_add(1) % queues_.size();
+
+  // The counters are incremented before the task becomes visible so that a
+  // worker popping it can never drive them below zero.
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    ++num_queued_;
+    ++num_unfinished_;
+  }
+  {
+    std::lock_guard<std::mutex> lock(queues_[q]->mutex);
+    queues_[q]->tasks.push_back(std::move(task));
+  }
+  work_available_cv_.notify_one();
+}
+
+//################################################################### Wait
+/**Blocks until all submitted tasks have completed. If any task threw, the
+ * first captured exception is rethrown here.*/
+void chi::ThreadPool::Wait()
+{
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    all_done_cv_.wait(lock, [this] { return num_unfinished_ == 0; });
+    std::swap(exception, first_exception_);
+  }
+
+  if (exception) std::rethrow_exception(exception);
+}
+
+//################################################################### TryPop
+/**Pops a task from the worker's own deque, or steals one from another
+ * worker's deque.*/
+bool chi::ThreadPool::TryPop(size_t worker_id, Task& task)
+{
+  const size_t num_queues = queues_.size();
+  {
+    auto& own_queue = *queues_[worker_id];
+    std::lock_guard<std::mutex> lock(own_queue.mutex);
+    if (not own_queue.tasks.empty())
+    {
+      task = std::move(own_queue.tasks.back());
+      own_queue.tasks.pop_back();
+      return true;
+    }
+  }
+
+  for (size_t k = 1; k < num_queues; ++k)
+  {
+    auto& victim_queue = *queues_[(worker_id + k) % num_queues];
+    std::lock_guard<std::mutex> lock(victim_queue.mutex);
+    if (not victim_queue.tasks.empty())
+    {
+      task = std::move(victim_queue.tasks.front());
+      victim_queue.tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//################################################################### WorkerLoop
+/**Main loop of a worker thread.*/
+void chi::ThreadPool::WorkerLoop(size_t worker_id)
+{
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(state_mutex_);
+      work_available_cv_.wait(lock,
+                              [this] { return stop_ or num_queued_ > 0; });
+      if (stop_ and num_queued_ == 0) return;
+    }
+
+    Task task;
+    if (not TryPop(worker_id, task)) continue;
+
+    {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      --num_queued_;
+    }
+
+    std::exception_ptr exception = nullptr;
+    try
+    {
+      task(worker_id);
+    }
+    catch (...)
+    {
+      exception = std::current_exception();
+    }
+
+    bool all_done;
+    {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      if (exception and not first_exception_) first_exception_ = exception;
+      --num_unfinished_;
+      all_done = num_unfinished_ == 0;
+    }
+    if (all_done) all_done_cv_.notify_all();
+  }
+}
@@ -0,0 +1,71 @@
+#ifndef CHI_THREAD_POOL_H
+#define CHI_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//################################################################### CLASS DEF
+namespace chi
+{
+/**A small work-stealing thread pool.
+ *
+ * Every worker owns a task deque. Submitted tasks are distributed round-robin
+ * over the deques, workers pop from the back of their own deque and, when it
+ * is empty, steal from the front of the deques of the other workers.
+ *
+ * Each task receives the id of the worker executing it, in the range
+ * [0, NumThreads()), so that callers can associate thread-private scratch
+ * data (e.g. a sweep chunk) with a worker.
+ *
+ * The pool makes no MPI calls itself. Exceptions thrown by tasks are captured
+ * and the first one is rethrown from Wait().*/
+class ThreadPool
+{
+public:
+  typedef std::function<void(size_t worker_id)> Task;
+
+private:
+  struct WorkerQueue
+  {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  std::vector<std::thread> threads_;
+
+  std::mutex state_mutex_;
+  std::condition_variable work_available_cv_;
+  std::condition_variable all_done_cv_;
+  size_t num_queued_ = 0;
+  size_t num_unfinished_ = 0;
+  bool stop_ = false;
+  std::exception_ptr first_exception_ = nullptr;
+
+  std::atomic<size_t> next_queue_{0};
+
+public:
+  explicit ThreadPool(size_t num_threads);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+  size_t NumThreads() const { return threads_.size(); }
+
+  void Submit(Task task);
+  void Wait();
+
+private:
+  bool TryPop(size_t worker_id, Task& task);
+  void WorkerLoop(size_t worker_id);
+};
+} // namespace chi
+
+#endif // CHI_THREAD_POOL_H
@@ -70,7 +70,8 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(const chi_mesh::Cell &cell,
 
 
       //========================= Get the current map to the adj cell's face
-      unsigned int fmap = MapCellFace(cell,adj_cell,f);
+      unsigned int fmap =
+        grid_ptr_->FaceAssociations().AssociatedFace(cell.local_id_, f);
 
       //========================= Compute penalty coefficient
       double hp = HPerpendicular(adj_cell, adj_fe_intgrl_values, fmap);
@@ -17,7 +17,7 @@ DiffusionSolver::DiffusionSolver(
   const chi_math::UnknownManager& uk_man,
   std::map<uint64_t, BoundaryCondition> bcs,
   MatID2XSMap map_mat_id_2_xs,
-  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  const UnitCellMatricesStore& unit_cell_matrices,
   const bool verbose,
   const bool requires_ghosts)
   : text_name_(std::move(text_name)),
@@ -31,7 +31,9 @@ DiffusionSolver::DiffusionSolver(
     num_global_dofs_(static_cast<int64_t>(sdm_.GetNumGlobalDOFs(uk_man_))),
     A_(nullptr),
     rhs_(nullptr),
+    x_(nullptr),
     ksp_(nullptr),
+    pc_matrix_(nullptr),
     requires_ghosts_(requires_ghosts)
 {
   options.verbose = verbose;
@@ -43,6 +45,7 @@ DiffusionSolver::~DiffusionSolver()
 {
   MatDestroy(&A_);
   VecDestroy(&rhs_);
+  VecDestroy(&x_);
   KSPDestroy(&ksp_);
 }
 
@@ -54,6 +57,11 @@ std::string DiffusionSolver::TextName() const { return text_name_; }
 /**Returns the right-hand side petsc vector.*/
 const Vec& DiffusionSolver::RHS() const { return rhs_; }
 
+// ###################################################################
+/**Returns the system matrix. For matrix-free solvers this is the MatShell
+ * applying the operator.*/
+const Mat& DiffusionSolver::SystemMatrix() const { return A_; }
+
 // ###################################################################
 /**Returns the assigned unknown structure.*/
 const chi_math::UnknownManager& DiffusionSolver::UnknownStructure() const
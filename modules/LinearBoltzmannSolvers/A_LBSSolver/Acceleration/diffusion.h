@@ -20,7 +20,7 @@ class SpatialDiscretization;
 
 namespace lbs
 {
-struct UnitCellMatrices;
+class UnitCellMatricesStore;
 }
 
 namespace lbs::acceleration
@@ -43,14 +43,16 @@ protected:
 
   const MatID2XSMap mat_id_2_xs_map_;
 
-  const std::vector<UnitCellMatrices>& unit_cell_matrices_;
+  const UnitCellMatricesStore& unit_cell_matrices_;
 
   const int64_t num_local_dofs_;
   const int64_t num_global_dofs_;
 
   Mat A_ = nullptr;
   Vec rhs_ = nullptr;
+  Vec x_ = nullptr; ///< Solution work vector, reused by every solve
   KSP ksp_ = nullptr;
+  Mat pc_matrix_ = nullptr; ///< Set when it differs from A_
 
   const bool requires_ghosts_;
 
@@ -66,6 +68,9 @@ public:
     std::string ref_solution_lua_function; ///< for mms
     std::string additional_options_string;
     double penalty_factor = 4.0;
+    /**MIP only. Applies the operator matrix-free and preconditions with an
+     * assembled low-order matrix holding only the volume and penalty terms.*/
+    bool matrix_free = false;
   } options;
 
 public:
@@ -74,12 +79,13 @@ public:
                   const chi_math::UnknownManager& uk_man,
                   std::map<uint64_t, BoundaryCondition> bcs,
                   MatID2XSMap map_mat_id_2_xs,
-                  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                  const UnitCellMatricesStore& unit_cell_matrices,
                   bool verbose,
                   bool requires_ghosts);
 
   std::string TextName() const;
   const Vec& RHS() const;
+  const Mat& SystemMatrix() const;
   const std::map<uint64_t, BoundaryCondition>& BCS() const {return bcs_;}
 
   const chi_math::UnknownManager& UnknownStructure() const;
@@ -89,15 +95,25 @@ public:
 
   virtual ~DiffusionSolver();
 
-  void Initialize();
+  virtual void Initialize();
+  void InitializeShared(DiffusionSolver& reference, bool share_preconditioner);
 
   virtual void AssembleAand_b(const std::vector<double>& q_vector) = 0;
   virtual void Assemble_b(const std::vector<double>& q_vector) = 0;
   virtual void Assemble_b(Vec petsc_q_vector) = 0;
   void AddToRHS(const std::vector<double>& values);
 
-  void Solve(std::vector<double>& solution, bool use_initial_guess=false);
-  void Solve(Vec petsc_solution, bool use_initial_guess=false);
+  virtual void Solve(std::vector<double>& solution,
+                     bool use_initial_guess=false);
+  virtual void Solve(Vec petsc_solution, bool use_initial_guess=false);
+
+protected:
+  void InitializeKSP();
+  /**The matrix the preconditioner is built from.*/
+  Mat PreconditionerMatrix() const
+  {
+    return pc_matrix_ != nullptr ? pc_matrix_ : A_;
+  }
 };
 
 } // namespace lbs::acceleration
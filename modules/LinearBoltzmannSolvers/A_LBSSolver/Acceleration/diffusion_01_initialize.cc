@@ -53,10 +53,23 @@ void lbs::acceleration::DiffusionSolver::Initialize()
       static_cast<int64_t>(sdm_.GetNumGhostDOFs(uk_man_)),
       sdm_.GetGhostDOFIndices(uk_man_));
 
+  //============================================= Create solution work vector
+  // Kept for the lifetime of the solver so that repeated solves, i.e., one
+  // per inner or outer iteration, do not allocate.
+  VecDuplicate(rhs_, &x_);
+
   Chi::mpi.Barrier();
   Chi::log.Log() << "Done vector creation";
   Chi::mpi.Barrier();
 
+  InitializeKSP();
+}
+
+// ###################################################################
+/**Creates the KSP solver and sets the BoomerAMG preconditioner
+ * parameters.*/
+void lbs::acceleration::DiffusionSolver::InitializeKSP()
+{
   //============================================= Create KSP
   KSPCreate(PETSC_COMM_WORLD, &ksp_);
   KSPSetOptionsPrefix(ksp_, text_name_.c_str());
@@ -93,4 +106,52 @@ void lbs::acceleration::DiffusionSolver::Initialize()
 
   PCSetFromOptions(pc);
   KSPSetFromOptions(ksp_);
+}
+
+// ###################################################################
+/**Initializes the diffusion solver from an assembled reference solver on
+ * the same discretization and unknown structure. The matrix shares the
+ * nonzero structure of the reference matrix, i.e., only the values are
+ * stored, and must still be assembled with `AssembleAand_b`.
+ *
+ * When `share_preconditioner` is set, the KSP of the reference solver is
+ * used as well, with the preconditioner built from the reference matrix. The
+ * operator is re-attached before every solve and, since the preconditioner
+ * matrix does not change, the preconditioner is set up only once for all
+ * solvers sharing it. Otherwise a KSP with its own preconditioner is
+ * created.*/
+void lbs::acceleration::DiffusionSolver::InitializeShared(
+  DiffusionSolver& reference, bool share_preconditioner)
+{
+  ChiLogicalErrorIf(reference.A_ == nullptr or reference.ksp_ == nullptr,
+                    "Reference solver \"" + reference.text_name_ +
+                      "\" is not initialized.");
+  ChiInvalidArgumentIf(reference.num_local_dofs_ != num_local_dofs_,
+                       "Reference solver \"" + reference.text_name_ +
+                         "\" has a different number of local DOFs.");
+
+  PetscBool assembled = PETSC_FALSE;
+  MatAssembled(reference.A_, &assembled);
+  ChiLogicalErrorIf(assembled == PETSC_FALSE,
+                    "Reference solver \"" + reference.text_name_ +
+                      "\" must be assembled before its structure is shared.");
+
+  if (options.verbose)
+    Chi::log.Log() << text_name_ << ": Initializing PETSc items shared with "
+                   << reference.text_name_;
+
+  MatDuplicate(reference.A_, MAT_SHARE_NONZERO_PATTERN, &A_);
+  VecDuplicate(reference.rhs_, &rhs_);
+  VecDuplicate(reference.rhs_, &x_);
+
+  if (share_preconditioner)
+  {
+    ksp_ = reference.ksp_;
+    PetscObjectReference(reinterpret_cast<PetscObject>(ksp_));
+
+    reference.pc_matrix_ = reference.A_;
+    pc_matrix_ = reference.A_;
+  }
+  else
+    InitializeKSP();
 }
\ No newline at end of file
@@ -18,9 +18,11 @@ void lbs::acceleration::DiffusionSolver::Solve(
   std::vector<double>& solution, bool use_initial_guess /*=false*/)
 {
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::Solve";
-  Vec x;
-  VecDuplicate(rhs_, &x);
-  VecSet(x, 0.0);
+  Vec x = x_;
+  if (not use_initial_guess) VecSet(x, 0.0);
+
+  // A shared KSP holds the operator of the last solver that used it
+  if (pc_matrix_ != nullptr) KSPSetOperators(ksp_, A_, pc_matrix_);
 
   if (not use_initial_guess) KSPSetInitialGuessNonzero(ksp_, PETSC_FALSE);
   else
@@ -90,9 +92,6 @@ void lbs::acceleration::DiffusionSolver::Solve(
   }
   else
     sdm_.LocalizePETScVector(x, solution, uk_man_);
-
-  //============================================= Cleanup x
-  VecDestroy(&x);
 }
 
 // ###################################################################
@@ -105,9 +104,11 @@ void lbs::acceleration::DiffusionSolver::Solve(
   Vec petsc_solution, bool use_initial_guess /*=false*/)
 {
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::Solve";
-  Vec x;
-  VecDuplicate(rhs_, &x);
-  VecSet(x, 0.0);
+  Vec x = x_;
+  if (not use_initial_guess) VecSet(x, 0.0);
+
+  // A shared KSP holds the operator of the last solver that used it
+  if (pc_matrix_ != nullptr) KSPSetOperators(ksp_, A_, pc_matrix_);
 
   if (not use_initial_guess) KSPSetInitialGuessNonzero(ksp_, PETSC_FALSE);
   else
@@ -163,7 +164,4 @@ void lbs::acceleration::DiffusionSolver::Solve(
   //============================================= Transfer petsc solution to
   //                                              vector
   VecCopy(x, petsc_solution);
-
-  //============================================= Cleanup x
-  VecDestroy(&x);
 }
\ No newline at end of file
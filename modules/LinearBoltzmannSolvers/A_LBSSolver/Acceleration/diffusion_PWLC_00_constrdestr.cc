@@ -11,7 +11,7 @@ DiffusionPWLCSolver::DiffusionPWLCSolver(
   const chi_math::UnknownManager& uk_man,
   std::map<uint64_t, BoundaryCondition> bcs,
   MatID2XSMap map_mat_id_2_xs,
-  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  const UnitCellMatricesStore& unit_cell_matrices,
   bool verbose)
   : DiffusionSolver(std::move(text_name),
                     sdm,
@@ -3,7 +3,7 @@
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "math/SpatialDiscretization/spatial_discretization.h"
 
-#include "A_LBSSolver/lbs_structs.h"
+#include "A_LBSSolver/lbs_unit_cell_matrices.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
@@ -46,11 +46,10 @@ void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
     const auto& cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
     const auto cc_nodes = cell_mapping.GetNodeLocations();
-    const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
 
-    const auto& cell_K_matrix = unit_cell_matrices.K_matrix;
-    const auto& cell_M_matrix = unit_cell_matrices.M_matrix;
-    const auto& cell_Vi = unit_cell_matrices.Vi_vectors;
+    const auto cell_K_matrix = unit_cell_matrices.K();
+    const auto cell_M_matrix = unit_cell_matrices.M();
 
     const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
 
@@ -117,8 +116,8 @@ void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
         const auto& face = cell.faces_[f];
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
 
-        const auto& face_M = unit_cell_matrices.face_M_matrices[f];
-        const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
+        const auto face_M = unit_cell_matrices.FaceM(f);
+        const auto face_Si = unit_cell_matrices.FaceSi(f);
 
         if (not face.has_neighbor_)
         {
@@ -205,7 +204,7 @@ void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
       throw std::logic_error(fname + ":Symmetry check failed");
   }
 
-  KSPSetOperators(ksp_, A_, A_);
+  KSPSetOperators(ksp_, A_, PreconditionerMatrix());
 
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString()
@@ -8,7 +8,7 @@
 
 #include "physics/PhysicsMaterial/MultiGroupXS/multigroup_xs.h"
 
-#include "LinearBoltzmannSolvers/A_LBSSolver/lbs_structs.h"
+#include "LinearBoltzmannSolvers/A_LBSSolver/lbs_unit_cell_matrices.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
@@ -50,11 +50,10 @@ void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(
     const auto& cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
     const auto cc_nodes = cell_mapping.GetNodeLocations();
-    const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
 
-    const auto& cell_K_matrix = unit_cell_matrices.K_matrix;
-    const auto& cell_M_matrix = unit_cell_matrices.M_matrix;
-    const auto& cell_Vi = unit_cell_matrices.Vi_vectors;
+    const auto cell_K_matrix = unit_cell_matrices.K();
+    const auto cell_M_matrix = unit_cell_matrices.M();
 
     const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
 
@@ -117,7 +116,7 @@ void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(
         const auto& face = cell.faces_[f];
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
 
-        const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
+        const auto face_Si = unit_cell_matrices.FaceSi(f);
 
         if (not face.has_neighbor_)
         {
@@ -199,10 +198,10 @@ void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(Vec petsc_q_vector)
     const auto& cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes = cell_mapping.NumNodes();
     const auto cc_nodes = cell_mapping.GetNodeLocations();
-    const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
 
-    const auto& cell_M_matrix = unit_cell_matrices.M_matrix;
-    const auto& cell_Vi = unit_cell_matrices.Vi_vectors;
+    const auto cell_M_matrix = unit_cell_matrices.M();
+    const auto cell_Vi = unit_cell_matrices.Vi();
 
     //=========================================== Mark dirichlet nodes
     std::vector<bool> node_is_dirichlet(num_nodes, false);
@@ -247,7 +246,7 @@ void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(Vec petsc_q_vector)
         const auto& face = cell.faces_[f];
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
 
-        const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
+        const auto face_Si = unit_cell_matrices.FaceSi(f);
 
         if (not face.has_neighbor_)
         {
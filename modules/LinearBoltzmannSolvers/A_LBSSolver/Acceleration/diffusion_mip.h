@@ -19,7 +19,7 @@ namespace chi_math
 
 namespace lbs
 {
-  struct UnitCellMatrices;
+  class UnitCellMatricesStore;
 }
 
 //############################################### Namespace lbs::acceleration
@@ -30,6 +30,36 @@ namespace lbs::acceleration
  * of Bruno Turcksin and Jean Ragusa.*/
 class DiffusionMIPSolver : public lbs::acceleration::DiffusionSolver
 {
+protected:
+  /**Face data of the matrix-free operator. DOF indices refer to the local
+   * form of the ghosted work vectors and are stored per node, with the
+   * groups contiguous.*/
+  struct MatrixFreeFace
+  {
+    enum class Kind {INTERIOR, DIRICHLET, ROBIN, NONE} kind = Kind::NONE;
+    std::vector<int> face_nodes;       ///< Cell nodes on the face
+    std::vector<int> adj_face_nodes;   ///< Matching nodes of the neighbor
+    std::vector<int64_t> adj_dofs;     ///< [fi*num_groups + g], interior
+    std::vector<double> kappa;         ///< [g], interior and Dirichlet
+    double robin_coeff = 0.0;          ///< a/b for Robin boundaries
+  };
+
+  /**Data cached by InitializeMatrixFree, such that the operator is applied
+   * without any mapping, node matching or cross section lookups.*/
+  struct MatrixFreeData
+  {
+    std::vector<int64_t> ghost_ids;
+    std::vector<size_t> cell_dof_offsets; ///< Into cell_dofs, per cell
+    std::vector<int64_t> cell_dofs;       ///< [i*num_groups + g]
+    std::vector<size_t> cell_face_offsets;///< Into faces, per cell
+    std::vector<MatrixFreeFace> faces;
+    std::vector<const Multigroup_D_and_sigR*> cell_xs;
+  } mf_data_;
+
+  Mat lo_matrix_ = nullptr; ///< Low-order preconditioner, matrix-free only
+  Vec xg_ = nullptr;        ///< Ghosted work vectors, matrix-free only
+  Vec yg_ = nullptr;
+
 public:
   //00
   DiffusionMIPSolver(std::string text_name,
@@ -37,9 +67,13 @@ public:
                      const chi_math::UnknownManager& uk_man,
                      std::map<uint64_t, BoundaryCondition> bcs,
                      MatID2XSMap map_mat_id_2_xs,
-                     const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                     const UnitCellMatricesStore& unit_cell_matrices,
                      bool verbose);
 
+  //01
+  void Initialize() override;
+  void InitializeMatrixFree();
+
   //02a
   void AssembleAand_b_wQpoints(const std::vector<double>& q_vector);
   //02b
@@ -51,6 +85,10 @@ public:
   void Assemble_b(const std::vector<double>& q_vector) override;
   void Assemble_b(Vec petsc_q_vector) override;
 
+  //02e
+  void AssembleAand_b_MatrixFree(const std::vector<double>& q_vector);
+  void ApplyMatrixFree(Vec x, Vec y);
+
   //05
   double HPerpendicular(const chi_mesh::Cell& cell, unsigned int f);
 
@@ -65,7 +103,7 @@ public:
   double CallLuaXYZFunction(lua_State* L, const std::string& lua_func_name,
                             const chi_mesh::Vector3& xyz);
 
-  virtual ~DiffusionMIPSolver() = default;
+  ~DiffusionMIPSolver() override;
 };
 
 }//namespace lbs::acceleration
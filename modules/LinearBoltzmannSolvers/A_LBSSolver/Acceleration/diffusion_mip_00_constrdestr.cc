@@ -12,7 +12,7 @@ lbs::acceleration::DiffusionMIPSolver::DiffusionMIPSolver(
   const chi_math::UnknownManager& uk_man,
   std::map<uint64_t, BoundaryCondition> bcs,
   MatID2XSMap map_mat_id_2_xs,
-  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  const UnitCellMatricesStore& unit_cell_matrices,
   const bool verbose /*=false*/)
   : DiffusionSolver(std::move(text_name),
                     sdm,
@@ -30,3 +30,12 @@ lbs::acceleration::DiffusionMIPSolver::DiffusionMIPSolver(
     throw std::logic_error("lbs::acceleration::DiffusionMIPSolver: can only be"
                            " used with PWLD.");
 }
+
+// ###################################################################
+/**Default destructor.*/
+lbs::acceleration::DiffusionMIPSolver::~DiffusionMIPSolver()
+{
+  MatDestroy(&lo_matrix_);
+  VecDestroy(&xg_);
+  VecDestroy(&yg_);
+}
@@ -0,0 +1,245 @@
+#include "diffusion_mip.h"
+#include "acceleration.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/spatial_discretization.h"
+#include "math/PETScUtils/petsc_utils.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <algorithm>
+
+#define DefaultBCDirichlet BoundaryCondition{BCType::DIRICHLET,{0,0,0}}
+
+namespace
+{
+
+/**MatShell multiplication of the matrix-free MIP operator.*/
+PetscErrorCode MatrixFreeAction(Mat A, Vec x, Vec y)
+{
+  void* context;
+  MatShellGetContext(A, &context);
+  static_cast<lbs::acceleration::DiffusionMIPSolver*>(context)
+    ->ApplyMatrixFree(x, y);
+  return 0;
+}
+
+} // namespace
+
+//###################################################################
+/**Initializes the solver with either an assembled or a matrix-free
+ * operator, depending on `options.matrix_free`.*/
+void lbs::acceleration::DiffusionMIPSolver::Initialize()
+{
+  if (options.matrix_free) InitializeMatrixFree();
+  else DiffusionSolver::Initialize();
+}
+
+//###################################################################
+/**Initializes the matrix-free form of the solver. The operator is a
+ * MatShell applied by ApplyMatrixFree. For this, the DOF indices of every
+ * cell, the matching neighbor nodes of every face and the penalty
+ * coefficients are computed once here. The preconditioner is built from an
+ * assembled low-order matrix, containing the volume and penalty terms of the
+ * MIP operator but not its consistency (gradient) terms. Its sparsity
+ * couples a node only to the nodes of its own cell and to the neighbor
+ * nodes of the faces it is on.*/
+void lbs::acceleration::DiffusionMIPSolver::InitializeMatrixFree()
+{
+  if (options.verbose)
+    Chi::log.Log() << text_name_ << ": Initializing matrix-free PETSc items";
+
+  ChiInvalidArgumentIf(options.perform_symmetry_check,
+                       "The symmetry check needs an assembled operator.");
+
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  // Penalty coefficient as in AssembleAand_b, with Dh the diffusion
+  // coefficient over the perpendicular length
+  auto Kappa = [this](const chi_mesh::Cell& cell, double Dh)
+  {
+    double kappa = 1.0;
+    if (cell.Type() == chi_mesh::CellType::SLAB)
+      kappa = fmax(options.penalty_factor*Dh,0.25);
+    if (cell.Type() == chi_mesh::CellType::POLYGON)
+      kappa = fmax(options.penalty_factor*Dh,0.25);
+    if (cell.Type() == chi_mesh::CellType::POLYHEDRON)
+      kappa = fmax(options.penalty_factor*2.0*Dh,0.25);
+    return kappa;
+  };
+
+  //============================================= Ghost DOFs
+  // The DOFs of the neighbor face nodes on other locations
+  std::vector<int64_t> ghost_ids;
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      if (not face.has_neighbor_ or face.IsNeighborLocal(grid_)) continue;
+
+      const auto& adj_cell = grid_.cells[face.neighbor_id_];
+      const auto& adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
+      const size_t acf =
+        grid_.FaceAssociations().AssociatedFace(cell.local_id_, f);
+      for (size_t fj = 0; fj < cell_mapping.NumFaceNodes(f); ++fj)
+      {
+        const int jp = adj_cell_mapping.MapFaceNode(acf, fj);
+        for (size_t g = 0; g < num_groups; ++g)
+          ghost_ids.push_back(sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g));
+      }
+    }
+  }
+  std::sort(ghost_ids.begin(), ghost_ids.end());
+  ghost_ids.erase(std::unique(ghost_ids.begin(), ghost_ids.end()),
+                  ghost_ids.end());
+
+  auto GhostLocalIndex = [this, &ghost_ids](int64_t global_id)
+  {
+    const auto it =
+      std::lower_bound(ghost_ids.begin(), ghost_ids.end(), global_id);
+    return num_local_dofs_ + static_cast<int64_t>(it - ghost_ids.begin());
+  };
+
+  //============================================= Cell and face data
+  auto& data = mf_data_;
+  data = MatrixFreeData();
+  data.cell_dof_offsets.reserve(grid_.local_cells.size() + 1);
+  data.cell_face_offsets.reserve(grid_.local_cells.size() + 1);
+
+  std::vector<int64_t> nnz_in_diag(num_local_dofs_, 0);
+  std::vector<int64_t> nnz_off_diag(num_local_dofs_, 0);
+
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
+    const auto cc_nodes = cell_mapping.GetNodeLocations();
+    const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
+
+    data.cell_xs.push_back(&xs);
+    data.cell_dof_offsets.push_back(data.cell_dofs.size());
+    data.cell_face_offsets.push_back(data.faces.size());
+
+    for (size_t i = 0; i < num_nodes; ++i)
+      for (size_t g = 0; g < num_groups; ++g)
+      {
+        const int64_t ir = sdm_.MapDOFLocal(cell, i, uk_man_, 0, g);
+        data.cell_dofs.push_back(ir);
+        nnz_in_diag[ir] += static_cast<int64_t>(num_nodes);
+      }
+
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+      const double hm = HPerpendicular(cell, f);
+
+      MatrixFreeFace mf_face;
+      for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        mf_face.face_nodes.push_back(cell_mapping.MapFaceNode(f, fi));
+
+      if (face.has_neighbor_)
+      {
+        const auto& adj_cell = grid_.cells[face.neighbor_id_];
+        const auto& adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
+        const auto ac_nodes = adj_cell_mapping.GetNodeLocations();
+        const size_t acf =
+          grid_.FaceAssociations().AssociatedFace(cell.local_id_, f);
+        const double hp = HPerpendicular(adj_cell, acf);
+        const auto& adj_xs = mat_id_2_xs_map_.at(adj_cell.material_id_);
+        const bool is_local = face.IsNeighborLocal(grid_);
+
+        mf_face.kind = MatrixFreeFace::Kind::INTERIOR;
+        for (size_t g = 0; g < num_groups; ++g)
+          mf_face.kappa.push_back(
+            Kappa(cell, (adj_xs.Dg[g] / hp + xs.Dg[g] / hm) * 0.5));
+
+        for (size_t fj = 0; fj < num_face_nodes; ++fj)
+        {
+          const int jp =
+            MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj);
+          mf_face.adj_face_nodes.push_back(jp);
+          for (size_t g = 0; g < num_groups; ++g)
+            mf_face.adj_dofs.push_back(
+              is_local ? sdm_.MapDOFLocal(adj_cell, jp, uk_man_, 0, g)
+                       : GhostLocalIndex(
+                           sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g)));
+        }
+
+        // Penalty coupling of the face nodes to the neighbor face nodes
+        auto& nnz = is_local ? nnz_in_diag : nnz_off_diag;
+        for (int i : mf_face.face_nodes)
+          for (size_t g = 0; g < num_groups; ++g)
+            nnz[sdm_.MapDOFLocal(cell, i, uk_man_, 0, g)] +=
+              static_cast<int64_t>(num_face_nodes);
+      }
+      else
+      {
+        auto bc = DefaultBCDirichlet;
+        if (bcs_.count(face.neighbor_id_) > 0)
+          bc = bcs_.at(face.neighbor_id_);
+
+        if (bc.type == BCType::DIRICHLET)
+        {
+          mf_face.kind = MatrixFreeFace::Kind::DIRICHLET;
+          for (size_t g = 0; g < num_groups; ++g)
+            mf_face.kappa.push_back(Kappa(cell, xs.Dg[g] / hm));
+        }
+        else if (bc.type == BCType::ROBIN)
+        {
+          const double aval = bc.values[0];
+          const double bval = bc.values[1];
+          if (std::fabs(bval) >= 1.0e-12 and std::fabs(aval) >= 1.0e-12)
+          {
+            mf_face.kind = MatrixFreeFace::Kind::ROBIN;
+            mf_face.robin_coeff = aval / bval;
+          }
+        }
+      }
+      data.faces.push_back(std::move(mf_face));
+    }//for face
+  }//for cell
+  data.cell_dof_offsets.push_back(data.cell_dofs.size());
+  data.cell_face_offsets.push_back(data.faces.size());
+  data.ghost_ids = ghost_ids;
+
+  //============================================= Create operator
+  MatCreateShell(PETSC_COMM_WORLD,
+                 num_local_dofs_,
+                 num_local_dofs_,
+                 num_global_dofs_,
+                 num_global_dofs_,
+                 this,
+                 &A_);
+  MatShellSetOperation(A_, MATOP_MULT, (void (*)())MatrixFreeAction);
+
+  //============================================= Create low-order matrix
+  lo_matrix_ =
+    chi_math::PETScUtils::CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
+  chi_math::PETScUtils::InitMatrixSparsity(
+    lo_matrix_, nnz_in_diag, nnz_off_diag);
+  pc_matrix_ = lo_matrix_;
+
+  //============================================= Create vectors
+  rhs_ = chi_math::PETScUtils::CreateVector(num_local_dofs_, num_global_dofs_);
+  VecDuplicate(rhs_, &x_);
+
+  const auto num_ghosts = static_cast<int64_t>(ghost_ids.size());
+  xg_ = chi_math::PETScUtils::CreateVectorWithGhosts(
+    num_local_dofs_, num_global_dofs_, num_ghosts, ghost_ids);
+  VecDuplicate(xg_, &yg_);
+
+  InitializeKSP();
+
+  int64_t num_lo_nonzeros = 0;
+  for (size_t k = 0; k < nnz_in_diag.size(); ++k)
+    num_lo_nonzeros += nnz_in_diag[k] + nnz_off_diag[k];
+
+  Chi::log.Log() << text_name_ << ": Matrix-free operator with a low-order "
+                 << "preconditioner of " << num_lo_nonzeros
+                 << " local non-zeros";
+}
@@ -26,6 +26,8 @@ void lbs::acceleration::DiffusionMIPSolver::
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
     throw std::logic_error(fname + ": Some or all PETSc elements are null. "
                                    "Check that Initialize has been called.");
+  ChiLogicalErrorIf(options.matrix_free,
+                    "Not available with a matrix-free operator.");
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString() << " Starting assembly";
 
@@ -108,14 +110,13 @@ void lbs::acceleration::DiffusionMIPSolver::
 
         const double hm = HPerpendicular(cell, f);
 
-        typedef chi_mesh::MeshContinuum Grid;
-
         if (face.has_neighbor_)
         {
           const auto&  adj_cell         = grid_.cells[face.neighbor_id_];
           const auto&  adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
           const auto   ac_nodes         = adj_cell_mapping.GetNodeLocations();
-          const size_t acf              = Grid::MapCellFace(cell, adj_cell, f);
+          const size_t acf              =
+            grid_.FaceAssociations().AssociatedFace(cell.local_id_, f);
           const double hp               = HPerpendicular(adj_cell, acf);
 
           const auto&  adj_xs   = mat_id_2_xs_map_.at(adj_cell.material_id_);
@@ -366,7 +367,7 @@ void lbs::acceleration::DiffusionMIPSolver::
       throw std::logic_error(fname + ":Symmetry check failed");
   }
 
-  KSPSetOperators(ksp_, A_, A_);
+  KSPSetOperators(ksp_, A_, PreconditionerMatrix());
 
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString() << " Assembly completed";
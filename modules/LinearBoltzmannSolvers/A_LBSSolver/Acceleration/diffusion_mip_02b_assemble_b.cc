@@ -215,7 +215,7 @@ void lbs::acceleration::DiffusionMIPSolver::
   VecAssemblyBegin(rhs_);
   VecAssemblyEnd(rhs_);
 
-  KSPSetOperators(ksp_, A_, A_);
+  KSPSetOperators(ksp_, A_, PreconditionerMatrix());
 
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString() << " Assembly completed";
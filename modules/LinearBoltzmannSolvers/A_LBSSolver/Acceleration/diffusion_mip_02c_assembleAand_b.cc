@@ -8,7 +8,7 @@
 
 #include "physics/PhysicsMaterial/MultiGroupXS/multigroup_xs.h"
 
-#include "A_LBSSolver/lbs_structs.h"
+#include "A_LBSSolver/lbs_unit_cell_matrices.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
@@ -28,6 +28,11 @@ void lbs::acceleration::DiffusionMIPSolver::
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
     throw std::logic_error(fname + ": Some or all PETSc elements are null. "
                                    "Check that Initialize has been called.");
+  if (options.matrix_free)
+  {
+    AssembleAand_b_MatrixFree(q_vector);
+    return;
+  }
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString() << " Starting assembly";
 
@@ -40,10 +45,10 @@ void lbs::acceleration::DiffusionMIPSolver::
     const auto&  cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes    = cell_mapping.NumNodes();
     const auto   cc_nodes     = cell_mapping.GetNodeLocations();
-    const auto&  unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto   unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
 
-    const auto& cell_K_matrix = unit_cell_matrices.K_matrix;
-    const auto& cell_M_matrix = unit_cell_matrices.M_matrix;
+    const auto cell_K_matrix = unit_cell_matrices.K();
+    const auto cell_M_matrix = unit_cell_matrices.M();
 
     const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
 
@@ -85,20 +90,19 @@ void lbs::acceleration::DiffusionMIPSolver::
         const auto&  n_f            = face.normal_;
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
 
-        const auto& face_M = unit_cell_matrices.face_M_matrices[f];
-        const auto& face_G = unit_cell_matrices.face_G_matrices[f];
-        const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
+        const auto face_M = unit_cell_matrices.FaceM(f);
+        const auto face_G = unit_cell_matrices.FaceG(f);
+        const auto face_Si = unit_cell_matrices.FaceSi(f);
 
         const double hm = HPerpendicular(cell, f);
 
-        typedef chi_mesh::MeshContinuum Grid;
-
         if (face.has_neighbor_)
         {
           const auto&  adj_cell         = grid_.cells[face.neighbor_id_];
           const auto&  adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
           const auto   ac_nodes         = adj_cell_mapping.GetNodeLocations();
-          const size_t acf              = Grid::MapCellFace(cell, adj_cell, f);
+          const size_t acf              =
+            grid_.FaceAssociations().AssociatedFace(cell.local_id_, f);
           const double hp               = HPerpendicular(adj_cell, acf);
 
           const auto&  adj_xs   = mat_id_2_xs_map_.at(adj_cell.material_id_);
@@ -305,7 +309,7 @@ void lbs::acceleration::DiffusionMIPSolver::
       throw std::logic_error(fname + ":Symmetry check failed");
   }
 
-  KSPSetOperators(ksp_, A_, A_);
+  KSPSetOperators(ksp_, A_, PreconditionerMatrix());
 
   if (options.verbose)
     Chi::log.Log() << Chi::program_timer.GetTimeString() << " Assembly completed";
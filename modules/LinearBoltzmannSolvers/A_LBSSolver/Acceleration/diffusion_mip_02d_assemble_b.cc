@@ -8,7 +8,7 @@
 
 #include "physics/PhysicsMaterial/MultiGroupXS/multigroup_xs.h"
 
-#include "LinearBoltzmannSolvers/A_LBSSolver/lbs_structs.h"
+#include "LinearBoltzmannSolvers/A_LBSSolver/lbs_unit_cell_matrices.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
@@ -40,9 +40,9 @@ void lbs::acceleration::DiffusionMIPSolver::
     const auto&  cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes    = cell_mapping.NumNodes();
     const auto   cc_nodes     = cell_mapping.GetNodeLocations();
-    const auto&  unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto   unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
 
-    const auto& cell_M_matrix = unit_cell_matrices.M_matrix;
+    const auto cell_M_matrix = unit_cell_matrices.M();
 
     const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
 
@@ -73,9 +73,9 @@ void lbs::acceleration::DiffusionMIPSolver::
         const auto&  n_f            = face.normal_;
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
 
-        const auto& face_M = unit_cell_matrices.face_M_matrices[f];
-        const auto& face_G = unit_cell_matrices.face_G_matrices[f];
-        const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
+        const auto face_M = unit_cell_matrices.FaceM(f);
+        const auto face_G = unit_cell_matrices.FaceG(f);
+        const auto face_Si = unit_cell_matrices.FaceSi(f);
 
         const double hm = HPerpendicular(cell, f);
 
@@ -191,9 +191,9 @@ Assemble_b(Vec petsc_q_vector)
     const auto&  cell_mapping = sdm_.GetCellMapping(cell);
     const size_t num_nodes    = cell_mapping.NumNodes();
     const auto   cc_nodes     = cell_mapping.GetNodeLocations();
-    const auto&  unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto   unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
 
-    const auto& cell_M_matrix = unit_cell_matrices.M_matrix;
+    const auto cell_M_matrix = unit_cell_matrices.M();
 
     const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
 
@@ -224,9 +224,9 @@ Assemble_b(Vec petsc_q_vector)
         const auto&  n_f            = face.normal_;
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
 
-        const auto& face_M = unit_cell_matrices.face_M_matrices[f];
-        const auto& face_G = unit_cell_matrices.face_G_matrices[f];
-        const auto& face_Si = unit_cell_matrices.face_Si_vectors[f];
+        const auto face_M = unit_cell_matrices.FaceM(f);
+        const auto face_G = unit_cell_matrices.FaceG(f);
+        const auto face_Si = unit_cell_matrices.FaceSi(f);
 
         const double hm = HPerpendicular(cell, f);
 
@@ -0,0 +1,308 @@
+#include "diffusion_mip.h"
+#include "acceleration.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/spatial_discretization.h"
+
+#include "A_LBSSolver/lbs_unit_cell_matrices.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "utils/chi_timer.h"
+
+//###################################################################
+/**Assembles the low-order preconditioner matrix and the RHS for the
+ * matrix-free form of the solver. The low-order matrix holds the volume and
+ * penalty terms of the MIP operator, which makes it symmetric positive
+ * definite with a much smaller stencil than the full operator.*/
+void lbs::acceleration::DiffusionMIPSolver::
+  AssembleAand_b_MatrixFree(const std::vector<double>& q_vector)
+{
+  const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
+                            "AssembleAand_b_MatrixFree";
+  if (lo_matrix_ == nullptr or xg_ == nullptr or ksp_ == nullptr)
+    throw std::logic_error(fname + ": Some or all PETSc elements are null. "
+                                   "Check that Initialize has been called.");
+  if (options.verbose)
+    Chi::log.Log() << Chi::program_timer.GetTimeString() << " Starting assembly";
+
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+  const auto& data = mf_data_;
+
+  size_t lc = 0;
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
+    const auto unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+
+    const auto cell_K_matrix = unit_cell_matrices.K();
+    const auto cell_M_matrix = unit_cell_matrices.M();
+
+    const auto& xs = *data.cell_xs[lc];
+
+    for (size_t g = 0; g < num_groups; ++g)
+    {
+      const double Dg = xs.Dg[g];
+      const double sigr_g = xs.sigR[g];
+
+      //==================================== Assemble continuous terms
+      for (size_t i = 0; i < num_nodes; i++)
+      {
+        const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+        for (size_t j = 0; j < num_nodes; j++)
+        {
+          const int64_t jmap = sdm_.MapDOF(cell, j, uk_man_, 0, g);
+          const double entry_aij =
+            Dg * cell_K_matrix[i][j] + sigr_g * cell_M_matrix[i][j];
+          MatSetValue(lo_matrix_, imap, jmap, entry_aij, ADD_VALUES);
+        }//for j
+      }//for i
+
+      //==================================== Assemble penalty terms
+      for (size_t f = 0; f < cell.faces_.size(); ++f)
+      {
+        const auto& mf_face = data.faces[data.cell_face_offsets[lc] + f];
+        const auto face_M = unit_cell_matrices.FaceM(f);
+        const size_t num_face_nodes = mf_face.face_nodes.size();
+
+        using Kind = MatrixFreeFace::Kind;
+        if (mf_face.kind == Kind::INTERIOR)
+        {
+          const auto& adj_cell = grid_.cells[cell.faces_[f].neighbor_id_];
+          const double kappa = mf_face.kappa[g];
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = mf_face.face_nodes[fi];
+            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int jm = mf_face.face_nodes[fj];
+              const int jp = mf_face.adj_face_nodes[fj];
+              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
+              const int64_t jpmap = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, g);
+
+              const double aij = kappa * face_M[i][jm];
+              MatSetValue(lo_matrix_, imap, jmmap, aij, ADD_VALUES);
+              MatSetValue(lo_matrix_, imap, jpmap, -aij, ADD_VALUES);
+            }//for fj
+          }//for fi
+        }
+        else if (mf_face.kind == Kind::DIRICHLET or mf_face.kind == Kind::ROBIN)
+        {
+          const double coeff = mf_face.kind == Kind::DIRICHLET
+                                 ? mf_face.kappa[g]
+                                 : mf_face.robin_coeff;
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = mf_face.face_nodes[fi];
+            const int64_t imap = sdm_.MapDOF(cell, i, uk_man_, 0, g);
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int jm = mf_face.face_nodes[fj];
+              const int64_t jmmap = sdm_.MapDOF(cell, jm, uk_man_, 0, g);
+              MatSetValue(
+                lo_matrix_, imap, jmmap, coeff * face_M[i][jm], ADD_VALUES);
+            }//for fj
+          }//for fi
+        }
+      }//for face
+    }//for g
+    ++lc;
+  }//for cell
+
+  MatAssemblyBegin(lo_matrix_, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(lo_matrix_, MAT_FINAL_ASSEMBLY);
+
+  //============================================= Assemble RHS
+  Assemble_b(q_vector);
+
+  KSPSetOperators(ksp_, A_, PreconditionerMatrix());
+
+  if (options.verbose)
+    Chi::log.Log() << Chi::program_timer.GetTimeString() << " Assembly completed";
+
+  PC pc;
+  KSPGetPC(ksp_, &pc);
+  PCSetUp(pc);
+
+  KSPSetUp(ksp_);
+}
+
+//###################################################################
+/**Computes y = A x with the MIP operator, without a matrix. The terms are
+ * those of AssembleAand_b, evaluated with the cached DOF indices and penalty
+ * coefficients. Contributions to the rows of off-location neighbor nodes are
+ * accumulated in the ghost entries and added to their owners afterwards.*/
+void lbs::acceleration::DiffusionMIPSolver::ApplyMatrixFree(Vec x, Vec y)
+{
+  const size_t G = uk_man_.unknowns_.front().num_components_;
+  const auto& data = mf_data_;
+
+  //============================================= Gather ghosted x
+  VecCopy(x, xg_);
+  VecGhostUpdateBegin(xg_, INSERT_VALUES, SCATTER_FORWARD);
+  VecGhostUpdateEnd(xg_, INSERT_VALUES, SCATTER_FORWARD);
+
+  Vec x_local, y_local;
+  VecGhostGetLocalForm(xg_, &x_local);
+  VecGhostGetLocalForm(yg_, &y_local);
+  VecSet(y_local, 0.0);
+
+  const double* xv;
+  double* yv;
+  VecGetArrayRead(x_local, &xv);
+  VecGetArray(y_local, &yv);
+
+  std::vector<double> nG; // n dot face G, row-major
+  size_t lc = 0;
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto K = unit_cell_matrices.K();
+    const auto M = unit_cell_matrices.M();
+    const size_t n = K.size();
+    const int64_t* dofs = &data.cell_dofs[data.cell_dof_offsets[lc]];
+    const auto& xs = *data.cell_xs[lc];
+
+    //==================================== Volume terms
+    for (size_t i = 0; i < n; ++i)
+    {
+      const double* K_i = K[i];
+      const double* M_i = M[i];
+      for (size_t g = 0; g < G; ++g)
+      {
+        const double Dg = xs.Dg[g];
+        const double sigr_g = xs.sigR[g];
+        double value = 0.0;
+        for (size_t j = 0; j < n; ++j)
+          value += (Dg * K_i[j] + sigr_g * M_i[j]) * xv[dofs[j * G + g]];
+        yv[dofs[i * G + g]] += value;
+      }
+    }
+
+    //==================================== Face terms
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& mf_face = data.faces[data.cell_face_offsets[lc] + f];
+      using Kind = MatrixFreeFace::Kind;
+      if (mf_face.kind == Kind::NONE) continue;
+
+      const auto face_M = unit_cell_matrices.FaceM(f);
+      const size_t num_face_nodes = mf_face.face_nodes.size();
+      const int* face_nodes = mf_face.face_nodes.data();
+
+      if (mf_face.kind == Kind::ROBIN)
+      {
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const double aij = mf_face.robin_coeff *
+                               face_M[face_nodes[fi]][face_nodes[fj]];
+            for (size_t g = 0; g < G; ++g)
+              yv[dofs[face_nodes[fi] * G + g]] +=
+                aij * xv[dofs[face_nodes[fj] * G + g]];
+          }
+        continue;
+      }
+
+      // n dot face G, contiguous over the components
+      const auto face_G = unit_cell_matrices.FaceG(f);
+      const auto& n_f = cell.faces_[f].normal_;
+      const double* Gx = face_G.Component(0);
+      const double* Gy = face_G.Component(1);
+      const double* Gz = face_G.Component(2);
+      nG.resize(n * n);
+      for (size_t k = 0; k < n * n; ++k)
+        nG[k] = n_f.x * Gx[k] + n_f.y * Gy[k] + n_f.z * Gz[k];
+
+      if (mf_face.kind == Kind::INTERIOR)
+      {
+        const int64_t* adj_dofs = mf_face.adj_dofs.data();
+        for (size_t g = 0; g < G; ++g)
+        {
+          const double Dg = xs.Dg[g];
+          const double kappa = mf_face.kappa[g];
+
+          // Penalty terms
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = face_nodes[fi];
+            double value = 0.0;
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+              value += kappa * face_M[i][face_nodes[fj]] *
+                       (xv[dofs[face_nodes[fj] * G + g]] -
+                        xv[adj_dofs[fj * G + g]]);
+            yv[dofs[i * G + g]] += value;
+          }
+
+          // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+          for (size_t i = 0; i < n; ++i)
+          {
+            double value = 0.0;
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+            {
+              const int jm = face_nodes[fj];
+              value += -0.5 * Dg * nG[jm * n + i] *
+                       (xv[dofs[jm * G + g]] - xv[adj_dofs[fj * G + g]]);
+            }
+            yv[dofs[i * G + g]] += value;
+          }
+
+          // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int im = face_nodes[fi];
+            const double* nG_im = &nG[im * n];
+            double value = 0.0;
+            for (size_t j = 0; j < n; ++j)
+              value += -0.5 * Dg * nG_im[j] * xv[dofs[j * G + g]];
+            yv[dofs[im * G + g]] += value;
+            yv[adj_dofs[fi * G + g]] -= value;
+          }
+        }//for g
+      }
+      else if (mf_face.kind == Kind::DIRICHLET)
+      {
+        for (size_t g = 0; g < G; ++g)
+        {
+          const double Dg = xs.Dg[g];
+          const double kappa = mf_face.kappa[g];
+
+          // Penalty terms
+          for (size_t fi = 0; fi < num_face_nodes; ++fi)
+          {
+            const int i = face_nodes[fi];
+            double value = 0.0;
+            for (size_t fj = 0; fj < num_face_nodes; ++fj)
+              value += kappa * face_M[i][face_nodes[fj]] *
+                       xv[dofs[face_nodes[fj] * G + g]];
+            yv[dofs[i * G + g]] += value;
+          }
+
+          // D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+          for (size_t i = 0; i < n; ++i)
+          {
+            double value = 0.0;
+            for (size_t j = 0; j < n; ++j)
+              value += -Dg * (nG[j * n + i] + nG[i * n + j]) *
+                       xv[dofs[j * G + g]];
+            yv[dofs[i * G + g]] += value;
+          }
+        }//for g
+      }
+    }//for face
+    ++lc;
+  }//for cell
+
+  VecRestoreArrayRead(x_local, &xv);
+  VecRestoreArray(y_local, &yv);
+  VecGhostRestoreLocalForm(xg_, &x_local);
+  VecGhostRestoreLocalForm(yg_, &y_local);
+
+  //============================================= Add ghost contributions
+  VecGhostUpdateBegin(yg_, ADD_VALUES, SCATTER_REVERSE);
+  VecGhostUpdateEnd(yg_, ADD_VALUES, SCATTER_REVERSE);
+  VecCopy(yg_, y);
+}
@@ -0,0 +1,231 @@
+#include "diffusion_mip_batched.h"
+#include "acceleration.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/spatial_discretization.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace lbs::acceleration
+{
+
+// ###################################################################
+/**Default constructor.*/
+DiffusionMIPBatchedSolver::DiffusionMIPBatchedSolver(
+  std::string text_name,
+  const chi_math::SpatialDiscretization& sdm,
+  const chi_math::UnknownManager& uk_man,
+  std::map<uint64_t, BoundaryCondition> bcs,
+  MatID2XSMap map_mat_id_2_xs,
+  const UnitCellMatricesStore& unit_cell_matrices,
+  const bool verbose,
+  const bool share_preconditioner)
+  : DiffusionMIPSolver(std::move(text_name),
+                       sdm,
+                       uk_man,
+                       std::move(bcs),
+                       std::move(map_mat_id_2_xs),
+                       unit_cell_matrices,
+                       verbose),
+    share_preconditioner_(share_preconditioner)
+{
+  ChiInvalidArgumentIf(uk_man_.NumberOfUnknowns() != 1,
+                       "Only a single multi-group unknown is supported.");
+}
+
+// ###################################################################
+/**Selects the reference group and creates the per-group solvers. Only the
+ * solver of the reference group creates a matrix structure. The others share
+ * it once the reference group is assembled.*/
+void DiffusionMIPBatchedSolver::Initialize()
+{
+  ChiInvalidArgumentIf(options.matrix_free,
+                       "A matrix-free operator can not be batched.");
+
+  const size_t num_groups = uk_man_.unknowns_.front().num_components_;
+
+  //============================================= Select reference group
+  double min_ratio = std::numeric_limits<double>::max();
+  for (size_t g = 0; g < num_groups; ++g)
+  {
+    double group_ratio = std::numeric_limits<double>::max();
+    for (const auto& [mat_id, xs] : mat_id_2_xs_map_)
+      if (xs.Dg[g] > 0.0)
+        group_ratio = std::min(group_ratio, xs.sigR[g] / xs.Dg[g]);
+
+    if (group_ratio < min_ratio)
+    {
+      min_ratio = group_ratio;
+      reference_group_ = g;
+    }
+  }
+
+  //============================================= Create group solvers
+  const auto scalar_uk_man =
+    chi_math::UnknownManager::GetUnitaryUnknownManager();
+
+  group_solvers_.clear();
+  structure_shared_ = false;
+  group_solvers_.reserve(num_groups);
+  for (size_t g = 0; g < num_groups; ++g)
+  {
+    MatID2XSMap group_xs_map;
+    for (const auto& [mat_id, xs] : mat_id_2_xs_map_)
+      group_xs_map[mat_id] = {{xs.Dg[g]}, {xs.sigR[g]}};
+
+    auto solver = std::make_unique<DiffusionMIPSolver>(
+      text_name_ + "_g" + std::to_string(g),
+      sdm_,
+      scalar_uk_man,
+      bcs_,
+      std::move(group_xs_map),
+      unit_cell_matrices_,
+      options.verbose);
+    solver->options = options;
+    group_solvers_.push_back(std::move(solver));
+  }
+
+  group_solvers_[reference_group_]->Initialize();
+
+  group_vectors_.assign(
+    num_groups, std::vector<double>(sdm_.GetNumLocalDOFs(scalar_uk_man), 0.0));
+
+  Chi::log.Log() << text_name_ << ": Batched solve of " << num_groups
+                 << " groups with reference group " << reference_group_
+                 << (share_preconditioner_ ? " and a shared preconditioner"
+                                           : " and per-group preconditioners");
+}
+
+// ###################################################################
+/**Assembles the matrix and right-hand side of every group. The reference
+ * group is assembled first, after which the other groups share its matrix
+ * structure and, optionally, its preconditioner.*/
+void DiffusionMIPBatchedSolver::AssembleAand_b(
+  const std::vector<double>& q_vector)
+{
+  ChiLogicalErrorIf(group_solvers_.empty(),
+                    "Check that Initialize has been called.");
+
+  Split(q_vector);
+
+  auto& reference = *group_solvers_[reference_group_];
+  reference.AssembleAand_b(group_vectors_[reference_group_]);
+
+  for (size_t g = 0; g < group_solvers_.size(); ++g)
+  {
+    if (g == reference_group_) continue;
+    auto& solver = *group_solvers_[g];
+
+    if (not structure_shared_)
+      solver.InitializeShared(reference, share_preconditioner_);
+    solver.AssembleAand_b(group_vectors_[g]);
+  }
+  structure_shared_ = true;
+}
+
+// ###################################################################
+/**Assembles the right-hand side of every group.*/
+void DiffusionMIPBatchedSolver::Assemble_b(const std::vector<double>& q_vector)
+{
+  Split(q_vector);
+
+  for (size_t g = 0; g < group_solvers_.size(); ++g)
+    group_solvers_[g]->Assemble_b(group_vectors_[g]);
+}
+
+// ###################################################################
+/**Assembles the right-hand side of every group from the local entries of
+ * a PETSc vector.*/
+void DiffusionMIPBatchedSolver::Assemble_b(Vec petsc_q_vector)
+{
+  PetscInt num_local_entries;
+  VecGetLocalSize(petsc_q_vector, &num_local_entries);
+
+  const double* q_raw;
+  VecGetArrayRead(petsc_q_vector, &q_raw);
+  const std::vector<double> q_vector(q_raw, q_raw + num_local_entries);
+  VecRestoreArrayRead(petsc_q_vector, &q_raw);
+
+  Assemble_b(q_vector);
+}
+
+// ###################################################################
+/**Solves the group systems one after the other and stores the local
+ * solution in the multi-group vector provided.*/
+void DiffusionMIPBatchedSolver::Solve(std::vector<double>& solution,
+                                      bool use_initial_guess /*=false*/)
+{
+  if (use_initial_guess) Split(solution);
+
+  for (size_t g = 0; g < group_solvers_.size(); ++g)
+    group_solvers_[g]->Solve(group_vectors_[g], use_initial_guess);
+
+  solution.resize(sdm_.GetNumLocalDOFs(uk_man_), 0.0);
+  Merge(solution);
+}
+
+// ###################################################################
+/**Solves the group systems and stores the local solution in the PETSc
+ * vector provided.*/
+void DiffusionMIPBatchedSolver::Solve(Vec petsc_solution,
+                                      bool use_initial_guess /*=false*/)
+{
+  PetscInt num_local_entries;
+  VecGetLocalSize(petsc_solution, &num_local_entries);
+
+  double* x_raw;
+  VecGetArray(petsc_solution, &x_raw);
+  std::vector<double> solution(x_raw, x_raw + num_local_entries);
+
+  Solve(solution, use_initial_guess);
+
+  std::copy(solution.begin(), solution.end(), x_raw);
+  VecRestoreArray(petsc_solution, &x_raw);
+}
+
+// ###################################################################
+/**Copies the components of a local multi-group vector to the per-group
+ * vectors.*/
+void DiffusionMIPBatchedSolver::Split(
+  const std::vector<double>& multigroup_vector)
+{
+  const size_t num_groups = group_vectors_.size();
+  for (const auto& cell : grid_.local_cells)
+  {
+    const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      const int64_t ir = sdm_.MapDOFLocal(cell, i);
+      for (size_t g = 0; g < num_groups; ++g)
+        group_vectors_[g][ir] =
+          multigroup_vector[sdm_.MapDOFLocal(cell, i, uk_man_, 0, g)];
+    }
+  }
+}
+
+// ###################################################################
+/**Copies the per-group vectors to the components of a local multi-group
+ * vector.*/
+void DiffusionMIPBatchedSolver::Merge(
+  std::vector<double>& multigroup_vector) const
+{
+  const size_t num_groups = group_vectors_.size();
+  for (const auto& cell : grid_.local_cells)
+  {
+    const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      const int64_t ir = sdm_.MapDOFLocal(cell, i);
+      for (size_t g = 0; g < num_groups; ++g)
+        multigroup_vector[sdm_.MapDOFLocal(cell, i, uk_man_, 0, g)] =
+          group_vectors_[g][ir];
+    }
+  }
+}
+
+} // namespace lbs::acceleration
@@ -0,0 +1,63 @@
+#ifndef CHITECH_LBS_DIFFUSION_MIP_BATCHED_H
+#define CHITECH_LBS_DIFFUSION_MIP_BATCHED_H
+
+#include "diffusion_mip.h"
+
+#include <memory>
+
+namespace lbs::acceleration
+{
+
+/**MIP diffusion solver for a set of uncoupled groups, e.g., WGDSA over a
+ * groupset, that solves each group as an independent scalar system instead
+ * of assembling one block-diagonal system for all groups.
+ *
+ * The interface is that of DiffusionMIPSolver, i.e., vectors are laid out
+ * according to the multi-group unknown manager. Internally there is one
+ * scalar DiffusionMIPSolver per group. All group matrices share the nonzero
+ * structure of a reference group, so that only the values are stored per
+ * group. When `share_preconditioner` is set the groups are solved with a
+ * single KSP whose BoomerAMG hierarchy is built once, from the reference
+ * group, otherwise each group gets its own hierarchy. The reference group
+ * is the most diffusive one, i.e., the group with the smallest ratio of
+ * removal cross section to diffusion coefficient.*/
+class DiffusionMIPBatchedSolver : public DiffusionMIPSolver
+{
+protected:
+  const bool share_preconditioner_;
+  size_t reference_group_ = 0;
+  bool structure_shared_ = false;
+
+  std::vector<std::unique_ptr<DiffusionMIPSolver>> group_solvers_;
+  std::vector<std::vector<double>> group_vectors_;
+
+public:
+  DiffusionMIPBatchedSolver(std::string text_name,
+                            const chi_math::SpatialDiscretization& sdm,
+                            const chi_math::UnknownManager& uk_man,
+                            std::map<uint64_t, BoundaryCondition> bcs,
+                            MatID2XSMap map_mat_id_2_xs,
+                            const UnitCellMatricesStore& unit_cell_matrices,
+                            bool verbose,
+                            bool share_preconditioner);
+
+  size_t ReferenceGroup() const { return reference_group_; }
+
+  void Initialize() override;
+
+  void AssembleAand_b(const std::vector<double>& q_vector) override;
+  void Assemble_b(const std::vector<double>& q_vector) override;
+  void Assemble_b(Vec petsc_q_vector) override;
+
+  void Solve(std::vector<double>& solution,
+             bool use_initial_guess = false) override;
+  void Solve(Vec petsc_solution, bool use_initial_guess = false) override;
+
+protected:
+  void Split(const std::vector<double>& multigroup_vector);
+  void Merge(std::vector<double>& multigroup_vector) const;
+};
+
+} // namespace lbs::acceleration
+
+#endif // CHITECH_LBS_DIFFUSION_MIP_BATCHED_H
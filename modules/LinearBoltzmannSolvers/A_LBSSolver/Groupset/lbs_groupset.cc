@@ -84,6 +84,22 @@ chi::InputParameters lbs::LBSGroupset::GetInputParameters()
     "wgdsa_verbose", false, "If true, WGDSA routines will print verbosely");
   params.AddOptionalParameter(
     "wgdsa_petsc_options", "", "PETSc options to pass to WGDSA solver");
+  params.AddOptionalParameter(
+    "wgdsa_batched",
+    false,
+    "If true, the WGDSA groups are solved as independent systems that share "
+    "one matrix structure, instead of as one block-diagonal system");
+  params.AddOptionalParameter(
+    "wgdsa_batched_shared_pc",
+    true,
+    "If true, batched WGDSA solves all groups with one BoomerAMG hierarchy, "
+    "built from the most diffusive group. Otherwise each group has its own");
+  params.AddOptionalParameter(
+    "wgdsa_matrix_free",
+    false,
+    "If true, the WGDSA operator is applied matrix-free and preconditioned "
+    "with an assembled low-order matrix. Can not be combined with "
+    "wgdsa_batched");
 
   // TG DSA options
   params.AddOptionalParameter(
@@ -98,6 +114,11 @@ chi::InputParameters lbs::LBSGroupset::GetInputParameters()
     "tgdsa_verbose", false, "If true, TGDSA routines will print verbosely");
   params.AddOptionalParameter(
     "tgdsa_petsc_options", "", "PETSc options to pass to TGDSA solver");
+  params.AddOptionalParameter(
+    "tgdsa_matrix_free",
+    false,
+    "If true, the TGDSA operator is applied matrix-free and preconditioned "
+    "with an assembled low-order matrix");
 
   // ============================================ Constraints
   using namespace chi_data_types;
@@ -212,7 +233,13 @@ lbs::LBSGroupset::LBSGroupset(const chi::InputParameters& params,
   tgdsa_verbose_ = params.GetParamValue<bool>("tgdsa_verbose");
 
   wgdsa_string_ = params.GetParamValue<std::string>("wgdsa_petsc_options");
+  wgdsa_batched_ = params.GetParamValue<bool>("wgdsa_batched");
+  wgdsa_batched_shared_pc_ =
+    params.GetParamValue<bool>("wgdsa_batched_shared_pc");
   tgdsa_string_ = params.GetParamValue<std::string>("tgdsa_petsc_options");
+
+  wgdsa_matrix_free_ = params.GetParamValue<bool>("wgdsa_matrix_free");
+  tgdsa_matrix_free_ = params.GetParamValue<bool>("tgdsa_matrix_free");
 }
 
 // ##################################################################
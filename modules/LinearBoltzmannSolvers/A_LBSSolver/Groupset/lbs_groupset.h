@@ -68,6 +68,10 @@ public:
   bool                 tgdsa_verbose_ = false;
   std::string          wgdsa_string_;
   std::string          tgdsa_string_;
+  bool                 wgdsa_batched_ = false;
+  bool                 wgdsa_batched_shared_pc_ = true;
+  bool                 wgdsa_matrix_free_ = false;
+  bool                 tgdsa_matrix_free_ = false;
 
   std::shared_ptr<lbs::acceleration::DiffusionMIPSolver> wgdsa_solver_;
   std::shared_ptr<lbs::acceleration::DiffusionMIPSolver> tgdsa_solver_;
@@ -38,6 +38,7 @@ void AGSLinearSolver<Mat,Vec,KSP>::SetSystem()
 
   VecSet(x_,0.0);
   VecDuplicate(x_,&b_);
+  VecDuplicate(x_,&x_old_);
 
   //============================================= Create the matrix-shell
   MatCreateShell(PETSC_COMM_WORLD,sc_int64_t(num_local_dofs_),
@@ -83,29 +84,28 @@ void AGSLinearSolver<Mat,Vec,KSP>::Solve()
   const int gid_f = GroupSpanLastID();
   const auto& phi = lbs_solver.PhiOldLocal();
 
-  Vec x_old;
-  VecDuplicate(x_, &x_old);
-
   //Save qmoms to be restored after each iteration.
   //This is necessary for multiple ags iterations to function
   //and for keigen-value problems
   const auto saved_qmoms = lbs_solver.QMomentsLocal();
 
+  //Setup the groupset solvers once, they are reused by every iteration
+  for (auto& solver : ags_context_ptr->sub_solvers_list_)
+    solver->Setup();
+
   for (int iter = 0; iter < tolerance_options_.maximum_iterations; ++iter)
   {
 
-    lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,x_old,phi);
+    lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,
+                                                          x_old_,phi);
 
     for (auto& solver : ags_context_ptr->sub_solvers_list_)
-    {
-      solver->Setup();
       solver->Solve();
-    }
 
     lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,x_,phi);
 
-    VecAXPY(x_old, -1.0, x_);
-    PetscReal error_norm; VecNorm(x_old, NORM_2, &error_norm);
+    VecAXPY(x_old_, -1.0, x_);
+    PetscReal error_norm; VecNorm(x_old_, NORM_2, &error_norm);
     PetscReal sol_norm;VecNorm(x_, NORM_2, &sol_norm);
 
 
@@ -120,14 +120,12 @@ void AGSLinearSolver<Mat,Vec,KSP>::Solve()
     if (error_norm < tolerance_options_.residual_absolute)
       break;
   }//for iteration
-
-
-  VecDestroy(&x_old);
 }
 
 template<>
 AGSLinearSolver<Mat,Vec,KSP>::~AGSLinearSolver()
 {
+  VecDestroy(&x_old_);
   MatDestroy(&A_);
 }
 
@@ -17,6 +17,8 @@ protected:
   int groupspan_first_id_ = 0;
   int groupspan_last_id_ = 0;
   bool verbose_ = false;
+  /**Work vector of the previous iterate, kept across solves.*/
+  VecType x_old_{};
 public:
   typedef std::shared_ptr<AGSContext<MatType,VecType,SolverType>> AGSContextPtr;
 
@@ -58,6 +58,7 @@ void WGSLinearSolver<Mat, Vec, KSP>::SetSystem()
 
   VecSet(x_, 0.0);
   VecDuplicate(x_, &b_);
+  VecDuplicate(x_, &pc_work_vec_);
 
   //============================================= Create the matrix-shell
   MatCreateShell(PETSC_COMM_WORLD,
@@ -166,11 +167,8 @@ void WGSLinearSolver<Mat, Vec, KSP>::SetRHS()
     //norm
     PC pc;
     KSPGetPC(solver_, &pc);
-    Vec temp_vec;
-    VecDuplicate(b_, &temp_vec);
-    PCApply(pc, b_, temp_vec);
-    VecNorm(temp_vec, NORM_2, &context_ptr_->rhs_preconditioned_norm);
-    VecDestroy(&temp_vec);
+    PCApply(pc, b_, pc_work_vec_);
+    VecNorm(pc_work_vec_, NORM_2, &context_ptr_->rhs_preconditioned_norm);
   }
   // If we have a single richardson iteration then the user probably wants
   // only a single sweep. Therefore, we are going to combine the scattering
@@ -198,11 +196,8 @@ void WGSLinearSolver<Mat, Vec, KSP>::SetRHS()
     //norm
     PC pc;
     KSPGetPC(solver_, &pc);
-    Vec temp_vec;
-    VecDuplicate(x_, &temp_vec);
-    PCApply(pc, x_, temp_vec);
-    VecNorm(temp_vec, NORM_2, &context_ptr_->rhs_preconditioned_norm);
-    VecDestroy(&temp_vec);
+    PCApply(pc, x_, pc_work_vec_);
+    VecNorm(pc_work_vec_, NORM_2, &context_ptr_->rhs_preconditioned_norm);
 
     SetKSPSolveSuppressionFlag(true);
   }
@@ -245,6 +240,7 @@ void WGSLinearSolver<Mat, Vec, KSP>::PostSolveCallback()
 template <>
 WGSLinearSolver<Mat, Vec, KSP>::~WGSLinearSolver()
 {
+  VecDestroy(&pc_work_vec_);
   MatDestroy(&A_);
 }
 } // namespace lbs
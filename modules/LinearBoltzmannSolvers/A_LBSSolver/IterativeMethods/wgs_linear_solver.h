@@ -20,6 +20,8 @@ class WGSLinearSolver : public
 {
 protected:
   std::vector<double> saved_q_moments_local_;
+  /**Work vector for the preconditioned rhs-norm, kept across solves.*/
+  VecType pc_work_vec_{};
 
 public:
   typedef std::shared_ptr<WGSContext<MatType,VecType,SolverType>> WGSContextPtr;
@@ -0,0 +1,61 @@
+#include "groupset_source_operator.h"
+
+namespace lbs
+{
+
+//###################################################################
+/**Compiles the operator of a cross section set for the groupset
+ * [gs_i, gs_f]. Only the non-zero entries of the production matrix are
+ * stored.*/
+void GroupsetSourceOperator::Compile(const chi_physics::MultiGroupXS& xs,
+                                     size_t gs_i,
+                                     size_t gs_f)
+{
+  const size_t num_gs_groups = gs_f - gs_i + 1;
+
+  //================================================== Scattering
+  const auto& S = xs.TransferMatrices();
+  scattering_.resize(S.size());
+  for (size_t ell = 0; ell < S.size(); ++ell)
+  {
+    auto& blocks = scattering_[ell];
+    blocks.Clear();
+    blocks.diagonal.assign(num_gs_groups, 0.0);
+
+    for (size_t g = gs_i; g <= gs_f; ++g)
+    {
+      for (const auto& [_, gp, sigma_sm] : S[ell].Row(g))
+      {
+        if (gp == g) blocks.diagonal[g - gs_i] += sigma_sm;
+        else if (gp >= gs_i and gp <= gs_f) blocks.wgs.Add(gp, sigma_sm);
+        else blocks.ags.Add(gp, sigma_sm);
+      }
+      blocks.wgs.EndRow();
+      blocks.ags.EndRow();
+    }
+  }
+
+  //================================================== Prompt fission
+  fissionable_ = xs.IsFissionable();
+  fission_.Clear();
+  if (not fissionable_) return;
+
+  fission_.diagonal.assign(num_gs_groups, 0.0);
+  const auto& F = xs.ProductionMatrix();
+  const size_t* F_cols = F.SparseCols();
+  const double* F_vals = F.SparseValues();
+  for (size_t g = gs_i; g <= gs_f; ++g)
+  {
+    for (size_t k = F.SparseRowBegin(g); k < F.SparseRowEnd(g); ++k)
+    {
+      const size_t gp = F_cols[k];
+      if (gp == g) fission_.diagonal[g - gs_i] = F_vals[k];
+      else if (gp >= gs_i and gp <= gs_f) fission_.wgs.Add(gp, F_vals[k]);
+      else fission_.ags.Add(gp, F_vals[k]);
+    }
+    fission_.wgs.EndRow();
+    fission_.ags.EndRow();
+  }
+}
+
+}//namespace lbs
@@ -0,0 +1,102 @@
+#ifndef CHITECH_LBS_GROUPSET_SOURCE_OPERATOR_H
+#define CHITECH_LBS_GROUPSET_SOURCE_OPERATOR_H
+
+#include "physics/PhysicsMaterial/MultiGroupXS/multigroup_xs.h"
+
+#include <vector>
+
+namespace lbs
+{
+
+//###################################################################
+/**Flat copy of the scattering and prompt fission matrices of a cross
+ * section set, restricted to the rows of a groupset. The columns are split
+ * into those within the groupset (WGS), with the diagonal kept apart, and
+ * those outside of it (AGS), so that each source term is a single
+ * branch-free pass over contiguous arrays.*/
+class GroupsetSourceOperator
+{
+public:
+  /**Rows in CSR form. Row r corresponds to group gs_i + r and the column
+   * indices are absolute group numbers.*/
+  struct CSRBlock
+  {
+    std::vector<size_t> row_offsets = {0};
+    std::vector<size_t> cols;
+    std::vector<double> vals;
+
+    void Clear()
+    {
+      row_offsets.assign(1, 0);
+      cols.clear();
+      vals.clear();
+    }
+
+    void Add(size_t col, double val)
+    {
+      cols.push_back(col);
+      vals.push_back(val);
+    }
+    void EndRow() { row_offsets.push_back(cols.size()); }
+
+    /**Adds the product of the block with `phi` to `q`, where q[r]
+     * corresponds to row r.*/
+    void Apply(const double* phi, double* q) const
+    {
+      const size_t num_rows = row_offsets.size() - 1;
+      for (size_t r = 0; r < num_rows; ++r)
+      {
+        double value = 0.0;
+        for (size_t k = row_offsets[r]; k < row_offsets[r + 1]; ++k)
+          value += vals[k] * phi[cols[k]];
+        q[r] += value;
+      }
+    }
+  };
+
+  /**A matrix split into its groupset blocks.*/
+  struct Blocks
+  {
+    CSRBlock wgs;                ///< Within-groupset, off-diagonal
+    std::vector<double> diagonal;///< Within-groupset diagonal
+    CSRBlock ags;                ///< Across-groupset
+
+    /**Adds the product of the diagonal with `phi_gs`, the groupset part of
+     * the flux, to `q`.*/
+    void ApplyDiagonal(const double* phi_gs, double* q) const
+    {
+      for (size_t r = 0; r < diagonal.size(); ++r)
+        q[r] += diagonal[r] * phi_gs[r];
+    }
+
+    void Clear()
+    {
+      wgs.Clear();
+      diagonal.clear();
+      ags.Clear();
+    }
+  };
+
+private:
+  std::vector<Blocks> scattering_;
+  Blocks fission_;
+  bool fissionable_ = false;
+
+public:
+  /**Compiles the operator of a cross section set for the groupset
+   * [gs_i, gs_f]. Storage is reused between compilations.*/
+  void Compile(const chi_physics::MultiGroupXS& xs,
+               size_t gs_i,
+               size_t gs_f);
+
+  /**Number of scattering moments, i.e., harmonic orders ell, stored.*/
+  size_t NumScatteringMoments() const { return scattering_.size(); }
+  const Blocks& Scattering(unsigned int ell) const { return scattering_[ell]; }
+
+  bool IsFissionable() const { return fissionable_; }
+  const Blocks& Fission() const { return fission_; }
+};
+
+}//namespace lbs
+
+#endif //CHITECH_LBS_GROUPSET_SOURCE_OPERATOR_H
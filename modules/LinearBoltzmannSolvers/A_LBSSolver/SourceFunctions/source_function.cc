@@ -6,6 +6,8 @@
 #include "chi_runtime.h"
 #include "chi_log.h"
 
+#include <map>
+
 namespace lbs
 {
 
@@ -63,111 +65,139 @@ void SourceFunction::operator()(LBSGroupset &groupset,
   const auto& m_to_ell_em_map =
     groupset.quadrature_->GetMomentToHarmonicsIndexMap();
 
-  //================================================== Loop over local cells
+  //================================================== Batch cells by material
+  // The cross sections of each material are compiled into flat groupset
+  // blocks, kept across calls, which are then applied to all its cells.
   const auto& grid = lbs_solver_.Grid();
-  // Apply all nodal sources
+  std::map<int, std::vector<uint64_t>> material_cells;
   for (const auto& cell : grid.local_cells)
-  {
-    auto& transport_view = cell_transport_views[cell.local_id_];
-    cell_volume_ = transport_view.Volume();
+    material_cells[cell.material_id_].push_back(cell.local_id_);
 
+  const bool use_precursors = lbs_solver_.Options().use_precursors;
+  const bool use_src_moments = lbs_solver_.Options().use_src_moments;
+
+  //================================================== Loop over materials
+  // Apply all nodal sources
+  for (const auto& [material_id, cell_local_ids] : material_cells)
+  {
     //==================== Obtain xs
-    const auto& xs = transport_view.XS();
+    const auto& xs = cell_transport_views[cell_local_ids.front()].XS();
+    const auto& src_operator = GetSourceOperator(groupset, material_id, xs);
 
-      std::shared_ptr<chi_physics::IsotropicMultiGrpSource> P0_src = nullptr;
-    if (matid_to_src_map.count(cell.material_id_) > 0)
-      P0_src = matid_to_src_map.at(cell.material_id_);
+    std::shared_ptr<chi_physics::IsotropicMultiGrpSource> P0_src = nullptr;
+    if (matid_to_src_map.count(material_id) > 0)
+      P0_src = matid_to_src_map.at(material_id);
 
-    const auto& S = xs.TransferMatrices();
-    const auto& F = xs.ProductionMatrix();
     const auto& precursors = xs.Precursors();
     const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
 
-    //======================================== Loop over nodes
-    const int num_nodes = transport_view.NumNodes();
-    for (int i = 0; i < num_nodes; ++i)
+    const size_t num_scattering_moments = src_operator.NumScatteringMoments();
+    const bool fission_avail = src_operator.IsFissionable();
+
+    //======================================== Loop over cells
+    for (const uint64_t local_id : cell_local_ids)
     {
-      //=================================== Loop over moments
-      for (int m = 0; m < static_cast<int>(num_moments); ++m)
-      {
-        unsigned int ell = m_to_ell_em_map[m].ell;
+      auto& transport_view = cell_transport_views[local_id];
+      cell_volume_ = transport_view.Volume();
 
-        size_t uk_map = transport_view.MapDOF(i, m, 0); //unknown map
+      //===================================== Loop over nodes
+      const int num_nodes = transport_view.NumNodes();
+      for (int i = 0; i < num_nodes; ++i)
+      {
+        //================================ Loop over moments
+        for (int m = 0; m < static_cast<int>(num_moments); ++m)
+        {
+          unsigned int ell = m_to_ell_em_map[m].ell;
 
-        const double* phi = &phi_local[uk_map];
+          size_t uk_map = transport_view.MapDOF(i, m, 0); //unknown map
 
-        //==================== Declare moment src
-        if (P0_src and ell == 0)
-          fixed_src_moments_ = P0_src->source_value_g_.data();
-        else
-          fixed_src_moments_ = default_zero_src_.data();
+          const double* phi = &phi_local[uk_map];
+          double* q = &destination_q[uk_map + gs_i_];
 
-        if (lbs_solver_.Options().use_src_moments)
-          fixed_src_moments_ = &ext_src_moments_local[uk_map];
+          //==================== Declare moment src
+          if (P0_src and ell == 0)
+            fixed_src_moments_ = P0_src->source_value_g_.data();
+          else
+            fixed_src_moments_ = default_zero_src_.data();
 
-        //============================= Loop over groupset groups
-        for (size_t g = gs_i_; g <= gs_f_; ++g)
-        {
-          g_ = g;
-
-          double rhs = 0.0;
+          if (use_src_moments)
+            fixed_src_moments_ = &ext_src_moments_local[uk_map];
 
           //============================== Apply fixed sources
-          if (apply_fixed_src_) rhs += this->AddSourceMoments();
+          if (apply_fixed_src_)
+            for (size_t g = gs_i_; g <= gs_f_; ++g)
+            {
+              g_ = g;
+              q[g - gs_i_] += this->AddSourceMoments();
+            }
 
           //============================== Apply scattering sources
-          if (ell < S.size())
+          if (ell < num_scattering_moments)
           {
-            const auto& S_ell = S[ell];
+            const auto& S_ell = src_operator.Scattering(ell);
             //==================== Add Across GroupSet Scattering (AGS)
             if (apply_ags_scatter_src_)
-              for (const auto& [_, gp, sigma_sm] : S_ell.Row(g))
-                if (gp < gs_i_ or gp > gs_f_)
-                  rhs += sigma_sm * phi[gp];
+              S_ell.ags.Apply(phi, q);
 
             //==================== Add Within GroupSet Scattering (WGS)
             if (apply_wgs_scatter_src_)
-              for (const auto& [_, gp, sigma_sm] : S_ell.Row(g))
-                if (gp >= gs_i_ and gp <= gs_f_)
-                {
-                  if (suppress_wg_scatter_src_ and g_ == gp) continue;
-                  rhs += sigma_sm * phi[gp];
-                }
+            {
+              S_ell.wgs.Apply(phi, q);
+              if (not suppress_wg_scatter_src_)
+                S_ell.ApplyDiagonal(phi + gs_i_, q);
+            }
           }
 
           //============================== Apply fission sources
-          const bool fission_avail = ell == 0 and xs.IsFissionable();
-
-          if (fission_avail)
+          if (ell == 0 and fission_avail)
           {
-            const auto& F_g = F[g];
+            const auto& F = src_operator.Fission();
             if (apply_ags_fission_src_)
-              for (size_t gp = first_grp_; gp <= last_grp_; ++gp)
-                if (gp < gs_i_ or gp > gs_f_)
-                  rhs += F_g[gp] * phi[gp];
+              F.ags.Apply(phi, q);
 
             if (apply_wgs_fission_src_)
-              for (size_t gp = gs_i_; gp <= gs_f_; ++gp)
-                rhs += F_g[gp] * phi[gp];
-
-            if (lbs_solver_.Options().use_precursors)
-              rhs += this->AddDelayedFission(
-                precursors, nu_delayed_sigma_f, &phi_local[uk_map]);
+            {
+              F.wgs.Apply(phi, q);
+              F.ApplyDiagonal(phi + gs_i_, q);
+            }
+
+            if (use_precursors)
+              for (size_t g = gs_i_; g <= gs_f_; ++g)
+              {
+                g_ = g;
+                q[g - gs_i_] +=
+                  this->AddDelayedFission(precursors, nu_delayed_sigma_f, phi);
+              }
           }
-
-          //============================== Add to destination vector
-          destination_q[uk_map + g] += rhs;
-
-        }//for g
-      }//for m
-    }//for dof i
-  }//for cell
+        }//for m
+      }//for dof i
+    }//for cell
+  }//for material
 
   AddAdditionalSources(groupset, destination_q, phi_local, source_flags);
 
   Chi::log.LogEvent(source_event_tag, chi::ChiLog::EventType::EVENT_END);
 }
 
+//###################################################################
+/**Returns the source operator of a material for a groupset, compiling it
+ * on first use and again whenever the material's cross sections are
+ * swapped or rebuilt.*/
+const GroupsetSourceOperator& SourceFunction::
+  GetSourceOperator(const LBSGroupset& groupset,
+                    int material_id,
+                    const chi_physics::MultiGroupXS& xs)
+{
+  auto& entry = src_operators_[{groupset.id_, material_id}];
+  if (entry.xs != &xs or entry.xs_version != xs.Version())
+  {
+    entry.src_operator.Compile(xs, gs_i_, gs_f_);
+    entry.xs = &xs;
+    entry.xs_version = xs.Version();
+  }
+  return entry.src_operator;
+}
+
 double SourceFunction::AddSourceMoments() const
 {
   return fixed_src_moments_[g_];
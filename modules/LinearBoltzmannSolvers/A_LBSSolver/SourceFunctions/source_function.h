@@ -2,9 +2,11 @@
 #define CHITECH_LBS_SOURCE_FUNCTION_H
 
 #include "LinearBoltzmannSolvers/A_LBSSolver/lbs_structs.h"
+#include "groupset_source_operator.h"
 
 #include "physics/PhysicsMaterial/MultiGroupXS/multigroup_xs.h"
 
+#include <map>
 #include <memory>
 #include <utility>
 
@@ -16,7 +18,13 @@ class LBSGroupset;
 //###################################################################
 /**Implements a customizable source function using virtual methods.
  * This base class will function well for steady simulations and kEigenvalue
- * simulations. It needs some customization for adjoint and transient.*/
+ * simulations. It needs some customization for adjoint and transient.
+ *
+ * The cells are processed material by material. The scattering and prompt
+ * fission terms are applied through a GroupsetSourceOperator, compiled once
+ * per groupset and material and only recompiled when the cross sections
+ * change, whereas the fixed and delayed fission sources go through the
+ * virtual per-group methods.*/
 class SourceFunction
 {
 protected:
@@ -39,6 +47,22 @@ protected:
   const double* fixed_src_moments_ = nullptr;
   std::vector<double> default_zero_src_;
 
+  /**A compiled operator along with the cross sections, and their version,
+   * it was compiled from.*/
+  struct CompiledSourceOperator
+  {
+    const chi_physics::MultiGroupXS* xs = nullptr;
+    size_t xs_version = 0;
+    GroupsetSourceOperator src_operator;
+  };
+  /**Compiled operators keyed by (groupset id, material id).*/
+  std::map<std::pair<int, int>, CompiledSourceOperator> src_operators_;
+
+  const GroupsetSourceOperator&
+  GetSourceOperator(const LBSGroupset& groupset,
+                    int material_id,
+                    const chi_physics::MultiGroupXS& xs);
+
 public:
   explicit
   SourceFunction(const LBSSolver& lbs_solver);
@@ -174,7 +174,7 @@ const chi_math::SpatialDiscretization& LBSSolver::SpatialDiscretization() const
 }
 
 /**Returns read-only access to the unit cell matrices.*/
-const std::vector<UnitCellMatrices>& LBSSolver::GetUnitCellMatrices() const
+const UnitCellMatricesStore& LBSSolver::GetUnitCellMatrices() const
 {
   return unit_cell_matrices_;
 }
@@ -38,6 +38,12 @@ chi::InputParameters LBSSolver::OptionsBlock()
   "on the given platform will start to suffer. One can gain a small amount of"
   "parallel efficiency by lowering this limit, however, there is a point where"
   "the parallel efficiency will actually get worse so use with caution.");
+  params.AddOptionalParameter("sweep_persistent_requests",false,
+  "Flag indicating whether AAH sweeps communicate non-local angular fluxes "
+  "with persistent MPI requests. The requests are created once, bound to the "
+  "non-local angular flux buffers, and restarted every sweep which avoids the "
+  "per-sweep message setup and matching. The non-local buffers then remain "
+  "allocated between sweeps.");
   params.AddOptionalParameter("read_restart_data",false,
   "Flag indicating whether restart data is to be read.");
   params.AddOptionalParameter("read_restart_folder_name","YRestart",
@@ -170,6 +176,9 @@ void LBSSolver::SetOptions(const chi::InputParameters& params)
     else if (spec.Name() == "sweep_eager_limit")
       Options().sweep_eager_limit = spec.GetValue<int>();
 
+    else if (spec.Name() == "sweep_persistent_requests")
+      Options().sweep_persistent_requests = spec.GetValue<bool>();
+
     else if (spec.Name() == "read_restart_data")
       Options().read_restart_data = spec.GetValue<bool>();
 
@@ -151,10 +151,13 @@ void lbs::LBSSolver::ComputeUnitIntegrals()
   };
 
   const size_t num_local_cells = grid_ptr_->local_cells.size();
-  unit_cell_matrices_.resize(num_local_cells);
+  std::vector<UnitCellMatrices> local_unit_cell_matrices(num_local_cells);
 
   for (const auto& cell : grid_ptr_->local_cells)
-    unit_cell_matrices_[cell.local_id_] = ComputeCellUnitIntegrals(cell, *swf_ptr);
+    local_unit_cell_matrices[cell.local_id_] =
+      ComputeCellUnitIntegrals(cell, *swf_ptr);
+
+  unit_cell_matrices_.Assign(local_unit_cell_matrices);
 
   const auto ghost_ids = grid_ptr_->cells.GetGhostGlobalIDs();
   for (uint64_t ghost_id : ghost_ids)
@@ -6,6 +6,7 @@
 #include "chi_log.h"
 #include "chi_mpi.h"
 #include "console/chi_console.h"
+#include "utils/chi_timer.h"
 
 #include <iomanip>
 
@@ -45,6 +46,7 @@ void lbs::LBSSolver::InitializeParrays()
 
   //============================================= Setup groupset psi vectors
   psi_new_local_.clear();
+  psi_new_local_single_.assign(groupsets_.size(), {});
   for (auto& groupset : groupsets_)
   {
     psi_new_local_.emplace_back();
@@ -98,7 +100,7 @@ void lbs::LBSSolver::InitializeParrays()
 
     // compute cell volumes
     double cell_volume = 0.0;
-    const auto& IntV_shapeI = unit_cell_matrices_[cell.local_id_].Vi_vectors;
+    const auto IntV_shapeI = unit_cell_matrices_[cell.local_id_].Vi();
     for (size_t i = 0; i < num_nodes; ++i)
       cell_volume += IntV_shapeI[i];
 
@@ -164,6 +166,7 @@ void lbs::LBSSolver::InitializeParrays()
   //================================================== Populate grid nodal
   // mappings
   // This is used in the Flux Data Structures (FLUDS)
+  const auto& face_associations = grid_ptr_->FaceAssociations();
   grid_nodal_mappings_.clear();
   grid_nodal_mappings_.reserve(grid_ptr_->local_cells.size());
   for (auto& cell : grid_ptr_->local_cells)
@@ -171,21 +174,17 @@ void lbs::LBSSolver::InitializeParrays()
     chi_mesh::sweep_management::CellFaceNodalMapping cell_nodal_mapping;
     cell_nodal_mapping.reserve(cell.faces_.size());
 
-    for (auto& face : cell.faces_)
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
     {
-      std::vector<short> face_node_mapping;
-      std::vector<short> cell_node_mapping;
-      int ass_face = -1;
-
-      if (face.has_neighbor_)
-      {
-        grid_ptr_->FindAssociatedVertices(face, face_node_mapping);
-        grid_ptr_->FindAssociatedCellVertices(face, cell_node_mapping);
-        ass_face = face.GetNeighborAssociatedFace(*grid_ptr_);
-      }
+      const auto face_node_mapping =
+        face_associations.FaceNodeMapping(cell.local_id_, f);
+      const auto cell_node_mapping =
+        face_associations.CellNodeMapping(cell.local_id_, f);
 
       cell_nodal_mapping.emplace_back(
-        ass_face, face_node_mapping, cell_node_mapping);
+        face_associations.AssociatedFace(cell.local_id_, f),
+        std::vector<short>(face_node_mapping.begin(), face_node_mapping.end()),
+        std::vector<short>(cell_node_mapping.begin(), cell_node_mapping.end()));
     } // for f
 
     grid_nodal_mappings_.push_back(cell_nodal_mapping);
@@ -193,7 +192,23 @@ void lbs::LBSSolver::InitializeParrays()
 
   //================================================== Get grid localized
   //                                                   communicator set
-  grid_local_comm_set_ = grid_ptr_->MakeMPILocalCommunicatorSet();
+  // The setup time is only measured at verbosity level 1 and higher since
+  // it needs a barrier and a reduction.
+  if (Chi::log.GetVerbosity() >= chi::ChiLog::LOG_LVL::LOG_0VERBOSE_1)
+  {
+    Chi::mpi.Barrier();
+    chi::Timer timer;
+    grid_local_comm_set_ = grid_ptr_->MakeMPILocalCommunicatorSet();
+    const double local_time = timer.GetTime() * 1.0e-3;
+
+    double max_time = 0.0;
+    MPI_Allreduce(
+      &local_time, &max_time, 1, MPI_DOUBLE, MPI_MAX, Chi::mpi.comm);
+    Chi::log.Log0Verbose1() << "Communicator set setup time " << max_time
+                            << " s";
+  }
+  else
+    grid_local_comm_set_ = grid_ptr_->MakeMPILocalCommunicatorSet();
 
   //================================================== Make face histogram
   grid_face_histogram_ = grid_ptr_->MakeGridFaceHistogram();
@@ -30,9 +30,9 @@ void lbs::LBSSolver::InitializePointSources()
       if (grid_ptr_->CheckPointInsideCell(cell, p))
       {
         const auto& cell_view = discretization_->GetCellMapping(cell);
-        const auto& cell_matrices = unit_cell_matrices_[cell.local_id_];
-        const auto& M = cell_matrices.M_matrix;
-        const auto& I = cell_matrices.Vi_vectors;
+        const auto cell_matrices = unit_cell_matrices_[cell.local_id_];
+        const auto M = cell_matrices.M().ToMatDbl();
+        const auto I = cell_matrices.Vi();
 
         std::vector<double> shape_values;
         cell_view.ShapeValues(point_source.Location(),
@@ -4,6 +4,7 @@
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
 #include "A_LBSSolver/Acceleration/diffusion_mip.h"
+#include "A_LBSSolver/Acceleration/diffusion_mip_batched.h"
 
 // ###################################################################
 /**Initializes the Within-Group DSA solver. */
@@ -30,20 +31,33 @@ void lbs::LBSSolver::InitWGDSA(LBSGroupset& groupset,
     //=========================================== Create solver
     const auto& sdm = *discretization_;
 
-    auto solver = std::make_shared<acceleration::DiffusionMIPSolver>(
-      std::string(TextName() + "_WGDSA"),
-      sdm,
-      uk_man,
-      bcs,
-      matid_2_mgxs_map,
-      unit_cell_matrices_,
-      true); // verbosity
+    std::shared_ptr<acceleration::DiffusionMIPSolver> solver;
+    if (groupset.wgdsa_batched_)
+      solver = std::make_shared<acceleration::DiffusionMIPBatchedSolver>(
+        std::string(TextName() + "_WGDSA"),
+        sdm,
+        uk_man,
+        bcs,
+        matid_2_mgxs_map,
+        unit_cell_matrices_,
+        true, // verbosity
+        groupset.wgdsa_batched_shared_pc_);
+    else
+      solver = std::make_shared<acceleration::DiffusionMIPSolver>(
+        std::string(TextName() + "_WGDSA"),
+        sdm,
+        uk_man,
+        bcs,
+        matid_2_mgxs_map,
+        unit_cell_matrices_,
+        true); // verbosity
     chi::ParameterBlock block;
 
     solver->options.residual_tolerance = groupset.wgdsa_tol_;
     solver->options.max_iters = groupset.wgdsa_max_iters_;
     solver->options.verbose = groupset.wgdsa_verbose_;
     solver->options.additional_options_string = groupset.wgdsa_string_;
+    solver->options.matrix_free = groupset.wgdsa_matrix_free_;
 
     solver->Initialize();
 
@@ -64,7 +64,11 @@ void lbs::LBSSolver::
   size_t num_local_nodes = discretization_->GetNumLocalDOFs(NODES_ONLY);
   size_t num_angles      = groupset.quadrature_->abscissae_.size();
   size_t num_groups      = groupset.groups_.size();
-  size_t num_local_dofs  = psi_new_local_[groupset.id_].size();
+  const auto& psi_single = psi_new_local_single_[groupset.id_];
+  const bool single_precision = not psi_single.empty();
+  size_t num_local_dofs  = single_precision ?
+                           psi_single.size() :
+                           psi_new_local_[groupset.id_].size();
   auto   dof_handler     = groupset.psi_uk_man_;
 
   //============================================= Write num_ quantities
@@ -87,7 +91,9 @@ void lbs::LBSSolver::
           if (++dof_count > num_local_dofs) goto close_file;
 
           uint64_t dof_map = sdm->MapDOFLocal(cell,i,dof_handler,n,g);
-          double value = psi_new_local_[groupset.id_][dof_map];
+          double value = single_precision ?
+                         psi_single[dof_map] :
+                         psi_new_local_[groupset.id_][dof_map];
 
           file.write((char*)&cell.global_id_, sizeof(size_t));
           file.write((char*)&i             ,sizeof(unsigned int));
@@ -130,8 +136,10 @@ void lbs::LBSSolver::
   size_t num_local_nodes   = discretization_->GetNumLocalDOFs(NODES_ONLY);
   size_t num_angles        = groupset.quadrature_->abscissae_.size();
   size_t num_groups        = groupset.groups_.size();
-  size_t num_local_dofs    = psi_new_local_[groupset.id_].size();
   std::vector<double>& psi = psi_new_local_[groupset.id_];
+  std::vector<float>& psi_single = psi_new_local_single_[groupset.id_];
+  const bool single_precision = not psi_single.empty();
+  size_t num_local_dofs    = single_precision ? psi_single.size() : psi.size();
   auto   dof_handler       = groupset.psi_uk_man_;
 
   size_t file_num_local_nodes;
@@ -171,7 +179,7 @@ void lbs::LBSSolver::
   auto& sdm = discretization_;
 
   //============================================= Commit to reading the file
-  psi.reserve(file_num_local_dofs);
+  if (not single_precision) psi.reserve(file_num_local_dofs);
   std::set<uint64_t> cells_touched;
   for (size_t dof=0; dof < file_num_local_dofs; ++dof)
   {
@@ -193,7 +201,8 @@ void lbs::LBSSolver::
 
     size_t imap = sdm->MapDOFLocal(cell,node,dof_handler,angle_num,group);
 
-    psi[imap] = psi_value;
+    if (single_precision) psi_single[imap] = static_cast<float>(psi_value);
+    else psi[imap] = psi_value;
   }
 
   Chi::log.LogAll() << "Number of cells read: " << cells_touched.size();
@@ -82,7 +82,7 @@ void LBSSolver::UpdateFieldFunctions()
       const auto& cell_mapping = sdm.GetCellMapping(cell);
       const size_t num_nodes = cell_mapping.NumNodes();
 
-      const auto& Vi = unit_cell_matrices_[cell.local_id_].Vi_vectors;
+      const auto Vi = unit_cell_matrices_[cell.local_id_].Vi();
 
       const auto& xs = matid_to_xs_map_.at(cell.material_id_);
 
@@ -23,6 +23,8 @@ double LBSSolver::ComputeFissionProduction(const std::vector<double>& phi)
     //====================================== Obtain xs
     const auto& xs = transport_view.XS();
     const auto& F = xs.ProductionMatrix();
+    const size_t* F_cols = F.SparseCols();
+    const double* F_vals = F.SparseValues();
     const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
 
     if (not xs.IsFissionable()) continue;
@@ -32,15 +34,14 @@ double LBSSolver::ComputeFissionProduction(const std::vector<double>& phi)
     for (int i = 0; i < num_nodes; ++i)
     {
       const size_t uk_map = transport_view.MapDOF(i, 0, 0);
-      const double IntV_ShapeI = cell_matrices.Vi_vectors[i];
+      const double IntV_ShapeI = cell_matrices.Vi()[i];
 
       //=============================== Loop over groups
       for (size_t g = first_grp; g <= last_grp; ++g)
       {
-        const auto& prod = F[g];
-        for (size_t gp = 0; gp <= last_grp; ++gp)
-          local_production += prod[gp] *
-                              phi[uk_map + gp] *
+        for (size_t k = F.SparseRowBegin(g); k < F.SparseRowEnd(g); ++k)
+          local_production += F_vals[k] *
+                              phi[uk_map + F_cols[k]] *
                               IntV_ShapeI;
 
         if (options_.use_precursors)
@@ -76,7 +77,7 @@ double LBSSolver::ComputeFissionRate(const std::vector<double>& phi)
   for (auto& cell : grid_ptr_->local_cells)
   {
     const auto& transport_view = cell_transport_views_[cell.local_id_];
-    const auto& cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto cell_matrices = unit_cell_matrices_[cell.local_id_];
 
     //====================================== Obtain xs
     const auto& xs = transport_view.XS();
@@ -90,7 +91,7 @@ double LBSSolver::ComputeFissionRate(const std::vector<double>& phi)
     for (int i = 0; i < num_nodes; ++i)
     {
       const size_t uk_map = transport_view.MapDOF(i, 0, 0);
-      const double IntV_ShapeI = cell_matrices.Vi_vectors[i];
+      const double IntV_ShapeI = cell_matrices.Vi()[i];
 
       //=============================== Loop over groups
       for (size_t g = first_grp; g <= last_grp; ++g)
@@ -7,6 +7,7 @@
 #include "math/SpatialDiscretization/spatial_discretization.h"
 #include "math/LinearSolver/linear_solver.h"
 #include "lbs_structs.h"
+#include "lbs_unit_cell_matrices.h"
 #include "mesh/SweepUtilities/sweep_namespace.h"
 #include "mesh/SweepUtilities/SweepBoundary/sweep_boundaries.h"
 
@@ -78,7 +79,7 @@ protected:
   MPILocalCommSetPtr grid_local_comm_set_ = nullptr;
   GridFaceHistogramPtr grid_face_histogram_ = nullptr;
 
-  std::vector<UnitCellMatrices> unit_cell_matrices_;
+  UnitCellMatricesStore unit_cell_matrices_;
   std::map<uint64_t, UnitCellMatrices> unit_ghost_cell_matrices_;
   std::vector<lbs::CellLBSView> cell_transport_views_;
 
@@ -94,6 +95,9 @@ protected:
   std::vector<double> q_moments_local_, ext_src_moments_local_;
   std::vector<double> phi_new_local_, phi_old_local_;
   std::vector<std::vector<double>> psi_new_local_;
+  /**Single precision storage of the saved angular fluxes. When a groupset's
+   * entry is not empty it replaces the groupset's psi_new_local_ entry.*/
+  std::vector<std::vector<float>> psi_new_local_single_;
   std::vector<double> precursor_new_local_;
 
   SetSourceFunction active_set_source_function_;
@@ -152,7 +156,7 @@ public:
   const std::map<int, IsotropicSrcPtr>& GetMatID2IsoSrcMap() const;
 
   const chi_math::SpatialDiscretization& SpatialDiscretization() const;
-  const std::vector<UnitCellMatrices>& GetUnitCellMatrices() const;
+  const UnitCellMatricesStore& GetUnitCellMatrices() const;
   const chi_mesh::MeshContinuum& Grid() const;
 
   const std::vector<lbs::CellLBSView>& GetCellTransportViews() const;
@@ -125,6 +125,7 @@ struct Options
   SDMType sd_type = SDMType::PIECEWISE_LINEAR_DISCONTINUOUS;
   unsigned int scattering_order = 1;
   int sweep_eager_limit = 32000; // see chiLBSSetProperty documentation
+  bool sweep_persistent_requests = false;
 
   bool read_restart_data = false;
   std::string read_restart_folder_name = std::string("YRestart");
@@ -0,0 +1,169 @@
+#include "lbs_unit_cell_matrices.h"
+
+#include "chi_log_exceptions.h"
+
+namespace lbs
+{
+
+// ###################################################################
+/**Packs the given cell matrices.*/
+UnitCellMatricesStore::UnitCellMatricesStore(
+  const std::vector<UnitCellMatrices>& unit_cell_matrices)
+{
+  Assign(unit_cell_matrices);
+}
+
+// ###################################################################
+/**Replaces the stored matrices with a packed copy of the given cell
+ * matrices. The set of non-empty matrices must be the same for all cells
+ * and every non-empty matrix must be sized by the cell's number of nodes,
+ * which is taken from whichever volume matrix or vector is present.*/
+void UnitCellMatricesStore::Assign(
+  const std::vector<UnitCellMatrices>& unit_cell_matrices)
+{
+  layout_ = UnitCellMatricesLayout();
+  cell_entries_.clear();
+  data_.clear();
+
+  if (unit_cell_matrices.empty()) return;
+
+  //============================================= Determine layout
+  const auto& first = unit_cell_matrices.front();
+  layout_.K = not first.K_matrix.empty();
+  layout_.G = not first.G_matrix.empty();
+  layout_.M = not first.M_matrix.empty();
+  layout_.Vi = not first.Vi_vectors.empty();
+  layout_.face_M = not first.face_M_matrices.empty();
+  layout_.face_G = not first.face_G_matrices.empty();
+  layout_.face_Si = not first.face_Si_vectors.empty();
+
+  auto NumNodes = [](const UnitCellMatrices& ucm)
+  {
+    if (not ucm.M_matrix.empty()) return ucm.M_matrix.size();
+    if (not ucm.K_matrix.empty()) return ucm.K_matrix.size();
+    if (not ucm.G_matrix.empty()) return ucm.G_matrix.size();
+    return ucm.Vi_vectors.size();
+  };
+
+  auto NumFaces = [](const UnitCellMatrices& ucm)
+  {
+    return std::max(ucm.face_M_matrices.size(),
+                    std::max(ucm.face_G_matrices.size(),
+                             ucm.face_Si_vectors.size()));
+  };
+
+  //============================================= Compute offsets
+  cell_entries_.resize(unit_cell_matrices.size());
+  size_t total_size = 0;
+  for (size_t c = 0; c < unit_cell_matrices.size(); ++c)
+  {
+    const auto& ucm = unit_cell_matrices[c];
+    const size_t n = NumNodes(ucm);
+    const size_t nn = n * n;
+    const size_t num_faces = NumFaces(ucm);
+
+    const auto& l = layout_;
+    ChiLogicalErrorIf(
+      l.K != not ucm.K_matrix.empty() or l.G != not ucm.G_matrix.empty() or
+        l.M != not ucm.M_matrix.empty() or
+        l.Vi != not ucm.Vi_vectors.empty() or
+        l.face_M != not ucm.face_M_matrices.empty() or
+        l.face_G != not ucm.face_G_matrices.empty() or
+        l.face_Si != not ucm.face_Si_vectors.empty(),
+      "Cell " + std::to_string(c) +
+        " has a different set of unit cell matrices than cell 0.");
+
+    cell_entries_[c].offset = total_size;
+    cell_entries_[c].num_nodes = static_cast<uint32_t>(n);
+    cell_entries_[c].num_faces = static_cast<uint32_t>(num_faces);
+
+    total_size += (l.K ? nn : 0) + (l.G ? 3 * nn : 0) + (l.M ? nn : 0) +
+                  (l.Vi ? n : 0);
+    total_size += num_faces * ((l.face_M ? nn : 0) + (l.face_G ? 3 * nn : 0) +
+                               (l.face_Si ? n : 0));
+  }
+
+  //============================================= Pack
+  data_.assign(total_size, 0.0);
+
+  auto PackMatrix = [](const MatDbl& A, size_t n, double* dest)
+  {
+    ChiLogicalErrorIf(A.size() != n, "Unit cell matrix size mismatch.");
+    for (size_t i = 0; i < n; ++i)
+    {
+      ChiLogicalErrorIf(A[i].size() != n, "Unit cell matrix size mismatch.");
+      for (size_t j = 0; j < n; ++j)
+        dest[i * n + j] = A[i][j];
+    }
+  };
+  auto PackVec3Matrix = [](const MatVec3& A, size_t n, double* dest)
+  {
+    ChiLogicalErrorIf(A.size() != n, "Unit cell matrix size mismatch.");
+    const size_t nn = n * n;
+    for (size_t i = 0; i < n; ++i)
+    {
+      ChiLogicalErrorIf(A[i].size() != n, "Unit cell matrix size mismatch.");
+      for (size_t j = 0; j < n; ++j)
+        for (size_t d = 0; d < 3; ++d)
+          dest[d * nn + i * n + j] = A[i][j][d];
+    }
+  };
+  auto PackVector = [](const VecDbl& v, size_t n, double* dest)
+  {
+    ChiLogicalErrorIf(v.size() != n, "Unit cell vector size mismatch.");
+    for (size_t i = 0; i < n; ++i)
+      dest[i] = v[i];
+  };
+
+  for (size_t c = 0; c < unit_cell_matrices.size(); ++c)
+  {
+    const auto& ucm = unit_cell_matrices[c];
+    const auto& entry = cell_entries_[c];
+    const size_t n = entry.num_nodes;
+    const size_t nn = n * n;
+    const auto& l = layout_;
+
+    double* dest = data_.data() + entry.offset;
+    if (l.K)
+    {
+      PackMatrix(ucm.K_matrix, n, dest);
+      dest += nn;
+    }
+    if (l.G)
+    {
+      PackVec3Matrix(ucm.G_matrix, n, dest);
+      dest += 3 * nn;
+    }
+    if (l.M)
+    {
+      PackMatrix(ucm.M_matrix, n, dest);
+      dest += nn;
+    }
+    if (l.Vi)
+    {
+      PackVector(ucm.Vi_vectors, n, dest);
+      dest += n;
+    }
+
+    for (size_t f = 0; f < entry.num_faces; ++f)
+    {
+      if (l.face_M)
+      {
+        PackMatrix(ucm.face_M_matrices.at(f), n, dest);
+        dest += nn;
+      }
+      if (l.face_G)
+      {
+        PackVec3Matrix(ucm.face_G_matrices.at(f), n, dest);
+        dest += 3 * nn;
+      }
+      if (l.face_Si)
+      {
+        PackVector(ucm.face_Si_vectors.at(f), n, dest);
+        dest += n;
+      }
+    }
+  }
+}
+
+} // namespace lbs
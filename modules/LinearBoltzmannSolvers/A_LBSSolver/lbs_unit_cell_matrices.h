@@ -0,0 +1,236 @@
+#ifndef LBS_UNIT_CELL_MATRICES_H
+#define LBS_UNIT_CELL_MATRICES_H
+
+#include "lbs_structs.h"
+
+namespace lbs
+{
+
+// ###################################################################
+/**Read-only view of a square, row-major matrix in packed storage.
+ * `M[i][j]` has the same meaning as for an MatDbl.*/
+class DenseMatrixView
+{
+private:
+  const double* data_ = nullptr;
+  size_t n_ = 0;
+
+public:
+  DenseMatrixView() = default;
+  DenseMatrixView(const double* data, size_t n) : data_(data), n_(n) {}
+
+  /**Returns a pointer to row i.*/
+  const double* operator[](size_t i) const { return data_ + i * n_; }
+
+  /**Returns the number of rows (equal to the number of columns).*/
+  size_t size() const { return n_; }
+  /**Returns the row-major entries.*/
+  const double* Data() const { return data_; }
+
+  /**Returns a copy of the matrix in nested vector form.*/
+  MatDbl ToMatDbl() const
+  {
+    MatDbl A(n_, VecDbl(n_));
+    for (size_t i = 0; i < n_; ++i)
+      for (size_t j = 0; j < n_; ++j)
+        A[i][j] = data_[i * n_ + j];
+    return A;
+  }
+};
+
+// ###################################################################
+/**Read-only view of a vector in packed storage.*/
+class VectorView
+{
+private:
+  const double* data_ = nullptr;
+  size_t n_ = 0;
+
+public:
+  VectorView() = default;
+  VectorView(const double* data, size_t n) : data_(data), n_(n) {}
+
+  double operator[](size_t i) const { return data_[i]; }
+  size_t size() const { return n_; }
+
+  const double* begin() const { return data_; }
+  const double* end() const { return data_ + n_; }
+  const double* Data() const { return data_; }
+};
+
+// ###################################################################
+/**Read-only view of a square matrix of vectors in packed storage. The
+ * three components are stored as separate row-major matrices so that
+ * products such as \f$ \Omega \cdot G \f$ run over contiguous data.
+ * `G[i][j]` returns the entry as a chi_mesh::Vector3.*/
+class Vec3MatrixView
+{
+private:
+  const double* data_ = nullptr;
+  size_t n_ = 0;
+
+public:
+  /**Single row of the matrix.*/
+  class Row
+  {
+  private:
+    const double* x_;
+    size_t stride_;
+
+  public:
+    Row(const double* x, size_t stride) : x_(x), stride_(stride) {}
+    chi_mesh::Vector3 operator[](size_t j) const
+    {
+      return {x_[j], x_[j + stride_], x_[j + 2 * stride_]};
+    }
+  };
+
+  Vec3MatrixView() = default;
+  Vec3MatrixView(const double* data, size_t n) : data_(data), n_(n) {}
+
+  Row operator[](size_t i) const { return {data_ + i * n_, n_ * n_}; }
+
+  size_t size() const { return n_; }
+  /**Returns the row-major entries of component d (0=x, 1=y, 2=z).*/
+  const double* Component(size_t d) const { return data_ + d * n_ * n_; }
+};
+
+// ###################################################################
+/**Flags indicating which of the unit cell matrices are stored. The same
+ * set is stored for every cell of a UnitCellMatricesStore.*/
+struct UnitCellMatricesLayout
+{
+  bool K = false;
+  bool G = false;
+  bool M = false;
+  bool Vi = false;
+  bool face_M = false;
+  bool face_G = false;
+  bool face_Si = false;
+};
+
+// ###################################################################
+/**Lightweight view of the packed unit cell matrices of a single cell.
+ * Provides the same data as UnitCellMatrices.
+ *
+ * Per cell, with n nodes, the blocks are stored contiguously in the order
+ * K (n*n), G (3*n*n), M (n*n), Vi (n) followed by, for every face,
+ * face M (n*n), face G (3*n*n) and face Si (n). Blocks that are not part
+ * of the layout are omitted.*/
+class UnitCellMatricesView
+{
+private:
+  const double* data_ = nullptr;
+  size_t n_ = 0;
+  size_t num_faces_ = 0;
+
+  size_t G_offset_ = 0;
+  size_t M_offset_ = 0;
+  size_t Vi_offset_ = 0;
+  size_t faces_offset_ = 0;
+  size_t face_G_offset_ = 0;
+  size_t face_Si_offset_ = 0;
+  size_t face_stride_ = 0;
+
+public:
+  UnitCellMatricesView() = default;
+  UnitCellMatricesView(const double* data,
+                       size_t num_nodes,
+                       size_t num_faces,
+                       const UnitCellMatricesLayout& layout)
+    : data_(data), n_(num_nodes), num_faces_(num_faces)
+  {
+    const size_t nn = n_ * n_;
+    size_t pos = layout.K ? nn : 0;
+    G_offset_ = pos;
+    pos += layout.G ? 3 * nn : 0;
+    M_offset_ = pos;
+    pos += layout.M ? nn : 0;
+    Vi_offset_ = pos;
+    pos += layout.Vi ? n_ : 0;
+    faces_offset_ = pos;
+
+    face_G_offset_ = layout.face_M ? nn : 0;
+    face_Si_offset_ = face_G_offset_ + (layout.face_G ? 3 * nn : 0);
+    face_stride_ = face_Si_offset_ + (layout.face_Si ? n_ : 0);
+  }
+
+  size_t NumNodes() const { return n_; }
+  size_t NumFaces() const { return num_faces_; }
+
+  /**Volume integral of grad(b_i) dot grad(b_j).*/
+  DenseMatrixView K() const { return {data_, n_}; }
+  /**Volume integral of b_i grad(b_j).*/
+  Vec3MatrixView G() const { return {data_ + G_offset_, n_}; }
+  /**Volume integral of b_i b_j.*/
+  DenseMatrixView M() const { return {data_ + M_offset_, n_}; }
+  /**Volume integral of b_i.*/
+  VectorView Vi() const { return {data_ + Vi_offset_, n_}; }
+
+  /**Surface integral of b_i b_j over face f.*/
+  DenseMatrixView FaceM(size_t f) const
+  {
+    return {data_ + faces_offset_ + f * face_stride_, n_};
+  }
+  /**Surface integral of b_i grad(b_j) over face f.*/
+  Vec3MatrixView FaceG(size_t f) const
+  {
+    return {data_ + faces_offset_ + f * face_stride_ + face_G_offset_, n_};
+  }
+  /**Surface integral of b_i over face f.*/
+  VectorView FaceSi(size_t f) const
+  {
+    return {data_ + faces_offset_ + f * face_stride_ + face_Si_offset_, n_};
+  }
+};
+
+// ###################################################################
+/**Packed storage of the unit cell matrices of all the local cells.
+ *
+ * All matrices live in a single contiguous allocation with the matrices
+ * of each cell adjacent to each other (see UnitCellMatricesView for the
+ * per-cell layout). Compared to a vector of UnitCellMatrices this avoids
+ * the many small allocations per cell and the pointer chasing through
+ * nested vectors when the matrices are read during sweeps and assembly.*/
+class UnitCellMatricesStore
+{
+private:
+  struct CellEntry
+  {
+    size_t offset = 0;
+    uint32_t num_nodes = 0;
+    uint32_t num_faces = 0;
+  };
+
+  UnitCellMatricesLayout layout_;
+  std::vector<CellEntry> cell_entries_;
+  std::vector<double> data_;
+
+public:
+  UnitCellMatricesStore() = default;
+  explicit UnitCellMatricesStore(
+    const std::vector<UnitCellMatrices>& unit_cell_matrices);
+
+  void Assign(const std::vector<UnitCellMatrices>& unit_cell_matrices);
+
+  /**Returns the view of the matrices of the cell with the given local id.*/
+  UnitCellMatricesView operator[](size_t local_id) const
+  {
+    const auto& entry = cell_entries_[local_id];
+    return {data_.data() + entry.offset,
+            entry.num_nodes,
+            entry.num_faces,
+            layout_};
+  }
+
+  size_t size() const { return cell_entries_.size(); }
+  bool empty() const { return cell_entries_.empty(); }
+
+  const UnitCellMatricesLayout& Layout() const { return layout_; }
+  /**Returns the number of bytes of matrix data stored.*/
+  size_t MemoryBytes() const { return data_.size() * sizeof(double); }
+};
+
+} // namespace lbs
+
+#endif // LBS_UNIT_CELL_MATRICES_H
@@ -34,16 +34,26 @@ struct SweepWGSContext : public WGSContext<MatType, VecType, SolverType>
                                                rhs_scope,
                                                log_info),
       sweep_chunk_(std::move(sweep_chunk)),
-      sweep_scheduler_(
-        lbs_solver.SweepType() == "AAH"
-          ? chi_mesh::sweep_management::SchedulingAlgorithm::DEPTH_OF_GRAPH
-          : chi_mesh::sweep_management::SchedulingAlgorithm::FIRST_IN_FIRST_OUT,
-        *groupset.angle_agg_,
-        *sweep_chunk_),
+      sweep_scheduler_(SchedulingAlgorithmFor(lbs_solver),
+                       *groupset.angle_agg_,
+                       *sweep_chunk_),
       lbs_ss_solver_(lbs_solver)
   {
   }
 
+  /**Returns the scheduling algorithm matching the solver's sweep
+   * options.*/
+  static chi_mesh::sweep_management::SchedulingAlgorithm
+  SchedulingAlgorithmFor(const DiscreteOrdinatesSolver& lbs_solver)
+  {
+    using chi_mesh::sweep_management::SchedulingAlgorithm;
+    if (lbs_solver.SweepType() != "AAH")
+      return SchedulingAlgorithm::FIRST_IN_FIRST_OUT;
+    if (lbs_solver.SweepPipelining())
+      return SchedulingAlgorithm::PIPELINED_DEPTH_OF_GRAPH;
+    return SchedulingAlgorithm::DEPTH_OF_GRAPH;
+  }
+
   void PreSetupCallback() override;
 
   void SetPreconditioner(SolverType& solver) override;
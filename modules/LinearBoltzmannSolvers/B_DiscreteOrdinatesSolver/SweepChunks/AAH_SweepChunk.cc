@@ -1,8 +1,11 @@
 #include "AAH_SweepChunk.h"
+#include "SweepChunkKernels.h"
 
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "mesh/SweepUtilities/FLUDS/AAH_FLUDS.h"
 
+#include "chi_log_exceptions.h"
+
 #define scint static_cast<int>
 
 namespace lbs
@@ -11,7 +14,7 @@ namespace lbs
 AAH_SweepChunk::AAH_SweepChunk(
   const chi_mesh::MeshContinuum& grid,
   const chi_math::SpatialDiscretization& discretization,
-  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  const UnitCellMatricesStore& unit_cell_matrices,
   std::vector<lbs::CellLBSView>& cell_transport_views,
   std::vector<double>& destination_phi,
   std::vector<double>& destination_psi,
@@ -53,13 +56,29 @@ AAH_SweepChunk::AAH_SweepChunk(
   surface_integral_kernels_ = {Kernel("FEMUpwindSurfaceIntegrals")};
 
   mass_term_kernels_ = {Kernel("FEMSSTDMassTerms")};
+  batched_group_solves_ = true;
 
   flux_update_kernels_ = {Kernel("KernelPhiUpdate"), Kernel("KernelPsiUpdate")};
 
   post_cell_dir_sweep_callbacks_ = {};
+
+  use_composed_kernels_ = true;
 }
 
+// ##################################################################
+/**Sweeps the cells of the angle set. Uses the compile-time composed
+ * standard kernels unless a derived chunk changed the callback lists.*/
 void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
+{
+  if (use_composed_kernels_) SweepImpl<StandardSweepKernels>(angle_set);
+  else
+    SweepImpl<RegisteredSweepKernels>(angle_set);
+}
+
+// ##################################################################
+/**Sweep loop with the kernels supplied by the policy `Kernels`.*/
+template <typename Kernels>
+void AAH_SweepChunk::SweepImpl(chi_mesh::sweep_management::AngleSet& angle_set)
 {
   const chi::SubSetInfo& grp_ss_info =
     groupset_.grp_subset_infos_[angle_set.GetRefGroupSubset()];
@@ -68,56 +87,49 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
   gs_ss_begin_ = grp_ss_info.ss_begin;
   gs_gi_ = groupset_.groups_[gs_ss_begin_].id_;
 
-  int deploc_face_counter = -1;
-  int preloc_face_counter = -1;
-
   sweep_dependency_interface_.angle_set_ = &angle_set;
   sweep_dependency_interface_.surface_source_active_ = IsSurfaceSourceActive();
   sweep_dependency_interface_.gs_ss_begin_ = gs_ss_begin_;
+  sweep_dependency_interface_.gs_ss_size_ = gs_ss_size_;
   sweep_dependency_interface_.gs_gi_ = gs_gi_;
 
   auto& aah_sweep_depinterf =
     dynamic_cast<AAH_SweepDependencyInterface&>(sweep_dependency_interface_);
   aah_sweep_depinterf.fluds_ =
     &dynamic_cast<chi_mesh::sweep_management::AAH_FLUDS&>(angle_set.GetFLUDS());
+  if (aah_sweep_depinterf.psi_scratch_.size() < gs_ss_size_)
+    aah_sweep_depinterf.psi_scratch_.resize(gs_ss_size_, 0.0);
+
+  const auto& plan = GetSweepPlan(angle_set);
 
   // ====================================================== Loop over each
   //                                                        cell
-  const auto& spds = angle_set.GetSPDS();
-  const auto& spls = spds.GetSPLS().item_id;
-  const size_t num_spls = spls.size();
+  const size_t num_spls = plan.NumCells();
   for (size_t spls_index = 0; spls_index < num_spls; ++spls_index)
   {
-    cell_local_id_ = spls[spls_index];
+    const auto& cell_record = plan.GetCell(spls_index);
+    cell_local_id_ = cell_record.cell_local_id;
     cell_ = &grid_.local_cells[cell_local_id_];
     sweep_dependency_interface_.cell_ptr_ = cell_;
     sweep_dependency_interface_.cell_local_id_ = cell_local_id_;
     cell_mapping_ = &grid_fe_view_.GetCellMapping(*cell_);
     cell_transport_view_ = &grid_transport_view_[cell_->local_id_];
 
-    using namespace chi_mesh::sweep_management;
-    const auto& face_orientations = spds.CellFaceOrientations()[cell_local_id_];
-
-    cell_num_faces_ = cell_->faces_.size();
+    cell_num_faces_ = cell_record.num_faces;
     cell_num_nodes_ = cell_mapping_->NumNodes();
     const auto& sigma_t = xs_.at(cell_->material_id_)->SigmaTotal();
 
     aah_sweep_depinterf.spls_index = spls_index;
 
+    const auto* incoming_faces = plan.IncomingFaces(cell_record);
+    const auto* outgoing_faces = plan.OutgoingFaces(cell_record);
+
     // =============================================== Get Cell matrices
-    const auto& fe_intgrl_values = unit_cell_matrices_[cell_local_id_];
-    G_ = &fe_intgrl_values.G_matrix;
-    M_ = &fe_intgrl_values.M_matrix;
-    M_surf_ = &fe_intgrl_values.face_M_matrices;
-    IntS_shapeI_ = &fe_intgrl_values.face_Si_vectors;
+    cell_matrices_ = unit_cell_matrices_[cell_local_id_];
 
-    for (auto& callback : cell_data_callbacks_)
-      callback();
+    Kernels::CellData(*this);
 
     // =============================================== Loop over angles in set
-    const int ni_deploc_face_counter = deploc_face_counter;
-    const int ni_preloc_face_counter = preloc_face_counter;
-
     // as = angle set
     // ss = subset
     const std::vector<size_t>& as_angle_indices = angle_set.GetAngleIndices();
@@ -131,111 +143,104 @@ void AAH_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
       sweep_dependency_interface_.angle_set_index_ = as_ss_idx;
       sweep_dependency_interface_.angle_num_ = direction_num_;
 
-      deploc_face_counter = ni_deploc_face_counter;
-      preloc_face_counter = ni_preloc_face_counter;
-
       // ======================================== Reset right-handside
       for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
         b_[gsg].assign(cell_num_nodes_, 0.0);
 
-      ExecuteKernels(direction_data_callbacks_and_kernels_);
-
-      // ======================================== Upwinding structure
-      aah_sweep_depinterf.in_face_counter = 0;
-      aah_sweep_depinterf.preloc_face_counter = 0;
-      aah_sweep_depinterf.out_face_counter = 0;
-      aah_sweep_depinterf.deploc_face_counter = 0;
+      Kernels::DirectionData(*this);
 
-      // ======================================== Update face orientations
-      face_mu_values_.assign(cell_num_faces_, 0.0);
-      for (int f = 0; f < cell_num_faces_; ++f)
-        face_mu_values_[f] = omega_.Dot(cell_->faces_[f].normal_);
+      // ======================================== Face orientations
+      face_mu_values_ = plan.FaceMuValues(cell_record, as_ss_idx);
 
       // ======================================== Surface integrals
-      int in_face_counter = -1;
-      for (int f = 0; f < cell_num_faces_; ++f)
+      for (size_t k = 0; k < cell_record.num_incoming; ++k)
       {
-        const auto& face = cell_->faces_[f];
+        const auto& face = incoming_faces[k];
 
-        if (face_orientations[f] != FaceOrientation::INCOMING) continue;
+        sweep_dependency_interface_.SetupIncomingFace(face.face_index,
+                                                      face.num_face_nodes,
+                                                      face.neighbor_id,
+                                                      face.is_local,
+                                                      face.is_boundary);
 
-        const bool local = cell_transport_view_->IsFaceLocal(f);
-        const bool boundary = not face.has_neighbor_;
-
-        if (local) ++in_face_counter;
-        else if (not boundary)
-          ++preloc_face_counter;
-
-        sweep_dependency_interface_.SetupIncomingFace(
-          f,
-          cell_mapping_->NumFaceNodes(f),
-          face.neighbor_id_,
-          local,
-          boundary);
-
-        aah_sweep_depinterf.in_face_counter = in_face_counter;
-        aah_sweep_depinterf.preloc_face_counter = preloc_face_counter;
+        aah_sweep_depinterf.in_face_counter = face.local_slot;
+        aah_sweep_depinterf.preloc_face_counter = face.nonlocal_slot;
 
         // IntSf_mu_psi_Mij_dA
-        ExecuteKernels(surface_integral_kernels_);
-      } // for f
+        Kernels::SurfaceIntegrals(*this);
+      } // for incoming face
 
       // ======================================== Looping over groups,
       //                                          Assembling mass terms
-      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-      {
-        g_ = gs_gi_ + gsg;
-        gsg_ = gsg;
-        sigma_tg_ = sigma_t[g_];
-
-        ExecuteKernels(mass_term_kernels_);
-
-        // ================================= Solve system
-        chi_math::GaussElimination(Atemp_, b_[gsg], scint(cell_num_nodes_));
-      }
+      //                                          and solving
+      SolveGroupSystems(sigma_t);
 
       // ======================================== Flux updates
-      ExecuteKernels(flux_update_kernels_);
+      Kernels::FluxUpdate(*this);
 
       // ======================================== Perform outgoing
       //                                               surface operations
-      int out_face_counter = -1;
-      for (int f = 0; f < cell_num_faces_; ++f)
+      for (size_t k = 0; k < cell_record.num_outgoing; ++k)
       {
-        if (face_orientations[f] != FaceOrientation::OUTGOING) continue;
-
-        // ================================= Set flags and counters
-        out_face_counter++;
-        const auto& face = cell_->faces_[f];
-        const bool local = cell_transport_view_->IsFaceLocal(f);
-        const bool boundary = not face.has_neighbor_;
-        const int locality = cell_transport_view_->FaceLocality(f);
-
-        if (not boundary and not local) ++deploc_face_counter;
+        const auto& face = outgoing_faces[k];
 
-        sweep_dependency_interface_.SetupOutgoingFace(
-          f,
-          cell_mapping_->NumFaceNodes(f),
-          face.neighbor_id_,
-          local,
-          boundary,
-          locality);
+        sweep_dependency_interface_.SetupOutgoingFace(face.face_index,
+                                                      face.num_face_nodes,
+                                                      face.neighbor_id,
+                                                      face.is_local,
+                                                      face.is_boundary,
+                                                      face.locality);
 
-        aah_sweep_depinterf.out_face_counter = out_face_counter;
-        aah_sweep_depinterf.deploc_face_counter = deploc_face_counter;
+        aah_sweep_depinterf.out_face_counter = face.local_slot;
+        aah_sweep_depinterf.deploc_face_counter = face.nonlocal_slot;
 
         OutgoingSurfaceOperations();
-      } // for face
+      } // for outgoing face
 
-      ExecuteKernels(post_cell_dir_sweep_callbacks_);
+      Kernels::PostCellDirSweep(*this);
     } // for n
   }   // for cell
 }
 
+// ##################################################################
+/**Returns the sweep plan attached to the angle set.*/
+const AAH_SweepPlan& AAH_SweepChunk::GetSweepPlan(
+  const chi_mesh::sweep_management::AngleSet& angle_set)
+{
+  const auto* plan =
+    dynamic_cast<const AAH_SweepPlan*>(angle_set.GetSweepData());
+  ChiLogicalErrorIf(plan == nullptr,
+                    "Angle set " + std::to_string(angle_set.GetID()) +
+                      " has no sweep plan.");
+  return *plan;
+}
+
 // ##################################################################
 const double*
 AAH_SweepDependencyInterface::GetUpwindPsi(int face_node_local_idx) const
 {
+  //=========================================== Single precision FLUDS data
+  //                                            is converted to the scratch
+  if (fluds_->IsSinglePrecision() and not on_boundary_)
+  {
+    const float* psi_single =
+      on_local_face_
+        ? fluds_->UpwindPsiSingle(spls_index,
+                                  in_face_counter,
+                                  face_node_local_idx,
+                                  0,
+                                  angle_set_index_)
+        : fluds_->NLUpwindPsiSingle(
+            preloc_face_counter, face_node_local_idx, 0, angle_set_index_);
+
+    if (psi_single != nullptr)
+    {
+      for (size_t gsg = 0; gsg < gs_ss_size_; ++gsg)
+        psi_scratch_[gsg] = psi_single[gsg];
+      return psi_scratch_.data();
+    }
+  }
+
   const double* psi;
   if (on_local_face_)
     psi = fluds_->UpwindPsi(
@@ -258,6 +263,28 @@ AAH_SweepDependencyInterface::GetUpwindPsi(int face_node_local_idx) const
 double*
 AAH_SweepDependencyInterface::GetDownwindPsi(int face_node_local_idx) const
 {
+  //=========================================== Single precision FLUDS data
+  //                                            is written to the scratch and
+  //                                            stored by CommitDownwindPsi
+  pending_downwind_psi_single_ = nullptr;
+  if (fluds_->IsSinglePrecision() and not on_boundary_)
+  {
+    float* psi_single =
+      on_local_face_
+        ? fluds_->OutgoingPsiSingle(spls_index,
+                                    out_face_counter,
+                                    face_node_local_idx,
+                                    angle_set_index_)
+        : fluds_->NLOutgoingPsiSingle(
+            deploc_face_counter, face_node_local_idx, angle_set_index_);
+
+    if (psi_single != nullptr)
+    {
+      pending_downwind_psi_single_ = psi_single;
+      return psi_scratch_.data();
+    }
+  }
+
   double* psi;
   if (on_local_face_)
     psi = fluds_->OutgoingPsi(
@@ -278,4 +305,13 @@ AAH_SweepDependencyInterface::GetDownwindPsi(int face_node_local_idx) const
   return psi;
 }
 
+void AAH_SweepDependencyInterface::CommitDownwindPsi() const
+{
+  if (pending_downwind_psi_single_ == nullptr) return;
+
+  for (size_t gsg = 0; gsg < gs_ss_size_; ++gsg)
+    pending_downwind_psi_single_[gsg] = static_cast<float>(psi_scratch_[gsg]);
+  pending_downwind_psi_single_ = nullptr;
+}
+
 } // namespace lbs
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define CHITECH_AAH_SWEEPCHUNK_H
 
 #include "SweepChunk.h"
+#include "AAH_SweepPlan.h"
 
 #include "math/SpatialDiscretization/spatial_discretization.h"
 #include "LinearBoltzmannSolvers/A_LBSSolver/Groupset/lbs_groupset.h"
@@ -23,8 +24,14 @@ struct AAH_SweepDependencyInterface : public SweepDependencyInterface
   int out_face_counter = 0;
   int deploc_face_counter = 0;
 
+  /**Double precision copy of a face node's psi, used when the FLUDS store
+   * psi in single precision.*/
+  mutable std::vector<double> psi_scratch_;
+  mutable float* pending_downwind_psi_single_ = nullptr;
+
   const double* GetUpwindPsi(int face_node_local_idx) const override;
   double* GetDownwindPsi(int face_node_local_idx) const override;
+  void CommitDownwindPsi() const override;
 };
 
 // ##################################################################
@@ -34,7 +41,7 @@ class AAH_SweepChunk : public SweepChunk
 public:
   AAH_SweepChunk(const chi_mesh::MeshContinuum& grid,
                 const chi_math::SpatialDiscretization& discretization,
-                const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                const UnitCellMatricesStore& unit_cell_matrices,
                 std::vector<lbs::CellLBSView>& cell_transport_views,
                 std::vector<double>& destination_phi,
                 std::vector<double>& destination_psi,
@@ -47,6 +54,13 @@ public:
   // 01
   void Sweep(chi_mesh::sweep_management::AngleSet& angle_set) override;
 
+protected:
+  static const AAH_SweepPlan&
+  GetSweepPlan(const chi_mesh::sweep_management::AngleSet& angle_set);
+
+private:
+  template <typename Kernels>
+  void SweepImpl(chi_mesh::sweep_management::AngleSet& angle_set);
 };
 
 } // namespace lbs
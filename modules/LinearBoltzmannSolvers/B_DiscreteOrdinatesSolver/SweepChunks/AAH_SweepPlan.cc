@@ -0,0 +1,131 @@
+#include "AAH_SweepPlan.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/SweepUtilities/SPDS/SPDS.h"
+#include "math/SpatialDiscretization/spatial_discretization.h"
+#include "math/SpatialDiscretization/CellMappings/cell_mapping_base.h"
+
+namespace lbs
+{
+
+// ##################################################################
+/**Builds the plan for the SPDS of an angle set and the directions of the
+ * angle set, in angle set order.*/
+AAH_SweepPlan::AAH_SweepPlan(
+  const chi_mesh::MeshContinuum& grid,
+  const chi_math::SpatialDiscretization& discretization,
+  const std::vector<lbs::CellLBSView>& cell_transport_views,
+  const chi_mesh::sweep_management::SPDS& spds,
+  const std::vector<chi_mesh::Vector3>& omegas)
+  : num_angles_(omegas.size())
+{
+  using FaceOrientation = chi_mesh::sweep_management::FaceOrientation;
+
+  const auto& spls = spds.GetSPLS().item_id;
+  const auto& cell_face_orientations = spds.CellFaceOrientations();
+
+  cells_.reserve(spls.size());
+
+  // The slot counters mirror the ones of AAH_SweepChunk: the predecessor
+  // and dependent location counters run over all the cells, the local
+  // incoming and the outgoing counters restart for every cell.
+  int preloc_face_counter = -1;
+  int deploc_face_counter = -1;
+  size_t mu_size = 0;
+  for (int cell_local_id : spls)
+  {
+    const auto& cell = grid.local_cells[cell_local_id];
+    const auto& cell_mapping = discretization.GetCellMapping(cell);
+    const auto& transport_view = cell_transport_views[cell_local_id];
+    const auto& face_orientations = cell_face_orientations[cell_local_id];
+    const size_t num_faces = cell.faces_.size();
+
+    CellRecord cell_record;
+    cell_record.cell_local_id = cell_local_id;
+    cell_record.num_faces = num_faces;
+    cell_record.mu_offset = mu_size;
+    mu_size += num_angles_ * num_faces;
+
+    //=========================================== Incoming faces
+    cell_record.incoming_begin = faces_.size();
+    int in_face_counter = -1;
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      if (face_orientations[f] != FaceOrientation::INCOMING) continue;
+
+      const auto& face = cell.faces_[f];
+      const bool local = transport_view.IsFaceLocal(static_cast<int>(f));
+      const bool boundary = not face.has_neighbor_;
+
+      if (local) ++in_face_counter;
+      else if (not boundary)
+        ++preloc_face_counter;
+
+      FaceRecord face_record;
+      face_record.neighbor_id = face.neighbor_id_;
+      face_record.face_index = static_cast<int>(f);
+      face_record.num_face_nodes =
+        static_cast<int>(cell_mapping.NumFaceNodes(f));
+      face_record.local_slot = in_face_counter;
+      face_record.nonlocal_slot = preloc_face_counter;
+      face_record.is_local = local;
+      face_record.is_boundary = boundary;
+      faces_.push_back(face_record);
+    }
+    cell_record.num_incoming = faces_.size() - cell_record.incoming_begin;
+
+    //=========================================== Outgoing faces
+    cell_record.outgoing_begin = faces_.size();
+    int out_face_counter = -1;
+    for (size_t f = 0; f < num_faces; ++f)
+    {
+      if (face_orientations[f] != FaceOrientation::OUTGOING) continue;
+
+      const auto& face = cell.faces_[f];
+      const bool local = transport_view.IsFaceLocal(static_cast<int>(f));
+      const bool boundary = not face.has_neighbor_;
+
+      ++out_face_counter;
+      if (not boundary and not local) ++deploc_face_counter;
+
+      FaceRecord face_record;
+      face_record.neighbor_id = face.neighbor_id_;
+      face_record.face_index = static_cast<int>(f);
+      face_record.num_face_nodes =
+        static_cast<int>(cell_mapping.NumFaceNodes(f));
+      face_record.locality = transport_view.FaceLocality(static_cast<int>(f));
+      face_record.local_slot = out_face_counter;
+      face_record.nonlocal_slot = deploc_face_counter;
+      face_record.is_local = local;
+      face_record.is_boundary = boundary;
+      faces_.push_back(face_record);
+    }
+    cell_record.num_outgoing = faces_.size() - cell_record.outgoing_begin;
+
+    cells_.push_back(cell_record);
+  } // for cell
+
+  //============================================= Face mu values
+  mu_values_.assign(mu_size, 0.0);
+  for (const auto& cell_record : cells_)
+  {
+    const auto& cell = grid.local_cells[cell_record.cell_local_id];
+    for (size_t a = 0; a < num_angles_; ++a)
+    {
+      const size_t offset = cell_record.mu_offset + a * cell_record.num_faces;
+      double* mu = &mu_values_[offset];
+      for (size_t f = 0; f < cell_record.num_faces; ++f)
+        mu[f] = omegas[a].Dot(cell.faces_[f].normal_);
+    }
+  }
+}
+
+// ##################################################################
+size_t AAH_SweepPlan::MemoryBytes() const
+{
+  return cells_.size() * sizeof(CellRecord) +
+         faces_.size() * sizeof(FaceRecord) +
+         mu_values_.size() * sizeof(double);
+}
+
+} // namespace lbs
@@ -0,0 +1,104 @@
+#ifndef CHITECH_AAH_SWEEPPLAN_H
+#define CHITECH_AAH_SWEEPPLAN_H
+
+#include "A_LBSSolver/lbs_structs.h"
+#include "mesh/SweepUtilities/AngleSet/AngleSet.h"
+
+namespace chi_math
+{
+class SpatialDiscretization;
+}
+
+namespace lbs
+{
+
+// ##################################################################
+/**Sweep data of an angle set that does not change between sweeps.
+ *
+ * For every cell, in sweep order, the plan holds the incoming and outgoing
+ * faces with their locality and the FLUDS face slots (the counters of
+ * AAH_SweepDependencyInterface), and the face values of
+ * \f$ \mu = \Omega \cdot \hat{n}_f \f$ for every direction of the angle
+ * set. All the records are stored in flat arrays so that repeated sweeps
+ * stream through them instead of recomputing them per cell-angle pair.
+ *
+ * The plan does not depend on the groups of an angle set. It is built once
+ * per SPDS and direction subset and shared by the angle sets of all the
+ * group subsets, see AngleSet::SetSweepData.*/
+class AAH_SweepPlan : public chi_mesh::sweep_management::AngleSetSweepData
+{
+public:
+  /**Incoming or outgoing face of a cell.*/
+  struct FaceRecord
+  {
+    uint64_t neighbor_id = 0;
+    int face_index = 0;
+    int num_face_nodes = 0;
+    int locality = 0;
+    /**Incoming: local incoming face counter, outgoing: outgoing face
+     * counter.*/
+    int local_slot = 0;
+    /**Incoming: predecessor location face counter, outgoing: dependent
+     * location face counter.*/
+    int nonlocal_slot = 0;
+    bool is_local = false;
+    bool is_boundary = false;
+  };
+
+  /**Per cell offsets into the face and mu arrays.*/
+  struct CellRecord
+  {
+    uint64_t cell_local_id = 0;
+    size_t num_faces = 0;
+    size_t incoming_begin = 0;
+    size_t num_incoming = 0;
+    size_t outgoing_begin = 0;
+    size_t num_outgoing = 0;
+    size_t mu_offset = 0;
+  };
+
+  AAH_SweepPlan(
+    const chi_mesh::MeshContinuum& grid,
+    const chi_math::SpatialDiscretization& discretization,
+    const std::vector<lbs::CellLBSView>& cell_transport_views,
+    const chi_mesh::sweep_management::SPDS& spds,
+    const std::vector<chi_mesh::Vector3>& omegas);
+
+  size_t NumCells() const { return cells_.size(); }
+  size_t NumAngles() const { return num_angles_; }
+
+  /**Returns the record of the cell at the given position of the SPLS.*/
+  const CellRecord& GetCell(size_t spls_index) const
+  {
+    return cells_[spls_index];
+  }
+
+  const FaceRecord* IncomingFaces(const CellRecord& cell) const
+  {
+    return faces_.data() + cell.incoming_begin;
+  }
+  const FaceRecord* OutgoingFaces(const CellRecord& cell) const
+  {
+    return faces_.data() + cell.outgoing_begin;
+  }
+
+  /**Returns the mu values of all the faces of the cell for the given
+   * angle set direction index.*/
+  const double* FaceMuValues(const CellRecord& cell, size_t as_ss_idx) const
+  {
+    return mu_values_.data() + cell.mu_offset + as_ss_idx * cell.num_faces;
+  }
+
+  /**Returns the number of bytes used by the plan.*/
+  size_t MemoryBytes() const;
+
+private:
+  size_t num_angles_ = 0;
+  std::vector<CellRecord> cells_;
+  std::vector<FaceRecord> faces_;
+  std::vector<double> mu_values_;
+};
+
+} // namespace lbs
+
+#endif // CHITECH_AAH_SWEEPPLAN_H
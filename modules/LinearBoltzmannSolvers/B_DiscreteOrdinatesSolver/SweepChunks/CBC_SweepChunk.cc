@@ -1,4 +1,5 @@
 #include "CBC_SweepChunk.h"
+#include "SweepChunkKernels.h"
 
 #include "mesh/Cell/cell.h"
 #include "A_LBSSolver/Groupset/lbs_groupset.h"
@@ -16,7 +17,7 @@ CBC_SweepChunk::CBC_SweepChunk(
   std::vector<double>& destination_psi,
   const chi_mesh::MeshContinuum& grid,
   const chi_math::SpatialDiscretization& discretization,
-  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  const UnitCellMatricesStore& unit_cell_matrices,
   std::vector<lbs::CellLBSView>& cell_transport_views,
   const std::vector<double>& source_moments,
   const LBSGroupset& groupset,
@@ -58,10 +59,13 @@ CBC_SweepChunk::CBC_SweepChunk(
   surface_integral_kernels_ = {Kernel("FEMUpwindSurfaceIntegrals")};
 
   mass_term_kernels_ = {Kernel("FEMSSTDMassTerms")};
+  batched_group_solves_ = true;
 
   flux_update_kernels_ = {Kernel("KernelPhiUpdate"), Kernel("KernelPsiUpdate")};
 
   post_cell_dir_sweep_callbacks_ = {};
+
+  use_composed_kernels_ = true;
 }
 
 void CBC_SweepChunk::SetAngleSet(chi_mesh::sweep_management::AngleSet& angle_set)
@@ -78,6 +82,7 @@ void CBC_SweepChunk::SetAngleSet(chi_mesh::sweep_management::AngleSet& angle_set
   sweep_dependency_interface_.angle_set_ = &angle_set;
   sweep_dependency_interface_.surface_source_active_ = IsSurfaceSourceActive();
   sweep_dependency_interface_.gs_ss_begin_ = gs_ss_begin_;
+  sweep_dependency_interface_.gs_ss_size_ = gs_ss_size_;
   sweep_dependency_interface_.gs_gi_ = gs_gi_;
 
   cbc_sweep_depinterf_.group_stride_ = angle_set.GetNumGroups();
@@ -101,14 +106,11 @@ void CBC_SweepChunk::SetCell(const chi_mesh::Cell* cell_ptr,
   cell_num_nodes_ = cell_mapping_->NumNodes();
 
   // =============================================== Get Cell matrices
-  const auto& fe_intgrl_values = unit_cell_matrices_[cell_local_id_];
-  G_ = &fe_intgrl_values.G_matrix;
-  M_ = &fe_intgrl_values.M_matrix;
-  M_surf_ = &fe_intgrl_values.face_M_matrices;
-  IntS_shapeI_ = &fe_intgrl_values.face_Si_vectors;
+  cell_matrices_ = unit_cell_matrices_[cell_local_id_];
 
-  for (auto& callback : cell_data_callbacks_)
-    callback();
+  if (use_composed_kernels_) StandardSweepKernels::CellData(*this);
+  else
+    RegisteredSweepKernels::CellData(*this);
 
   cbc_sweep_depinterf_.cell_transport_view_ = cell_transport_view_;
 }
@@ -118,7 +120,21 @@ void CBC_SweepChunk::SetCells(const std::vector<const chi_mesh::Cell*>& cell_ptr
   cell_ptrs_ = cell_ptrs;
 }
 
+// ##################################################################
+/**Sweeps the current cell for all the angles of the angle set. Uses the
+ * compile-time composed standard kernels unless a derived chunk changed
+ * the callback lists.*/
 void CBC_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
+{
+  if (use_composed_kernels_) SweepImpl<StandardSweepKernels>(angle_set);
+  else
+    SweepImpl<RegisteredSweepKernels>(angle_set);
+}
+
+// ##################################################################
+/**Cell sweep with the kernels supplied by the policy `Kernels`.*/
+template <typename Kernels>
+void CBC_SweepChunk::SweepImpl(chi_mesh::sweep_management::AngleSet& angle_set)
 {
   using FaceOrientation = chi_mesh::sweep_management::FaceOrientation;
   const auto& face_orientations =
@@ -142,12 +158,13 @@ void CBC_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
     for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
       b_[gsg].assign(cell_num_nodes_, 0.0);
 
-    ExecuteKernels(direction_data_callbacks_and_kernels_);
+    Kernels::DirectionData(*this);
 
     // ======================================== Update face orientations
-    face_mu_values_.assign(cell_num_faces_, 0.0);
+    face_mu_values_buffer_.assign(cell_num_faces_, 0.0);
     for (int f = 0; f < cell_num_faces_; ++f)
-      face_mu_values_[f] = omega_.Dot(cell_->faces_[f].normal_);
+      face_mu_values_buffer_[f] = omega_.Dot(cell_->faces_[f].normal_);
+    face_mu_values_ = face_mu_values_buffer_.data();
 
     // ======================================== Surface integrals
     for (int f = 0; f < cell_num_faces_; ++f)
@@ -163,25 +180,16 @@ void CBC_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
         f, cell_mapping_->NumFaceNodes(f), face.neighbor_id_, local, boundary);
 
       // IntSf_mu_psi_Mij_dA
-      ExecuteKernels(surface_integral_kernels_);
+      Kernels::SurfaceIntegrals(*this);
     } // for f
 
     // ======================================== Looping over groups,
     //                                          Assembling mass terms
-    for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-    {
-      g_ = gs_gi_ + gsg;
-      gsg_ = gsg;
-      sigma_tg_ = sigma_t[g_];
-
-      ExecuteKernels(mass_term_kernels_);
-
-      // ================================= Solve system
-      chi_math::GaussElimination(Atemp_, b_[gsg], scint(cell_num_nodes_));
-    }
+    //                                          and solving
+    SolveGroupSystems(sigma_t);
 
     // ======================================== Flux updates
-    ExecuteKernels(flux_update_kernels_);
+    Kernels::FluxUpdate(*this);
 
     // ======================================== Perform outgoing
     //                                          surface operations
@@ -206,7 +214,7 @@ void CBC_SweepChunk::Sweep(chi_mesh::sweep_management::AngleSet& angle_set)
       OutgoingSurfaceOperations();
     } // for face
 
-    ExecuteKernels(post_cell_dir_sweep_callbacks_);
+    Kernels::PostCellDirSweep(*this);
   } // for n
 }
 
@@ -235,8 +243,8 @@ void CBC_SweepDependencyInterface::SetupIncomingFace(int face_id,
   }
   else if (not on_boundary_)
   {
-    psi_upwnd_data_block_ =
-      &fluds_->GetNonLocalUpwindData(cell_ptr_->global_id_, current_face_idx_);
+    psi_nonlocal_face_upwnd_data_ =
+      fluds_->GetNonLocalUpwindData(cell_local_id_, current_face_idx_);
   }
 }
 
@@ -259,20 +267,14 @@ void CBC_SweepDependencyInterface::SetupOutgoingFace(int face_id,
 
   is_reflecting_bndry_ =
     (on_boundary_ and
-     angle_set_->GetBoundaries()[neighbor_id_]->IsReflecting());
+     angle_set_->GetBoundaries().at(neighbor_id_)->IsReflecting());
 
   if (not on_local_face_ and not on_boundary_)
   {
     auto& async_comm = *angle_set_->GetCommunicator();
 
-    size_t data_size = num_face_nodes_ * group_angle_stride_;
-
-    psi_dnwnd_data_ = &async_comm.InitGetDownwindMessageData(
-      face_locality_,
-      neighbor_id_,
-      face_nodal_mapping_->associated_face_,
-      angle_set_->GetID(),
-      data_size);
+    psi_dnwnd_data_ =
+      async_comm.InitGetDownwindMessageData(cell_local_id_, current_face_idx_);
   }
 }
 
@@ -295,7 +297,7 @@ CBC_SweepDependencyInterface::GetUpwindPsi(int face_node_local_idx) const
       face_nodal_mapping_->face_node_mapping_[face_node_local_idx];
 
     psi = fluds_->GetNonLocalUpwindPsi(
-      *psi_upwnd_data_block_, adj_face_node, angle_set_index_);
+      psi_nonlocal_face_upwnd_data_, adj_face_node, angle_set_index_);
   }
   else
     psi = angle_set_->PsiBndry(neighbor_id_,
@@ -321,7 +323,7 @@ CBC_SweepDependencyInterface::GetDownwindPsi(int face_node_local_idx) const
     const size_t addr_offset = face_node_local_idx * group_angle_stride_ +
                                angle_set_index_ * group_stride_;
 
-    psi = &(*psi_dnwnd_data_)[addr_offset];
+    psi = &psi_dnwnd_data_[addr_offset];
   }
   else if (is_reflecting_bndry_)
     psi = angle_set_->ReflectingPsiOutBoundBndry(neighbor_id_,
@@ -17,8 +17,9 @@ struct CBC_SweepDependencyInterface : public SweepDependencyInterface
   /**Upwind angular flux*/
   const std::vector<double>* psi_upwnd_data_block_ = nullptr;
   const double* psi_local_face_upwnd_data_ = nullptr;
+  const double* psi_nonlocal_face_upwnd_data_ = nullptr;
   /**Downwind angular flux*/
-  std::vector<double>* psi_dnwnd_data_ = nullptr;
+  double* psi_dnwnd_data_ = nullptr;
 
   size_t group_stride_;
   size_t group_angle_stride_;
@@ -51,7 +52,7 @@ public:
                  std::vector<double>& destination_psi,
                  const chi_mesh::MeshContinuum& grid,
                  const chi_math::SpatialDiscretization& discretization,
-                 const std::vector<UnitCellMatrices>& unit_cell_matrices,
+                 const UnitCellMatricesStore& unit_cell_matrices,
                  std::vector<lbs::CellLBSView>& cell_transport_views,
                  const std::vector<double>& source_moments,
                  const LBSGroupset& groupset,
@@ -74,6 +75,10 @@ protected:
   uint64_t cell_local_id_ = 0;
 
   std::vector<const chi_mesh::Cell*> cell_ptrs_;
+
+private:
+  template <typename Kernels>
+  void SweepImpl(chi_mesh::sweep_management::AngleSet& angle_set);
 };
 
 } // namespace lbs
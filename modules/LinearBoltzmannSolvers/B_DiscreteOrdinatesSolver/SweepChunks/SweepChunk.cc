@@ -1,7 +1,10 @@
 #include "SweepChunk.h"
 
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
 #include "A_LBSSolver/Groupset/lbs_groupset.h"
 #include "math/SpatialDiscretization/FiniteElement/PiecewiseLinear/pwl.h"
+#include "math/chi_math_batched_solvers.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
@@ -17,7 +20,7 @@ SweepChunk::SweepChunk(
   std::vector<double>& destination_psi,
   const chi_mesh::MeshContinuum& grid,
   const chi_math::SpatialDiscretization& discretization,
-  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  const UnitCellMatricesStore& unit_cell_matrices,
   std::vector<lbs::CellLBSView>& cell_transport_views,
   const std::vector<double>& source_moments,
   const LBSGroupset& groupset,
@@ -47,11 +50,59 @@ SweepChunk::SweepChunk(
             std::vector<double>(max_num_cell_dofs, 0.0));
   source_.resize(max_num_cell_dofs, 0.0);
 
+  const size_t max_num_lanes = groupset.groups_.size();
+  batch_A_.resize(max_num_cell_dofs * max_num_cell_dofs * max_num_lanes);
+  batch_b_.resize(max_num_cell_dofs * max_num_lanes);
+  batch_source_.resize(max_num_cell_dofs * max_num_lanes);
+  batch_lane_work_.resize(2 * max_num_lanes);
+
   sweep_dependency_interface_.groupset_angle_group_stride_ =
     groupset_angle_group_stride_;
   sweep_dependency_interface_.groupset_group_stride_ = groupset_group_stride_;
 }
 
+// ##################################################################
+void SweepChunk::SetDestinationPsiSingle(
+  std::vector<float>& destination_psi_single)
+{
+  destination_psi_single_ = &destination_psi_single;
+  save_angular_flux_ = true;
+}
+
+// ##################################################################
+/**Makes the chunk accumulate outflows in private storage.*/
+void SweepChunk::EnablePrivateAccumulators()
+{
+  private_outflow_ = true;
+  outflow_accumulator_.assign(grid_.local_cells.size() * groupset_group_stride_,
+                              0.0);
+}
+
+// ##################################################################
+/**Sets the private outflows to zero.*/
+void SweepChunk::ZeroPrivateAccumulators()
+{
+  outflow_accumulator_.assign(outflow_accumulator_.size(), 0.0);
+}
+
+// ##################################################################
+/**Adds the private outflows to the cell transport views.*/
+void SweepChunk::ReducePrivateAccumulators()
+{
+  if (not private_outflow_) return;
+
+  const int gs_first_group = groupset_.groups_.front().id_;
+  for (const auto& cell : grid_.local_cells)
+  {
+    auto& transport_view = grid_transport_view_[cell.local_id_];
+    const double* outflow =
+      &outflow_accumulator_[cell.local_id_ * groupset_group_stride_];
+    for (size_t gsg = 0; gsg < groupset_group_stride_; ++gsg)
+      if (outflow[gsg] != 0.0)
+        transport_view.AddOutflow(gs_first_group + scint(gsg), outflow[gsg]);
+  }
+}
+
 // ##################################################################
 /**Registers a kernel as a named callback function*/
 void SweepChunk::RegisterKernel(const std::string& name,
@@ -89,7 +140,7 @@ void SweepChunk::ExecuteKernels(const std::vector<CallbackFunction>& kernels)
 void SweepChunk::OutgoingSurfaceOperations()
 {
   const size_t f = sweep_dependency_interface_.current_face_idx_;
-  const auto& IntF_shapeI = (*IntS_shapeI_)[f];
+  const auto IntF_shapeI = cell_matrices_.FaceSi(f);
   const double mu = face_mu_values_[f];
   const double wt = direction_qweight_;
 
@@ -106,60 +157,35 @@ void SweepChunk::OutgoingSurfaceOperations()
 
     if (psi != nullptr)
       if (not on_boundary or is_reflecting_boundary)
+      {
         for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
           psi[gsg] = b_[gsg][i];
+        sweep_dependency_interface_.CommitDownwindPsi();
+      }
     if (on_boundary and not is_reflecting_boundary)
-      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-        cell_transport_view_->AddOutflow(gs_gi_ + gsg,
-                                         wt * mu * b_[gsg][i] * IntF_shapeI[i]);
-
-  } // for fi
-}
-
-// ##################################################################
-/**Assembles the volumetric gradient term.*/
-void SweepChunk::KernelFEMVolumetricGradientTerm()
-{
-  const auto& G = *G_;
-
-  for (int i = 0; i < cell_num_nodes_; ++i)
-    for (int j = 0; j < cell_num_nodes_; ++j)
-      Amat_[i][j] = omega_.Dot(G[i][j]);
-}
-
-// ##################################################################
-/**Performs the integral over the surface of a face.*/
-void SweepChunk::KernelFEMUpwindSurfaceIntegrals()
-{
-  const size_t f = sweep_dependency_interface_.current_face_idx_;
-  const auto& M_surf_f = (*M_surf_)[f];
-  const double mu = face_mu_values_[f];
-  const size_t num_face_nodes = sweep_dependency_interface_.num_face_nodes_;
-  for (int fi = 0; fi < num_face_nodes; ++fi)
-  {
-    const int i = cell_mapping_->MapFaceNode(f, fi);
-    for (int fj = 0; fj < num_face_nodes; ++fj)
     {
-      const int j = cell_mapping_->MapFaceNode(f, fj);
-
-      const double* psi = sweep_dependency_interface_.GetUpwindPsi(fj);
-
-      const double mu_Nij = -mu * M_surf_f[i][j];
-      Amat_[i][j] += mu_Nij;
-
-      if (psi == nullptr) continue;
+      if (private_outflow_)
+      {
+        double* outflow =
+          &outflow_accumulator_[cell_local_id_ * groupset_group_stride_ +
+                                gs_ss_begin_];
+        for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+          outflow[gsg] += wt * mu * b_[gsg][i] * IntF_shapeI[i];
+      }
+      else
+        for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+          cell_transport_view_->AddOutflow(
+            gs_gi_ + gsg, wt * mu * b_[gsg][i] * IntF_shapeI[i]);
+    }
 
-      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-        b_[gsg][i] += psi[gsg] * mu_Nij;
-    } // for face node j
-  }   // for face node i
+  } // for fi
 }
 
 // ##################################################################
 /**Assembles angular sources and applies the mass matrix terms.*/
 void SweepChunk::KernelFEMSTDMassTerms()
 {
-  const auto& M = *M_;
+  const auto M = cell_matrices_.M();
   const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
 
   // ============================= Contribute source moments
@@ -192,43 +218,112 @@ void SweepChunk::KernelFEMSTDMassTerms()
 }
 
 // ##################################################################
-/**Adds a single direction's contribution to the moment integrals.*/
-void SweepChunk::KernelPhiUpdate()
+/**Assembles the mass terms and solves the cell systems of all the groups
+ * in the current group subset. Uses either the batched kernel or the
+ * group-by-group mass term kernels and solves.*/
+void SweepChunk::SolveGroupSystems(const std::vector<double>& sigma_t)
 {
-  const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
-
-  auto& output_phi = GetDestinationPhi();
+  if (batched_group_solves_)
+  {
+    KernelFEMSTDMassTermsBatchedSolve(sigma_t);
+    return;
+  }
 
-  for (int m = 0; m < num_moments_; ++m)
+  for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
   {
-    const double wn_d2m = d2m_op[m][direction_num_];
-    for (int i = 0; i < cell_num_nodes_; ++i)
-    {
-      const size_t ir = cell_transport_view_->MapDOF(i, m, gs_gi_);
-      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-        output_phi[ir + gsg] += wn_d2m * b_[gsg][i];
-    }
+    g_ = gs_gi_ + gsg;
+    gsg_ = gsg;
+    sigma_tg_ = sigma_t[g_];
+
+    ExecuteKernels(mass_term_kernels_);
+
+    // ================================= Solve system
+    chi_math::GaussElimination(Atemp_, b_[gsg], scint(cell_num_nodes_));
   }
 }
 
 // ##################################################################
-/**Updates angular fluxes.*/
-void SweepChunk::KernelPsiUpdate()
+/**Batched equivalent of KernelFEMSTDMassTerms followed by the group by
+ * group Gaussian eliminations. The sources and right-hand sides of all
+ * groups in the subset are gathered into a group-major layout and the
+ * systems \f$ (A + \sigma_{tg} M) \psi_g = b_g \f$ are factored
+ * simultaneously, with the groups as the vectorized dimension. Common cell
+ * types use a compile-time number of nodes.*/
+void SweepChunk::KernelFEMSTDMassTermsBatchedSolve(
+  const std::vector<double>& sigma_t)
 {
-  if (not save_angular_flux_) return;
+  const auto M = cell_matrices_.M();
+  const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
+  const size_t G = gs_ss_size_;
+  const int n = scint(cell_num_nodes_);
 
-  auto& output_psi = GetDestinationPsi();
-  double* cell_psi_data = &output_psi[grid_fe_view_.MapDOFLocal(
-    *cell_, 0, groupset_.psi_uk_man_, 0, 0)];
+  double* src = batch_source_.data();
+  double* b = batch_b_.data();
 
+  // ============================= Contribute source moments
+  // q = M_n^T * q_moms
+  for (int i = 0; i < n; ++i)
+  {
+    double* src_i = &src[i * G];
+    for (size_t gsg = 0; gsg < G; ++gsg)
+      src_i[gsg] = 0.0;
+    for (int m = 0; m < num_moments_; ++m)
+    {
+      const double m2d = m2d_op[m][direction_num_];
+      const double* q = &q_moments_[cell_transport_view_->MapDOF(i, m, gs_gi_)];
+      for (size_t gsg = 0; gsg < G; ++gsg)
+        src_i[gsg] += m2d * q[gsg];
+    } // for m
+  }   // for i
 
-  for (size_t i = 0; i < cell_num_nodes_; ++i)
+  // ============================= Right-hand side
+  // b += M * q
+  for (int i = 0; i < n; ++i)
   {
-    const size_t imap = i * groupset_angle_group_stride_ +
-                        direction_num_ * groupset_group_stride_ + gs_ss_begin_;
-    for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-      cell_psi_data[imap + gsg] = b_[gsg][i];
-  } // for i
+    double* b_i = &b[i * G];
+    for (size_t gsg = 0; gsg < G; ++gsg)
+      b_i[gsg] = 0.0;
+    for (int j = 0; j < n; ++j)
+    {
+      const double Mij = M[i][j];
+      const double* src_j = &src[j * G];
+      for (size_t gsg = 0; gsg < G; ++gsg)
+        b_i[gsg] += Mij * src_j[gsg];
+    }
+    for (size_t gsg = 0; gsg < G; ++gsg)
+      b_i[gsg] += b_[gsg][i];
+  }
+
+  // ============================= Solve all groups
+  const double* sigma = &sigma_t[gs_gi_];
+  double* Awork = batch_A_.data();
+  double* lane_work = batch_lane_work_.data();
+  using chi_math::BatchedGaussElimination;
+  switch (n)
+  {
+    case 2:
+      BatchedGaussElimination<2>(n, Amat_, M, sigma, G, Awork, b, lane_work);
+      break;
+    case 3:
+      BatchedGaussElimination<3>(n, Amat_, M, sigma, G, Awork, b, lane_work);
+      break;
+    case 4:
+      BatchedGaussElimination<4>(n, Amat_, M, sigma, G, Awork, b, lane_work);
+      break;
+    case 8:
+      BatchedGaussElimination<8>(n, Amat_, M, sigma, G, Awork, b, lane_work);
+      break;
+    default:
+      BatchedGaussElimination<0>(n, Amat_, M, sigma, G, Awork, b, lane_work);
+  }
+
+  // ============================= Scatter solutions
+  for (int i = 0; i < n; ++i)
+  {
+    const double* b_i = &b[i * G];
+    for (size_t gsg = 0; gsg < G; ++gsg)
+      b_[gsg][i] = b_i[gsg];
+  }
 }
 
 // ##################################################################
@@ -264,7 +359,7 @@ void SweepDependencyInterface::SetupOutgoingFace(int face_id,
 
   is_reflecting_bndry_ =
     (on_boundary_ and
-     angle_set_->GetBoundaries()[neighbor_id_]->IsReflecting());
+     angle_set_->GetBoundaries().at(neighbor_id_)->IsReflecting());
 }
 
 } // namespace lbs
\ No newline at end of file
@@ -2,7 +2,7 @@
 #define CHITECH_SWEEPCHUNK_H
 
 #include "mesh/SweepUtilities/sweepchunk_base.h"
-#include "A_LBSSolver/lbs_structs.h"
+#include "A_LBSSolver/lbs_unit_cell_matrices.h"
 
 namespace chi_math
 {
@@ -21,6 +21,7 @@ struct SweepDependencyInterface
   bool surface_source_active_ = false;
 
   size_t gs_ss_begin_ = 0;
+  size_t gs_ss_size_ = 0;
   int gs_gi_ = 0;
 
   const chi_mesh::Cell* cell_ptr_ = nullptr;
@@ -45,6 +46,10 @@ public:
 
   virtual const double* GetUpwindPsi(int face_node_local_idx) const = 0;
   virtual double* GetDownwindPsi(int face_node_local_idx) const = 0;
+  /**Stores the values written to the pointer returned by the last call to
+   * GetDownwindPsi, for implementations that hand out a double precision
+   * copy of the actual storage.*/
+  virtual void CommitDownwindPsi() const {}
 
   virtual void SetupIncomingFace(int face_id,
                                  size_t num_face_nodes,
@@ -61,17 +66,21 @@ public:
   virtual ~SweepDependencyInterface() = default;
 };
 
+struct RegisteredSweepKernels;
+
 // ##################################################################
 /**Base class for LBS sweepers*/
 class SweepChunk : public chi_mesh::sweep_management::SweepChunk
 {
+  friend struct RegisteredSweepKernels;
+
 public:
   SweepChunk(
     std::vector<double>& destination_phi,
     std::vector<double>& destination_psi,
     const chi_mesh::MeshContinuum& grid,
     const chi_math::SpatialDiscretization& discretization,
-    const std::vector<UnitCellMatrices>& unit_cell_matrices,
+    const UnitCellMatricesStore& unit_cell_matrices,
     std::vector<lbs::CellLBSView>& cell_transport_views,
     const std::vector<double>& source_moments,
     const LBSGroupset& groupset,
@@ -80,18 +89,29 @@ public:
     int max_num_cell_dofs,
     std::unique_ptr<SweepDependencyInterface> sweep_dependency_interface_ptr);
 
+  /**Stores the angular fluxes of the cells in the given single precision
+   * vector instead of the destination psi. Enables saving the angular
+   * fluxes.*/
+  void SetDestinationPsiSingle(std::vector<float>& destination_psi_single);
+
 protected:
   typedef std::function<void()> CallbackFunction;
 
   const chi_mesh::MeshContinuum& grid_;
   const chi_math::SpatialDiscretization& grid_fe_view_;
-  const std::vector<UnitCellMatrices>& unit_cell_matrices_;
+  const UnitCellMatricesStore& unit_cell_matrices_;
   std::vector<lbs::CellLBSView>& grid_transport_view_;
   const std::vector<double>& q_moments_;
   const LBSGroupset& groupset_;
   const std::map<int, XSPtr>& xs_;
   const int num_moments_;
-  const bool save_angular_flux_;
+  bool save_angular_flux_;
+  std::vector<float>* destination_psi_single_ = nullptr;
+
+  /**Private outflows, [cell_local_id * num_groupset_groups + gsg], used
+   * instead of the cell transport views when enabled.*/
+  bool private_outflow_ = false;
+  std::vector<double> outflow_accumulator_;
 
   std::unique_ptr<SweepDependencyInterface> sweep_dependency_interface_ptr_;
   SweepDependencyInterface& sweep_dependency_interface_;
@@ -109,6 +129,13 @@ protected:
   std::vector<double> source_;
   std::vector<std::vector<double>> b_;
 
+  /**Group-major scratch for the batched group solves, see
+   * KernelFEMSTDMassTermsBatchedSolve.*/
+  std::vector<double> batch_A_;
+  std::vector<double> batch_b_;
+  std::vector<double> batch_source_;
+  std::vector<double> batch_lane_work_;
+
   // Cell items
   uint64_t cell_local_id_ = 0;
   const chi_mesh::Cell* cell_ = nullptr;
@@ -116,15 +143,15 @@ protected:
   CellLBSView* cell_transport_view_ = nullptr;
   size_t cell_num_faces_ = 0;
   size_t cell_num_nodes_ = 0;
-  const MatVec3* G_ = nullptr;
-  const MatDbl* M_ = nullptr;
-  const std::vector<MatDbl>* M_surf_ = nullptr;
-  const std::vector<VecDbl>* IntS_shapeI_ = nullptr;
+  UnitCellMatricesView cell_matrices_;
 
   /**Callbacks at phase 1 : cell data established*/
   std::vector<CallbackFunction> cell_data_callbacks_;
 
-  std::vector<double> face_mu_values_;
+  /**Values of omega dot the face normals of the current cell. Points to
+   * face_mu_values_buffer_ or to precomputed values, see AAH_SweepPlan.*/
+  const double* face_mu_values_ = nullptr;
+  std::vector<double> face_mu_values_buffer_;
   size_t direction_num_ = 0;
   chi_mesh::Vector3 omega_;
   double direction_qweight_ = 0.0;
@@ -141,6 +168,11 @@ protected:
 
   /**Callbacks at phase 4 : group by group mass terms*/
   std::vector<CallbackFunction> mass_term_kernels_;
+  /**When true, phase 4 and the cell solves of all the groups in the subset
+   * are performed at once by KernelFEMSTDMassTermsBatchedSolve instead of
+   * executing mass_term_kernels_ group by group. Only valid with the
+   * standard mass terms.*/
+  bool batched_group_solves_ = false;
 
   /**Callbacks at phase 5 : flux updates*/
   std::vector<CallbackFunction> flux_update_kernels_;
@@ -148,6 +180,16 @@ protected:
   /**Callbacks at phase 6 : Post cell-dir sweep*/
   std::vector<CallbackFunction> post_cell_dir_sweep_callbacks_;
 
+  /**When true, the sweep loop calls the standard kernels directly through
+   * StandardSweepKernels (see SweepChunkKernels.h) instead of executing the
+   * callback lists above. Derived chunks that change the callback lists must
+   * set this to false.*/
+  bool use_composed_kernels_ = false;
+
+  void EnablePrivateAccumulators() override;
+  void ZeroPrivateAccumulators() override;
+  void ReducePrivateAccumulators() override;
+
   // 02 operations
   /**Registers a kernel as a named callback function*/
   void RegisterKernel(const std::string& name, CallbackFunction function);
@@ -156,14 +198,17 @@ protected:
   /**Executes the supplied kernels list.*/
   static void ExecuteKernels(const std::vector<CallbackFunction>& kernels);
   virtual void OutgoingSurfaceOperations();
+  void SolveGroupSystems(const std::vector<double>& sigma_t);
 
   // kernels
+  // Kernels declared inline are defined in SweepChunkKernels.h
 public: // public so that we can use bind
-  void KernelFEMVolumetricGradientTerm();
-  void KernelFEMUpwindSurfaceIntegrals();
+  inline void KernelFEMVolumetricGradientTerm();
+  inline void KernelFEMUpwindSurfaceIntegrals();
   void KernelFEMSTDMassTerms();
-  void KernelPhiUpdate();
-  void KernelPsiUpdate();
+  void KernelFEMSTDMassTermsBatchedSolve(const std::vector<double>& sigma_t);
+  inline void KernelPhiUpdate();
+  inline void KernelPsiUpdate();
 
 private:
   std::map<std::string, CallbackFunction> kernels_;
@@ -0,0 +1,170 @@
+#ifndef CHITECH_SWEEPCHUNKKERNELS_H
+#define CHITECH_SWEEPCHUNKKERNELS_H
+
+#include "SweepChunk.h"
+
+#include "A_LBSSolver/Groupset/lbs_groupset.h"
+#include "math/SpatialDiscretization/spatial_discretization.h"
+#include "math/SpatialDiscretization/CellMappings/cell_mapping_base.h"
+
+namespace lbs
+{
+
+// ##################################################################
+/**Assembles the volumetric gradient term.*/
+inline void SweepChunk::KernelFEMVolumetricGradientTerm()
+{
+  const auto G = cell_matrices_.G();
+  const double* Gx = G.Component(0);
+  const double* Gy = G.Component(1);
+  const double* Gz = G.Component(2);
+
+  for (int i = 0; i < cell_num_nodes_; ++i)
+  {
+    const size_t row = i * cell_num_nodes_;
+    for (int j = 0; j < cell_num_nodes_; ++j)
+      Amat_[i][j] = omega_.x * Gx[row + j] + omega_.y * Gy[row + j] +
+                    omega_.z * Gz[row + j];
+  }
+}
+
+// ##################################################################
+/**Performs the integral over the surface of a face.*/
+inline void SweepChunk::KernelFEMUpwindSurfaceIntegrals()
+{
+  const size_t f = sweep_dependency_interface_.current_face_idx_;
+  const auto M_surf_f = cell_matrices_.FaceM(f);
+  const double mu = face_mu_values_[f];
+  const size_t num_face_nodes = sweep_dependency_interface_.num_face_nodes_;
+  for (int fi = 0; fi < num_face_nodes; ++fi)
+  {
+    const int i = cell_mapping_->MapFaceNode(f, fi);
+    for (int fj = 0; fj < num_face_nodes; ++fj)
+    {
+      const int j = cell_mapping_->MapFaceNode(f, fj);
+
+      const double* psi = sweep_dependency_interface_.GetUpwindPsi(fj);
+
+      const double mu_Nij = -mu * M_surf_f[i][j];
+      Amat_[i][j] += mu_Nij;
+
+      if (psi == nullptr) continue;
+
+      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+        b_[gsg][i] += psi[gsg] * mu_Nij;
+    } // for face node j
+  }   // for face node i
+}
+
+// ##################################################################
+/**Adds a single direction's contribution to the moment integrals.*/
+inline void SweepChunk::KernelPhiUpdate()
+{
+  const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
+
+  auto& output_phi = GetDestinationPhi();
+
+  for (int m = 0; m < num_moments_; ++m)
+  {
+    const double wn_d2m = d2m_op[m][direction_num_];
+    for (int i = 0; i < cell_num_nodes_; ++i)
+    {
+      const size_t ir = cell_transport_view_->MapDOF(i, m, gs_gi_);
+      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+        output_phi[ir + gsg] += wn_d2m * b_[gsg][i];
+    }
+  }
+}
+
+// ##################################################################
+/**Updates angular fluxes.*/
+inline void SweepChunk::KernelPsiUpdate()
+{
+  if (not save_angular_flux_) return;
+
+  const auto cell_psi_offset =
+    grid_fe_view_.MapDOFLocal(*cell_, 0, groupset_.psi_uk_man_, 0, 0);
+
+  if (destination_psi_single_ != nullptr)
+  {
+    float* cell_psi_data = &(*destination_psi_single_)[cell_psi_offset];
+    for (size_t i = 0; i < cell_num_nodes_; ++i)
+    {
+      const size_t imap = i * groupset_angle_group_stride_ +
+                          direction_num_ * groupset_group_stride_ +
+                          gs_ss_begin_;
+      for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+        cell_psi_data[imap + gsg] = static_cast<float>(b_[gsg][i]);
+    } // for i
+    return;
+  }
+
+  auto& output_psi = GetDestinationPsi();
+  double* cell_psi_data = &output_psi[cell_psi_offset];
+
+  for (size_t i = 0; i < cell_num_nodes_; ++i)
+  {
+    const size_t imap = i * groupset_angle_group_stride_ +
+                        direction_num_ * groupset_group_stride_ + gs_ss_begin_;
+    for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
+      cell_psi_data[imap + gsg] = b_[gsg][i];
+  } // for i
+}
+
+// ##################################################################
+/**Kernel policy composing the standard kernels at compile time.
+ *
+ * A sweep loop written as a template over a kernel policy calls one static
+ * function of the policy per callback phase of SweepChunk. This policy
+ * calls the standard kernels directly, matching the callback lists set up
+ * by AAH_SweepChunk and CBC_SweepChunk, so that the compiler can inline them
+ * into the cell-angle loop.*/
+struct StandardSweepKernels
+{
+  static void CellData(SweepChunk&) {}
+  static void DirectionData(SweepChunk& chunk)
+  {
+    chunk.KernelFEMVolumetricGradientTerm();
+  }
+  static void SurfaceIntegrals(SweepChunk& chunk)
+  {
+    chunk.KernelFEMUpwindSurfaceIntegrals();
+  }
+  static void FluxUpdate(SweepChunk& chunk)
+  {
+    chunk.KernelPhiUpdate();
+    chunk.KernelPsiUpdate();
+  }
+  static void PostCellDirSweep(SweepChunk&) {}
+};
+
+// ##################################################################
+/**Kernel policy executing the runtime registered callback lists. Used by
+ * chunks that replace or extend the standard kernels.*/
+struct RegisteredSweepKernels
+{
+  static void CellData(SweepChunk& chunk)
+  {
+    SweepChunk::ExecuteKernels(chunk.cell_data_callbacks_);
+  }
+  static void DirectionData(SweepChunk& chunk)
+  {
+    SweepChunk::ExecuteKernels(chunk.direction_data_callbacks_and_kernels_);
+  }
+  static void SurfaceIntegrals(SweepChunk& chunk)
+  {
+    SweepChunk::ExecuteKernels(chunk.surface_integral_kernels_);
+  }
+  static void FluxUpdate(SweepChunk& chunk)
+  {
+    SweepChunk::ExecuteKernels(chunk.flux_update_kernels_);
+  }
+  static void PostCellDirSweep(SweepChunk& chunk)
+  {
+    SweepChunk::ExecuteKernels(chunk.post_cell_dir_sweep_callbacks_);
+  }
+};
+
+} // namespace lbs
+
+#endif // CHITECH_SWEEPCHUNKKERNELS_H
@@ -6,6 +6,8 @@
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "math/chi_math_range.h"
 
+#include "utils/chi_thread_pool.h"
+
 #include "chi_runtime.h"
 #include "chi_log.h"
 
@@ -40,6 +42,11 @@ CBC_AngleSet::GetCommunicator()
     &async_comm_);
 }
 
+// ###################################################################
+/**Advances the cell-by-cell execution of the angle set. Received upstream
+ * data and executed cells decrement the dependency counts of their
+ * successors, cells reaching zero dependencies are pushed onto the ready
+ * queue from which they are executed.*/
 chi_mesh::sweep_management::AngleSetStatus CBC_AngleSet::AngleSetAdvance(
   chi_mesh::sweep_management::SweepChunk& sweep_chunk,
   const std::vector<size_t>& timing_tags,
@@ -49,16 +56,14 @@ chi_mesh::sweep_management::AngleSetStatus CBC_AngleSet::AngleSetAdvance(
 
   if (executed_) return Status::FINISHED;
 
-
-  if (current_task_list_.empty())
-    current_task_list_ = cbc_spds_.TaskList();
+  if (not tasks_initialized_) InitializeTasks();
 
   sweep_chunk.SetAngleSet(*this);
 
-  auto tasks_who_received_data = async_comm_.ReceiveData();
+  const auto& tasks_who_received_data = async_comm_.ReceiveData();
 
   for (const uint64_t task_number : tasks_who_received_data)
-    --current_task_list_[task_number].num_dependencies_;
+    DecrementDependencies(task_number);
 
   async_comm_.SendData();
 
@@ -67,49 +72,12 @@ chi_mesh::sweep_management::AngleSetStatus CBC_AngleSet::AngleSetAdvance(
     if (not bndry->CheckAnglesReadyStatus(angles_, ref_group_subset_))
       return Status::NOT_FINISHED;
 
-  bool all_tasks_completed = true;
-  bool a_task_executed = true;
-  while (a_task_executed)
-  {
-    a_task_executed = false;
-    for (auto& cell_task : current_task_list_)
-    {
-      if (not cell_task.completed_) all_tasks_completed = false;
-      if (cell_task.num_dependencies_ == 0 and not cell_task.completed_)
-      {
-        Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
-        sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
-        sweep_chunk.Sweep(*this);
-
-        for (uint64_t local_task_num : cell_task.successors_)
-          --current_task_list_[local_task_num].num_dependencies_;
-        Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
-
-        cell_task.completed_ = true;
-        a_task_executed = true;
-        async_comm_.SendData();
-      }
-    } // for cell_task
-    async_comm_.SendData();
-  }
-  //for (auto& cell_task : current_task_list_)
-  //{
-  //  if (not cell_task.completed_) all_tasks_completed = false;
-  //  if (cell_task.num_dependencies_ == 0 and not cell_task.completed_)
-  //  {
-  //    Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
-  //    sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
-  //    sweep_chunk.Sweep(*this);
-  //
-  //    for (uint64_t local_task_num : cell_task.successors_)
-  //      --current_task_list_[local_task_num].num_dependencies_;
-  //    Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
-  //
-  //    cell_task.completed_ = true;
-  //    async_comm_.SendData();
-  //  }
-  //} // for cell_task
+  if (thread_pool_) ExecuteReadyTasksThreaded(timing_tags);
+  else
+    ExecuteReadyTasks(sweep_chunk, timing_tags);
 
+  const bool all_tasks_completed =
+    num_tasks_completed_ == cbc_spds_.TaskList().size();
   const bool all_messages_sent = async_comm_.SendData();
 
   if (all_tasks_completed and all_messages_sent)
@@ -124,16 +92,149 @@ chi_mesh::sweep_management::AngleSetStatus CBC_AngleSet::AngleSetAdvance(
   return Status::NOT_FINISHED;
 }
 
+// ###################################################################
+/**Copies the dependency counts of the SPDS's task list and queues the
+ * tasks without dependencies.*/
+void CBC_AngleSet::InitializeTasks()
+{
+  const auto& task_list = cbc_spds_.TaskList();
+  const size_t num_tasks = task_list.size();
+
+  if (not task_num_dependencies_)
+    task_num_dependencies_ =
+      std::make_unique<std::atomic<unsigned int>[]>(num_tasks);
+
+  ready_queue_.Reset(num_tasks);
+  for (size_t t = 0; t < num_tasks; ++t)
+  {
+    task_num_dependencies_[t].store(task_list[t].num_dependencies_,
+                                    std::memory_order_relaxed);
+    if (task_list[t].num_dependencies_ == 0) ready_queue_.Push(t);
+  }
+
+  num_tasks_completed_ = 0;
+  tasks_initialized_ = true;
+}
+
+// ###################################################################
+/**Decrements the dependency count of a task and queues it when all its
+ * dependencies are satisfied.*/
+void CBC_AngleSet::DecrementDependencies(uint64_t task_number)
+{
+  if (task_num_dependencies_[task_number].fetch_sub(
+        1, std::memory_order_acq_rel) == 1)
+    ready_queue_.Push(task_number);
+}
+
+// ###################################################################
+/**Executes ready tasks, and the tasks they make ready, until the ready
+ * queue is exhausted.*/
+void CBC_AngleSet::ExecuteReadyTasks(
+  chi_mesh::sweep_management::SweepChunk& sweep_chunk,
+  const std::vector<size_t>& timing_tags)
+{
+  const auto& task_list = cbc_spds_.TaskList();
+
+  uint64_t task_number;
+  while (ready_queue_.TryPop(task_number))
+  {
+    const auto& cell_task = task_list[task_number];
+
+    Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
+    sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
+    sweep_chunk.Sweep(*this);
+
+    for (uint64_t local_task_num : cell_task.successors_)
+      DecrementDependencies(local_task_num);
+    Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
+
+    ++num_tasks_completed_;
+    async_comm_.SendData();
+  }
+}
+
+// ###################################################################
+/**Executes ready tasks on all the threads of the pool until no task is
+ * ready and none is being executed. Communication is deferred to the
+ * calling (main) thread, workers only execute cells and release their
+ * successors.*/
+void CBC_AngleSet::ExecuteReadyTasksThreaded(
+  const std::vector<size_t>& timing_tags)
+{
+  if (ready_queue_.Empty()) return;
+
+  const auto& task_list = cbc_spds_.TaskList();
+
+  std::atomic<size_t> num_in_flight{0};
+  std::atomic<size_t> num_completed{0};
+
+  auto WorkerFunction = [&](size_t worker_id)
+  {
+    auto& sweep_chunk = *worker_sweep_chunks_[worker_id];
+    sweep_chunk.SetAngleSet(*this);
+
+    while (true)
+    {
+      // A worker counts as in flight while it attempts a pop so that no
+      // other worker concludes that the phase is over in the meantime.
+      num_in_flight.fetch_add(1);
+      uint64_t task_number;
+      if (not ready_queue_.TryPop(task_number))
+      {
+        const bool last_in_flight = num_in_flight.fetch_sub(1) == 1;
+        if (last_in_flight and ready_queue_.Empty()) break;
+        std::this_thread::yield();
+        continue;
+      }
+
+      const auto& cell_task = task_list[task_number];
+      sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
+      sweep_chunk.Sweep(*this);
+
+      for (uint64_t local_task_num : cell_task.successors_)
+        DecrementDependencies(local_task_num);
+
+      num_completed.fetch_add(1);
+      num_in_flight.fetch_sub(1);
+    }
+  };
+
+  Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
+  for (size_t w = 0; w < thread_pool_->NumThreads(); ++w)
+    thread_pool_->Submit(WorkerFunction);
+  thread_pool_->Wait();
+  Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
+
+  num_tasks_completed_ += num_completed.load();
+}
+
 // ###################################################################
 /**Resets the sweep buffer.*/
 void CBC_AngleSet::ResetSweepBuffers()
 {
-  current_task_list_.clear();
+  tasks_initialized_ = false;
   async_comm_.Reset();
   fluds_->ClearLocalAndReceivePsi();
   executed_ = false;
 }
 
+// ###################################################################
+/**Sets the thread pool and per-worker sweep chunks with which ready cells
+ * are executed concurrently.*/
+void CBC_AngleSet::SetTaskExecutionThreads(
+  chi::ThreadPool* thread_pool,
+  const std::vector<chi_mesh::sweep_management::SweepChunk*>&
+    worker_sweep_chunks)
+{
+  ChiInvalidArgumentIf(
+    thread_pool == nullptr or
+      worker_sweep_chunks.size() != thread_pool->NumThreads(),
+    "Each thread requires exactly one sweep chunk.");
+
+  thread_pool_ = thread_pool;
+  worker_sweep_chunks_ = worker_sweep_chunks;
+}
+
 // ###################################################################
 /**Returns a pointer to a boundary flux data.*/
 const double* CBC_AngleSet::PsiBndry(uint64_t bndry_map,
@@ -145,13 +246,14 @@ const double* CBC_AngleSet::PsiBndry(uint64_t bndry_map,
                                      size_t gs_ss_begin,
                                      bool surface_source_active)
 {
-  if (ref_boundaries_[bndry_map]->IsReflecting())
-    return ref_boundaries_[bndry_map]->HeterogeneousPsiIncoming(
+  if (ref_boundaries_.at(bndry_map)->IsReflecting())
+    return ref_boundaries_.at(bndry_map)->HeterogeneousPsiIncoming(
       cell_local_id, face_num, fi, angle_num, g, gs_ss_begin);
 
-  if (not surface_source_active) return ref_boundaries_[bndry_map]->ZeroFlux(g);
+  if (not surface_source_active)
+    return ref_boundaries_.at(bndry_map)->ZeroFlux(g);
 
-  return ref_boundaries_[bndry_map]->HeterogeneousPsiIncoming(
+  return ref_boundaries_.at(bndry_map)->HeterogeneousPsiIncoming(
     cell_local_id, face_num, fi, angle_num, g, gs_ss_begin);
 }
 
@@ -164,7 +266,7 @@ double* CBC_AngleSet::ReflectingPsiOutBoundBndry(uint64_t bndry_map,
                                                  unsigned int fi,
                                                  size_t gs_ss_begin)
 {
-  return ref_boundaries_[bndry_map]->HeterogeneousPsiOutgoing(
+  return ref_boundaries_.at(bndry_map)->HeterogeneousPsiOutgoing(
     cell_local_id, face_num, fi, angle_num, gs_ss_begin);
 }
 
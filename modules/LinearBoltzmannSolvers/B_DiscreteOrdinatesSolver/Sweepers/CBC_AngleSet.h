@@ -3,6 +3,7 @@
 
 #include "mesh/SweepUtilities/AngleSet/AngleSet.h"
 #include "CBC_AsyncComm.h"
+#include "CBC_ReadyQueue.h"
 
 namespace lbs
 {
@@ -41,6 +42,13 @@ public:
              : chi_mesh::sweep_management::AngleSetStatus::MESSAGES_PENDING;
   }
   void ResetSweepBuffers() override;
+
+  bool SupportsThreadedTaskExecution() const override { return true; }
+  void SetTaskExecutionThreads(
+    chi::ThreadPool* thread_pool,
+    const std::vector<chi_mesh::sweep_management::SweepChunk*>&
+      worker_sweep_chunks) override;
+
   bool ReceiveDelayedData() override { return true; }
   const double* PsiBndry(uint64_t bndry_map,
                          unsigned int angle_num,
@@ -58,9 +66,23 @@ public:
                                      size_t gs_ss_begin) override;
 
 protected:
+  void InitializeTasks();
+  void DecrementDependencies(uint64_t task_number);
+  void ExecuteReadyTasks(chi_mesh::sweep_management::SweepChunk& sweep_chunk,
+                         const std::vector<size_t>& timing_tags);
+  void ExecuteReadyTasksThreaded(const std::vector<size_t>& timing_tags);
+
   const CBC_SPDS& cbc_spds_;
-  std::vector<chi_mesh::sweep_management::Task> current_task_list_;
   CBC_ASynchronousCommunicator async_comm_;
+
+  bool tasks_initialized_ = false;
+  /**Remaining number of upstream dependencies of each task.*/
+  std::unique_ptr<std::atomic<unsigned int>[]> task_num_dependencies_;
+  CBC_ReadyQueue ready_queue_;
+  size_t num_tasks_completed_ = 0;
+
+  chi::ThreadPool* thread_pool_ = nullptr;
+  std::vector<chi_mesh::sweep_management::SweepChunk*> worker_sweep_chunks_;
 };
 
 } // namespace lbs
@@ -4,13 +4,12 @@
 
 #include "mesh/SweepUtilities/FLUDS/FLUDS.h"
 #include "mesh/SweepUtilities/SPDS/SPDS.h"
-#include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "CBC_FLUDS.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
 
-#define uint unsigned int
+#include <cstring>
 
 namespace lbs
 {
@@ -23,79 +22,108 @@ CBC_ASynchronousCommunicator::CBC_ASynchronousCommunicator(
     angle_set_id_(angle_set_id),
     cbc_fluds_(dynamic_cast<CBC_FLUDS&>(fluds))
 {
-}
+  const auto& common_data = cbc_fluds_.CBCCommonData();
 
-std::vector<double>& CBC_ASynchronousCommunicator::InitGetDownwindMessageData(
-  int location_id,
-  uint64_t cell_global_id,
-  unsigned int face_id,
-  size_t angle_set_id,
-  size_t data_size)
-{
-  MessageKey key{location_id, cell_global_id, face_id};
+  for (const auto& layout : common_data.DeplocIMessageLayouts())
+  {
+    OutgoingLocation outgoing_location;
+    outgoing_location.slot_queued_.assign(layout.slots.size(), false);
+    outgoing_location.pending_slots_.reserve(layout.slots.size());
+    outgoing_location.send_buffer_.resize(
+      MaxMessageSize(layout.slots.size(), layout.num_face_nodes));
 
-  std::vector<double>& data = outgoing_message_queue_[key];
-  if (data.empty())
-    data.assign(data_size, 0.0);
+    outgoing_locations_.push_back(std::move(outgoing_location));
+  }
 
-  return data;
+  for (const auto& layout : common_data.PrelocIMessageLayouts())
+    receive_buffers_.emplace_back(
+      MaxMessageSize(layout.slots.size(), layout.num_face_nodes));
 }
 
-bool CBC_ASynchronousCommunicator::SendData()
+size_t
+CBC_ASynchronousCommunicator::MaxMessageSize(size_t num_slots,
+                                             size_t num_face_nodes) const
+{
+  return num_slots * sizeof(unsigned int) +
+         num_face_nodes * cbc_fluds_.GroupAngleStride() * sizeof(double);
+}
+
+double*
+CBC_ASynchronousCommunicator::InitGetDownwindMessageData(uint64_t cell_local_id,
+                                                         unsigned int face_id)
 {
-  typedef int MPIRank;
+  const auto& slot_index =
+    cbc_fluds_.CBCCommonData().GetFaceSlotIndex(cell_local_id, face_id);
 
-  // First we convert any new outgoing messages from the queue into
-  // buffer messages. We aggregate these messages per location-id
-  // they need to be sent to
-  if (not outgoing_message_queue_.empty())
+  // A face is only ever swept by the thread executing its cell, therefore
+  // only queuing the slot requires the lock.
+  auto& outgoing_location = outgoing_locations_[slot_index.location_index];
+  if (not outgoing_location.slot_queued_[slot_index.slot])
   {
-    std::map<MPIRank, BufferItem> locI_buffer_map;
+    outgoing_location.slot_queued_[slot_index.slot] = true;
 
-    for (const auto& [msg_key, data] : outgoing_message_queue_)
-    {
-      const MPIRank locI = std::get<0>(msg_key);
-      const uint64_t cell_global_id = std::get<1>(msg_key);
-      const uint face_id = std::get<2>(msg_key);
-      const size_t data_size = data.size();
+    std::lock_guard<std::mutex> lock(outgoing_queue_mutex_);
+    outgoing_location.pending_slots_.push_back(slot_index.slot);
+  }
 
-      BufferItem& buffer_item = locI_buffer_map[locI];
+  return cbc_fluds_.GetNonLocalDownwindData(cell_local_id, face_id);
+}
 
-      buffer_item.destination_ = locI;
-      auto& buffer_array = buffer_item.data_array_;
+bool CBC_ASynchronousCommunicator::SendData()
+{
+  const auto& location_successors = fluds_.GetSPDS().GetLocationSuccessors();
+  const auto& layouts = cbc_fluds_.CBCCommonData().DeplocIMessageLayouts();
+  const size_t group_angle_stride = cbc_fluds_.GroupAngleStride();
+
+  // First we pack the queued slots of each successor location into a
+  // message, which is sent immediately. A message is a sequence of slot
+  // indices, each followed by the slot's angular fluxes.
+  for (size_t deplocI = 0; deplocI < outgoing_locations_.size(); ++deplocI)
+  {
+    auto& outgoing_location = outgoing_locations_[deplocI];
+    if (outgoing_location.pending_slots_.empty()) continue;
 
-      buffer_array.Write(cell_global_id);
-      buffer_array.Write(face_id);
-      buffer_array.Write(data_size);
+    const auto& layout = layouts[deplocI];
+    const auto& psi = cbc_fluds_.DeplocIOutgoingPsi()[deplocI];
 
-      for (const double value : data) // actual psi_data
-        buffer_array.Write(value);
-    } // for item in queue
+    const size_t message_begin = outgoing_location.send_buffer_end_;
+    std::byte* data = &outgoing_location.send_buffer_[message_begin];
+    for (const unsigned int slot_id : outgoing_location.pending_slots_)
+    {
+      const auto& slot = layout.slots[slot_id];
+      const size_t num_values = slot.num_face_nodes * group_angle_stride;
+
+      std::memcpy(data, &slot_id, sizeof(unsigned int));
+      data += sizeof(unsigned int);
+      std::memcpy(data,
+                  &psi[slot.node_offset * group_angle_stride],
+                  num_values * sizeof(double));
+      data += num_values * sizeof(double);
+    }
+    outgoing_location.pending_slots_.clear();
 
-    for (auto& [locI, buffer] : locI_buffer_map)
-      send_buffer_.push_back(std::move(buffer));
+    const size_t message_end = data - outgoing_location.send_buffer_.data();
+    outgoing_location.send_buffer_end_ = message_end;
 
-    outgoing_message_queue_.clear();
-  } // if there are outgoing messages
+    const int locJ = location_successors[deplocI];
+    BufferItem buffer_item;
+    buffer_item.destination_ = locJ;
+    send_buffer_.push_back(buffer_item);
 
-  // Now we attempt to flush items in the send buffer
+    chi::MPI_Info::Call(
+      MPI_Isend(&outgoing_location.send_buffer_[message_begin], // buf
+                static_cast<int>(message_end - message_begin),  // count
+                MPI_BYTE,                                       //
+                comm_set_.MapIonJ(locJ, locJ),                  // destination
+                static_cast<int>(angle_set_id_),                // tag
+                comm_set_.LocICommunicator(locJ),               // comm
+                &send_buffer_.back().mpi_request_));            // request
+  } // for deplocI
+
+  // Now we test the completion of the items in the send buffer
   bool all_messages_sent = true;
   for (auto& buffer_item : send_buffer_)
   {
-    if (not buffer_item.send_initiated_)
-    {
-      const int locJ = buffer_item.destination_;
-      chi::MPI_Info::Call(
-        MPI_Isend(buffer_item.data_array_.Data().data(),            // buf
-                  static_cast<int>(buffer_item.data_array_.Size()), // count
-                  MPI_BYTE,                                         //
-                  comm_set_.MapIonJ(locJ, locJ),    // destination
-                  static_cast<int>(angle_set_id_),  // tag
-                  comm_set_.LocICommunicator(locJ), // comm
-                  &buffer_item.mpi_request_));      // request
-      buffer_item.send_initiated_ = true;
-    }
-
     if (not buffer_item.completed_)
     {
       int sent;
@@ -110,15 +138,17 @@ bool CBC_ASynchronousCommunicator::SendData()
   return all_messages_sent;
 }
 
-std::vector<uint64_t> CBC_ASynchronousCommunicator::ReceiveData()
+const std::vector<uint64_t>& CBC_ASynchronousCommunicator::ReceiveData()
 {
-  typedef std::pair<uint64_t, uint> CellFaceKey; // cell_gid + face_id
+  const auto& layouts = cbc_fluds_.CBCCommonData().PrelocIMessageLayouts();
+  const size_t group_angle_stride = cbc_fluds_.GroupAngleStride();
 
-  std::map<CellFaceKey, std::vector<double>> received_messages;
-  std::vector<uint64_t> cells_who_received_data;
+  cells_who_received_data_.clear();
   auto& location_dependencies = fluds_.GetSPDS().GetLocationDependencies();
-  for (int locJ : location_dependencies)
+  for (size_t prelocI = 0; prelocI < location_dependencies.size(); ++prelocI)
   {
+    const int locJ = location_dependencies[prelocI];
+
     int message_available = 0;
     MPI_Status status;
     chi::MPI_Info::Call(
@@ -132,7 +162,7 @@ std::vector<uint64_t> CBC_ASynchronousCommunicator::ReceiveData()
     {
       int num_items;
       MPI_Get_count(&status, MPI_BYTE, &num_items);
-      std::vector<std::byte> recv_buffer(num_items);
+      auto& recv_buffer = receive_buffers_[prelocI];
       chi::MPI_Info::Call(
         MPI_Recv(recv_buffer.data(),                            // recv_buffer
                  num_items,                                     // count
@@ -142,29 +172,43 @@ std::vector<uint64_t> CBC_ASynchronousCommunicator::ReceiveData()
                  comm_set_.LocICommunicator(Chi::mpi.location_id), // comm
                  MPI_STATUS_IGNORE));                              // status
 
-      chi_data_types::ByteArray data_array(recv_buffer);
+      //====================================== Scatter the slots
+      const auto& layout = layouts[prelocI];
+      auto& psi = cbc_fluds_.PrelocIOutgoingPsi()[prelocI];
 
-      while (not data_array.EndOfBuffer())
+      const std::byte* data = recv_buffer.data();
+      const std::byte* data_end = data + num_items;
+      while (data < data_end)
       {
-        const uint64_t cell_global_id = data_array.Read<uint64_t>();
-        const uint face_id = data_array.Read<uint>();
-        const size_t data_size = data_array.Read<size_t>();
-
-        std::vector<double> psi_data;
-        psi_data.reserve(data_size);
-        for (size_t k = 0; k < data_size; ++k)
-          psi_data.push_back(data_array.Read<double>());
-
-        received_messages[{cell_global_id, face_id}] = std::move(psi_data);
-        cells_who_received_data.push_back(
-          fluds_.GetSPDS().Grid().MapCellGlobalID2LocalID(cell_global_id));
+        unsigned int slot_id;
+        std::memcpy(&slot_id, data, sizeof(unsigned int));
+        data += sizeof(unsigned int);
+
+        const auto& slot = layout.slots[slot_id];
+        const size_t num_values = slot.num_face_nodes * group_angle_stride;
+        std::memcpy(&psi[slot.node_offset * group_angle_stride],
+                    data,
+                    num_values * sizeof(double));
+        data += num_values * sizeof(double);
+
+        cells_who_received_data_.push_back(slot.cell_local_id);
       } // while not at end of buffer
-    }// Process each message embedded in buffer
+    }   // Process each message embedded in buffer
   }
 
-  cbc_fluds_.DeplocsOutgoingMessages().merge(received_messages);
+  return cells_who_received_data_;
+}
 
-  return cells_who_received_data;
+void CBC_ASynchronousCommunicator::Reset()
+{
+  for (auto& outgoing_location : outgoing_locations_)
+  {
+    outgoing_location.slot_queued_.assign(
+      outgoing_location.slot_queued_.size(), false);
+    outgoing_location.pending_slots_.clear();
+    outgoing_location.send_buffer_end_ = 0;
+  }
+  send_buffer_.clear();
 }
 
-} // namespace lbs
\ No newline at end of file
+} // namespace lbs
@@ -3,29 +3,29 @@
 
 #include <cstdint>
 #include <cstddef>
-#include <map>
+#include <mutex>
 #include <vector>
 
 #include "mesh/SweepUtilities/Communicators/AsyncComm.h"
 
 #include "chi_mpi.h"
-#include "data_types/byte_array.h"
 
 namespace chi
 {
 class ChiMPICommunicatorSet;
 }
 
-namespace chi_data_types
-{
-class ByteArray;
-}
-
 namespace lbs
 {
 
 class CBC_FLUDS;
 
+/**Communicator of the cell-by-cell sweeps. Outgoing face data is written
+ * directly into the flat, per successor location buffers of the CBC_FLUDS.
+ * Faces are identified by their slot in the layout of CBC_FLUDSCommonData,
+ * so messages carry only a slot index per face and are scattered on arrival
+ * into the per predecessor location buffers. All buffers are allocated once
+ * so that no allocation or tree lookup happens during sweeps.*/
 class CBC_ASynchronousCommunicator
   : public chi_mesh::sweep_management::AsynchronousCommunicator
 {
@@ -35,40 +35,52 @@ public:
     chi_mesh::sweep_management::FLUDS& fluds,
     const chi::ChiMPICommunicatorSet& comm_set);
 
-  // location_id
-  // cell_global_id
-  // face_id
-  typedef std::tuple<int, uint64_t, unsigned int> MessageKey;
-
-  std::vector<double>& InitGetDownwindMessageData(int location_id,
-                                                  uint64_t cell_global_id,
-                                                  unsigned int face_id,
-                                                  size_t angle_set_id,
-                                                  size_t data_size) override;
+  double* InitGetDownwindMessageData(uint64_t cell_local_id,
+                                     unsigned int face_id) override;
 
   bool SendData();
-  std::vector<uint64_t> ReceiveData();
+  /**Receives available upstream data and returns the local ids of the
+   * cells, one entry per received face.*/
+  const std::vector<uint64_t>& ReceiveData();
 
-  void Reset()
-  {
-    outgoing_message_queue_.clear();
-    send_buffer_.clear();
-  }
+  void Reset();
 
 protected:
   const size_t angle_set_id_;
   CBC_FLUDS& cbc_fluds_;
-  std::map<MessageKey, std::vector<double>> outgoing_message_queue_;
+
+  /**Sending state of a successor location.*/
+  struct OutgoingLocation
+  {
+    /**Flag per slot indicating that the slot was queued this sweep.*/
+    std::vector<char> slot_queued_;
+    /**Queued slots not yet packed into a message.*/
+    std::vector<unsigned int> pending_slots_;
+    /**Messages are packed back-to-back into this buffer, which is sized
+     * to hold every slot once.*/
+    std::vector<std::byte> send_buffer_;
+    size_t send_buffer_end_ = 0;
+  };
+  std::vector<OutgoingLocation> outgoing_locations_;
+  /**Guards the pending slots when cells are swept by several threads.*/
+  std::mutex outgoing_queue_mutex_;
+
+  /**Receive buffer per predecessor location, large enough for a message
+   * holding all the slots.*/
+  std::vector<std::vector<std::byte>> receive_buffers_;
+  std::vector<uint64_t> cells_who_received_data_;
 
   struct BufferItem
   {
     int destination_ = 0;
-    MPI_Request mpi_request_ = 0;
-    bool send_initiated_ = false;
+    MPI_Request mpi_request_ = MPI_REQUEST_NULL;
     bool completed_ = false;
-    chi_data_types::ByteArray data_array_;
   };
   std::vector<BufferItem> send_buffer_;
+
+  /**Returns the number of bytes of a message holding all the slots of
+   * the given layout.*/
+  size_t MaxMessageSize(size_t num_slots, size_t num_face_nodes) const;
 };
 
 } // namespace lbs
@@ -20,6 +20,16 @@ CBC_FLUDS::CBC_FLUDS(size_t num_groups,
     psi_uk_man_(psi_uk_man),
     sdm_(sdm)
 {
+  //============================================= Allocate the non-local
+  //                                              buffers once, they are
+  //                                              overwritten every sweep
+  for (const auto& layout : common_data_.DeplocIMessageLayouts())
+    deplocI_outgoing_psi_.emplace_back(
+      layout.num_face_nodes * num_groups_and_angles_, 0.0);
+
+  for (const auto& layout : common_data_.PrelocIMessageLayouts())
+    prelocI_outgoing_psi_.emplace_back(
+      layout.num_face_nodes * num_groups_and_angles_, 0.0);
 }
 
 const chi_mesh::sweep_management::FLUDSCommonData& CBC_FLUDS::CommonData() const
@@ -42,15 +52,34 @@ CBC_FLUDS::GetLocalCellUpwindPsi(const std::vector<double>& psi_data_block,
   return &psi_data_block[dof_map];
 }
 
-const std::vector<double>&
-CBC_FLUDS::GetNonLocalUpwindData(uint64_t cell_global_id,
-                                 unsigned int face_id) const
+/**Returns the received angular fluxes of a non-local incoming face.*/
+const double* CBC_FLUDS::GetNonLocalUpwindData(uint64_t cell_local_id,
+                                               unsigned int face_id) const
+{
+  const auto& slot_index = common_data_.GetFaceSlotIndex(cell_local_id, face_id);
+  const auto& layout =
+    common_data_.PrelocIMessageLayouts()[slot_index.location_index];
+  const auto& slot = layout.slots[slot_index.slot];
+
+  return &prelocI_outgoing_psi_[slot_index.location_index]
+                               [slot.node_offset * num_groups_and_angles_];
+}
+
+/**Returns the storage of the angular fluxes of a non-local outgoing face.*/
+double* CBC_FLUDS::GetNonLocalDownwindData(uint64_t cell_local_id,
+                                           unsigned int face_id)
 {
-  return deplocs_outgoing_messages_.at({cell_global_id, face_id});
+  const auto& slot_index = common_data_.GetFaceSlotIndex(cell_local_id, face_id);
+  const auto& layout =
+    common_data_.DeplocIMessageLayouts()[slot_index.location_index];
+  const auto& slot = layout.slots[slot_index.slot];
+
+  return &deplocI_outgoing_psi_[slot_index.location_index]
+                               [slot.node_offset * num_groups_and_angles_];
 }
 
 const double*
-CBC_FLUDS::GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
+CBC_FLUDS::GetNonLocalUpwindPsi(const double* psi_data,
                                 unsigned int face_node_mapped,
                                 unsigned int angle_set_index)
 {
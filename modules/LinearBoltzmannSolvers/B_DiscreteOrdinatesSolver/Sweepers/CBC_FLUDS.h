@@ -4,7 +4,6 @@
 #include "mesh/SweepUtilities/FLUDS/FLUDS.h"
 #include "CBC_FLUDSCommonData.h"
 
-#include <map>
 #include <functional>
 
 namespace chi_math
@@ -32,23 +31,25 @@ public:
             const chi_math::SpatialDiscretization& sdm);
 
   const chi_mesh::sweep_management::FLUDSCommonData& CommonData() const;
+  const CBC_FLUDSCommonData& CBCCommonData() const { return common_data_; }
+
+  /**Returns the number of values per face node in the non-local buffers.*/
+  size_t GroupAngleStride() const { return num_groups_and_angles_; }
 
   const std::vector<double>& GetLocalUpwindDataBlock() const;
 
   const double* GetLocalCellUpwindPsi(const std::vector<double>& psi_data_block,
                                       const chi_mesh::Cell& cell);
 
-  const std::vector<double>& GetNonLocalUpwindData(uint64_t cell_global_id,
-                                                   unsigned int face_id) const;
+  const double* GetNonLocalUpwindData(uint64_t cell_local_id,
+                                      unsigned int face_id) const;
+  double* GetNonLocalDownwindData(uint64_t cell_local_id,
+                                  unsigned int face_id);
 
-  const double* GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
+  const double* GetNonLocalUpwindPsi(const double* psi_data,
                                      unsigned int face_node_mapped,
                                      unsigned int angle_set_index);
 
-  void ClearLocalAndReceivePsi() override
-  {
-    deplocs_outgoing_messages_.clear();
-  }
   void ClearSendPsi() override {}
   void AllocateInternalLocalPsi(size_t num_grps, size_t num_angles) override {}
   void AllocateOutgoingPsi(size_t num_grps,
@@ -94,13 +95,13 @@ public:
     return delayed_prelocI_outgoing_psi_old_;
   }
 
-  // cell_global_id
-  // face_id
-  typedef std::pair<uint64_t, unsigned int> CellFaceKey;
-
-  std::map<CellFaceKey, std::vector<double>>& DeplocsOutgoingMessages()
+  std::vector<std::vector<float>>& DeplocIOutgoingPsiSingle() override
+  {
+    return deplocI_outgoing_psi_single_;
+  }
+  std::vector<std::vector<float>>& PrelocIOutgoingPsiSingle() override
   {
-    return deplocs_outgoing_messages_;
+    return prelocI_outgoing_psi_single_;
   }
 
 private:
@@ -111,6 +112,8 @@ private:
 
   std::vector<double> delayed_local_psi_;
   std::vector<double> delayed_local_psi_old_;
+  /**Non-local angular fluxes, per successor and predecessor location, in
+   * the slot layout of CBC_FLUDSCommonData.*/
   std::vector<std::vector<double>> deplocI_outgoing_psi_;
   std::vector<std::vector<double>> prelocI_outgoing_psi_;
   std::vector<std::vector<double>> boundryI_incoming_psi_;
@@ -118,7 +121,8 @@ private:
   std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_;
   std::vector<std::vector<double>> delayed_prelocI_outgoing_psi_old_;
 
-  std::map<CellFaceKey, std::vector<double>> deplocs_outgoing_messages_;
+  std::vector<std::vector<float>> deplocI_outgoing_psi_single_;
+  std::vector<std::vector<float>> prelocI_outgoing_psi_single_;
 };
 
 } // namespace lbs
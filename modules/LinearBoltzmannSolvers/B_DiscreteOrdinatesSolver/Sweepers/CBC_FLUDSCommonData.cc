@@ -3,6 +3,8 @@
 #include "mesh/SweepUtilities/SPDS/SPDS.h"
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
+#include <algorithm>
+
 namespace lbs
 {
 
@@ -12,7 +14,96 @@ CBC_FLUDSCommonData::CBC_FLUDSCommonData(
     grid_nodal_mappings)
   : chi_mesh::sweep_management::FLUDSCommonData(spds, grid_nodal_mappings)
 {
-}
+  using FaceOrientation = chi_mesh::sweep_management::FaceOrientation;
+
+  const auto& grid = spds.Grid();
+  const auto& cell_face_orientations = spds.CellFaceOrientations();
+
+  //============================================= Collect non-local faces
+  // The key identifies the face on the receiving side, which is known to
+  // both locations.
+  struct SlotKey
+  {
+    uint64_t recv_cell_global_id;
+    unsigned int recv_face_id;
+    MessageSlot slot;
+  };
+  std::vector<std::vector<SlotKey>> deplocI_keys(
+    spds.GetLocationSuccessors().size());
+  std::vector<std::vector<SlotKey>> prelocI_keys(
+    spds.GetLocationDependencies().size());
+
+  const size_t num_local_cells = grid.local_cells.size();
+  cell_face_offsets_.assign(num_local_cells, 0);
+  for (const auto& cell : grid.local_cells)
+  {
+    cell_face_offsets_[cell.local_id_] = face_slot_indices_.size();
+    face_slot_indices_.resize(face_slot_indices_.size() + cell.faces_.size());
+
+    unsigned int f = 0;
+    for (const auto& face : cell.faces_)
+    {
+      if (face.has_neighbor_ and not face.IsNeighborLocal(grid))
+      {
+        const int locJ = face.GetNeighborPartitionID(grid);
+        const auto& nodal_mapping = grid_nodal_mappings[cell.local_id_][f];
+
+        MessageSlot slot;
+        slot.cell_local_id = cell.local_id_;
+        slot.face_id = f;
+        slot.num_face_nodes = nodal_mapping.face_node_mapping_.size();
 
+        if (cell_face_orientations[cell.local_id_][f] ==
+            FaceOrientation::OUTGOING)
+          deplocI_keys[spds.MapLocJToDeplocI(locJ)].push_back(
+            {face.neighbor_id_,
+             static_cast<unsigned int>(nodal_mapping.associated_face_),
+             slot});
+        else
+          prelocI_keys[spds.MapLocJToPrelocI(locJ)].push_back(
+            {cell.global_id_, f, slot});
+      }
+      ++f;
+    } // for face
+  }   // for cell
+
+  //============================================= Order slots and assign
+  //                                              offsets
+  auto BuildLayouts = [this](std::vector<std::vector<SlotKey>>& location_keys,
+                             std::vector<LocationMessageLayout>& layouts)
+  {
+    layouts.assign(location_keys.size(), {});
+    for (size_t locI = 0; locI < location_keys.size(); ++locI)
+    {
+      auto& keys = location_keys[locI];
+      std::sort(keys.begin(),
+                keys.end(),
+                [](const SlotKey& a, const SlotKey& b)
+                {
+                  if (a.recv_cell_global_id != b.recv_cell_global_id)
+                    return a.recv_cell_global_id < b.recv_cell_global_id;
+                  return a.recv_face_id < b.recv_face_id;
+                });
+
+      auto& layout = layouts[locI];
+      layout.slots.reserve(keys.size());
+      for (auto& key : keys)
+      {
+        key.slot.node_offset = layout.num_face_nodes;
+        layout.num_face_nodes += key.slot.num_face_nodes;
+
+        auto& face_slot_index = face_slot_indices_
+          [cell_face_offsets_[key.slot.cell_local_id] + key.slot.face_id];
+        face_slot_index.location_index = static_cast<int>(locI);
+        face_slot_index.slot = static_cast<unsigned int>(layout.slots.size());
+
+        layout.slots.push_back(key.slot);
+      }
+    } // for location
+  };
+
+  BuildLayouts(deplocI_keys, deplocI_message_layouts_);
+  BuildLayouts(prelocI_keys, prelocI_message_layouts_);
+}
 
-} // namespace lbs
\ No newline at end of file
+} // namespace lbs
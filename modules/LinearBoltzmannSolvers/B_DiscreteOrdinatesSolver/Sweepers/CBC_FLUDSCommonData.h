@@ -4,6 +4,7 @@
 #include "mesh/SweepUtilities/FLUDS/FLUDSCommonData.h"
 
 #include <cinttypes>
+#include <cstddef>
 
 namespace lbs
 {
@@ -11,11 +12,62 @@ namespace lbs
 class CBC_FLUDSCommonData : public chi_mesh::sweep_management::FLUDSCommonData
 {
 public:
+  /**Non-local face whose angular fluxes are exchanged with a neighboring
+   * location.*/
+  struct MessageSlot
+  {
+    uint64_t cell_local_id = 0;
+    unsigned int face_id = 0;
+    /**Offset, in face nodes, into the buffer of the location.*/
+    size_t node_offset = 0;
+    size_t num_face_nodes = 0;
+  };
+
+  /**The slots of all the faces exchanged with a single location. Slots are
+   * ordered by the global id and face index of the receiving cell so that
+   * the sending and receiving locations agree on the slot numbering
+   * without communication.*/
+  struct LocationMessageLayout
+  {
+    std::vector<MessageSlot> slots;
+    size_t num_face_nodes = 0;
+  };
+
+  /**Location index (the deplocI of an outgoing face, the prelocI of an
+   * incoming face) and slot of a cell face. The location index is -1 for
+   * faces that are not exchanged with another location.*/
+  struct FaceSlotIndex
+  {
+    int location_index = -1;
+    unsigned int slot = 0;
+  };
+
   CBC_FLUDSCommonData(
     const chi_mesh::sweep_management::SPDS& spds,
     const std::vector<chi_mesh::sweep_management::CellFaceNodalMapping>&
       grid_nodal_mappings);
 
+  const std::vector<LocationMessageLayout>& DeplocIMessageLayouts() const
+  {
+    return deplocI_message_layouts_;
+  }
+  const std::vector<LocationMessageLayout>& PrelocIMessageLayouts() const
+  {
+    return prelocI_message_layouts_;
+  }
+
+  const FaceSlotIndex& GetFaceSlotIndex(uint64_t cell_local_id,
+                                        unsigned int face_id) const
+  {
+    return face_slot_indices_[cell_face_offsets_[cell_local_id] + face_id];
+  }
+
+private:
+  std::vector<LocationMessageLayout> deplocI_message_layouts_;
+  std::vector<LocationMessageLayout> prelocI_message_layouts_;
+
+  std::vector<size_t> cell_face_offsets_;
+  std::vector<FaceSlotIndex> face_slot_indices_;
 };
 
 } // namespace lbs
@@ -0,0 +1,87 @@
+#ifndef CHITECH_CBC_READYQUEUE_H
+#define CHITECH_CBC_READYQUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+
+namespace lbs
+{
+
+// ###################################################################
+/**Bounded, lock-free, multi-producer/multi-consumer queue of task numbers.
+ *
+ * During a sweep every cell task becomes ready exactly once, hence the
+ * capacity equals the number of tasks and slots never have to be recycled
+ * before the next call to Reset. Producers claim a slot with a single
+ * fetch-add and publish the task number into it. Consumers claim the next
+ * unread slot with a compare-exchange and wait for its publication.*/
+class CBC_ReadyQueue
+{
+public:
+  /**Clears the queue and makes room for `capacity` pushes.*/
+  void Reset(size_t capacity)
+  {
+    if (capacity != capacity_)
+    {
+      slots_ = std::make_unique<std::atomic<uint64_t>[]>(capacity);
+      capacity_ = capacity;
+    }
+    for (size_t i = 0; i < capacity_; ++i)
+      slots_[i].store(EMPTY_SLOT, std::memory_order_relaxed);
+
+    push_index_.store(0);
+    pop_index_.store(0);
+  }
+
+  /**Adds a task number to the queue.*/
+  void Push(uint64_t task_number)
+  {
+    const size_t i = push_index_.fetch_add(1, std::memory_order_acq_rel);
+    slots_[i].store(task_number, std::memory_order_release);
+  }
+
+  /**Removes a task number from the queue if one is available.*/
+  bool TryPop(uint64_t& task_number)
+  {
+    size_t p = pop_index_.load(std::memory_order_acquire);
+    while (p < push_index_.load(std::memory_order_acquire))
+    {
+      if (pop_index_.compare_exchange_weak(p, p + 1,
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_acquire))
+      {
+        // The producer has claimed the slot but might not have published it
+        uint64_t value;
+        while ((value = slots_[p].load(std::memory_order_acquire)) ==
+               EMPTY_SLOT)
+          std::this_thread::yield();
+
+        task_number = value;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**Returns true if all pushed task numbers have been popped.*/
+  bool Empty() const
+  {
+    return pop_index_.load(std::memory_order_acquire) >=
+           push_index_.load(std::memory_order_acquire);
+  }
+
+private:
+  static constexpr uint64_t EMPTY_SLOT = std::numeric_limits<uint64_t>::max();
+
+  std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+  size_t capacity_ = 0;
+  std::atomic<size_t> push_index_{0};
+  std::atomic<size_t> pop_index_{0};
+};
+
+} // namespace lbs
+
+#endif // CHITECH_CBC_READYQUEUE_H
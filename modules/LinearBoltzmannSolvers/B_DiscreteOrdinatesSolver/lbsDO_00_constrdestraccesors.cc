@@ -2,6 +2,8 @@
 
 #include "ChiObjectFactory.h"
 
+#include "chi_log_exceptions.h"
+
 namespace lbs
 {
 RegisterChiObject(lbs, DiscreteOrdinatesSolver);
@@ -30,9 +32,47 @@ chi::InputParameters lbs::DiscreteOrdinatesSolver::GetInputParameters()
   params.AddOptionalParameter(
     "sweep_type", "AAH", "The sweep type to use for sweep operatorations.");
 
+  params.AddOptionalParameter(
+    "sweep_num_threads",
+    1,
+    "The number of threads used for sweeping on each location. With "
+    "sweep_type \"AAH\" ready angle sets are executed concurrently, each "
+    "worker thread accumulating the flux moments in private storage. With "
+    "sweep_type \"CBC\" the ready cells of an angle set are executed "
+    "concurrently. Requires MPI_THREAD_FUNNELED support from MPI, otherwise "
+    "a single thread is used.");
+
+  params.AddOptionalParameter(
+    "single_precision_psi",
+    false,
+    "If true, the angular fluxes stored on faces during sweeps, the sweep "
+    "MPI messages and, when \"save_angular_flux\" is true, the saved "
+    "angular fluxes are stored in single precision. Cell solves remain in "
+    "double precision. Halves the memory and message volume of angular "
+    "fluxes. Only supported with sweep_type \"AAH\".");
+
+  params.AddOptionalParameter(
+    "sweep_pipelining",
+    false,
+    "If true, the group subsets of each angle set are swept as the chunks of "
+    "a pipeline: downstream messages of chunk k are progressed while chunk "
+    "k+1 is swept. The groupset's number of group subsets is then set from "
+    "\"sweep_pipeline_chunk_size\", overriding \"groupset_num_subsets\". "
+    "Only supported with sweep_type \"AAH\" and a single sweep thread.");
+
+  params.AddOptionalParameter(
+    "sweep_pipeline_chunk_size",
+    0,
+    "The number of groups per pipeline chunk when \"sweep_pipelining\" is "
+    "true. A value of 0 tunes the chunk size automatically from the measured "
+    "cost of a cell solve, the measured message latency and the number of "
+    "pipeline stages of the sweep.");
+
   using namespace chi_data_types;
   params.ConstrainParameterRange("sweep_type",
                                  AllowableRangeList::New({"AAH", "CBC"}));
+  params.ConstrainParameterRange("sweep_num_threads",
+                                 AllowableRangeLowLimit::New(1));
 
   return params;
 }
@@ -43,8 +83,24 @@ lbs::DiscreteOrdinatesSolver::DiscreteOrdinatesSolver(
   : LBSSolver(params),
     verbose_sweep_angles_(
       params.GetParamVectorValue<size_t>("directions_sweep_order_to_print")),
-    sweep_type_(params.GetParamValue<std::string>("sweep_type"))
+    sweep_type_(params.GetParamValue<std::string>("sweep_type")),
+    sweep_num_threads_(params.GetParamValue<size_t>("sweep_num_threads")),
+    single_precision_psi_(params.GetParamValue<bool>("single_precision_psi")),
+    sweep_pipelining_(params.GetParamValue<bool>("sweep_pipelining")),
+    sweep_pipeline_chunk_size_(
+      params.GetParamValue<size_t>("sweep_pipeline_chunk_size"))
 {
+  ChiInvalidArgumentIf(single_precision_psi_ and sweep_type_ != "AAH",
+                       "\"single_precision_psi\" is only supported with "
+                       "sweep_type \"AAH\".");
+  ChiInvalidArgumentIf(sweep_pipelining_ and sweep_type_ != "AAH",
+                       "\"sweep_pipelining\" is only supported with "
+                       "sweep_type \"AAH\".");
+  ChiInvalidArgumentIf(sweep_pipelining_ and sweep_num_threads_ > 1,
+                       "\"sweep_pipelining\" is not supported with "
+                       "\"sweep_num_threads\" > 1. Threaded sweeps execute "
+                       "ready angle sets concurrently and do not follow the "
+                       "pipeline order.");
 }
 
 /**Destructor for LBS*/
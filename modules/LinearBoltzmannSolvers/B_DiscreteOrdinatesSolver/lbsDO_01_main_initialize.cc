@@ -15,6 +15,19 @@ void lbs::DiscreteOrdinatesSolver::Initialize()
 {
   LBSSolver::Initialize();
 
+  //================================================== Move saved angular
+  //                                                   fluxes to single
+  //                                                   precision storage
+  if (single_precision_psi_)
+    for (auto& groupset : groupsets_)
+    {
+      auto& psi = psi_new_local_[groupset.id_];
+      if (psi.empty()) continue;
+
+      psi_new_local_single_[groupset.id_].assign(psi.begin(), psi.end());
+      std::vector<double>().swap(psi);
+    }
+
   auto src_function = std::make_shared<SourceFunction>(*this);
 
   // Initialize source func
@@ -27,6 +40,7 @@ void lbs::DiscreteOrdinatesSolver::Initialize()
   InitializeSweepDataStructures();
   for (auto& groupset : groupsets_)
   {
+    if (sweep_pipelining_) TuneGroupsetPipelining(groupset);
     InitFluxDataStructures(groupset);
 
     InitWGDSA(groupset);
@@ -41,6 +55,20 @@ void lbs::DiscreteOrdinatesSolver::Initialize()
 void lbs::DiscreteOrdinatesSolver::InitializeWGSSolvers()
 {
   wgs_solvers_.clear(); //this is required
+
+  //=================================== Worker threads require that the main
+  //                                    thread can make MPI calls while they
+  //                                    are active
+  size_t num_threads = sweep_num_threads_;
+  if (num_threads > 1 and Chi::mpi.thread_support < MPI_THREAD_FUNNELED)
+  {
+    Chi::log.Log0Warning()
+      << TextName() << ": The MPI library does not provide "
+      << "MPI_THREAD_FUNNELED support. Sweeps will be executed with a single "
+      << "thread.";
+    num_threads = 1;
+  }
+
   for (auto& groupset : groupsets_)
   {
     std::shared_ptr<SweepChunk> sweep_chunk = SetSweepChunk(groupset);
@@ -55,6 +83,18 @@ void lbs::DiscreteOrdinatesSolver::InitializeWGSSolvers()
         options_.verbose_inner_iterations,
         sweep_chunk);
 
+    //=================================== Each additional thread needs its own
+    //                                    sweep chunk and scratch data
+    if (num_threads > 1)
+    {
+      std::vector<std::shared_ptr<SweepChunk>> worker_sweep_chunks;
+      for (size_t t = 1; t < num_threads; ++t)
+        worker_sweep_chunks.push_back(SetSweepChunk(groupset));
+
+      sweep_wgs_context_ptr->sweep_scheduler_.EnableThreadedExecution(
+        std::move(worker_sweep_chunks));
+    }
+
     auto wgs_solver =
       std::make_shared<WGSLinearSolver<Mat,Vec,KSP>>(sweep_wgs_context_ptr);
 
@@ -50,10 +50,9 @@ void lbs::DiscreteOrdinatesSolver::ComputeBalance()
   {
     const auto&  cell_mapping     = discretization_->GetCellMapping(cell);
     const auto&  transport_view   = cell_transport_views_[cell.local_id_];
-    const auto&  fe_intgrl_values = unit_cell_matrices_[cell.local_id_];
+    const auto   fe_intgrl_values = unit_cell_matrices_[cell.local_id_];
     const size_t num_nodes        = transport_view.NumNodes();
-    const auto&  IntV_shapeI      = fe_intgrl_values.Vi_vectors;
-    const auto&  IntS_shapeI      = fe_intgrl_values.face_Si_vectors;
+    const auto   IntV_shapeI      = fe_intgrl_values.Vi();
 
     //====================================== Inflow
     // This is essentially an integration over
@@ -78,7 +77,7 @@ void lbs::DiscreteOrdinatesSolver::ComputeBalance()
             for (int fi = 0; fi < face.vertex_ids_.size(); ++fi)
             {
               const int i = cell_mapping.MapFaceNode(f, fi);
-              const auto &IntFi_shapeI = IntS_shapeI[f][i];
+              const double IntFi_shapeI = fe_intgrl_values.FaceSi(f)[i];
 
               for (const auto& group : groupset.groups_)
               {
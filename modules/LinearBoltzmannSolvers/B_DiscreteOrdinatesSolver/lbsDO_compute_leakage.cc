@@ -29,6 +29,10 @@ std::vector<double> lbs::DiscreteOrdinatesSolver::
 
   const size_t num_angles = quadrature->omegas_.size();
 
+  const auto& psi_double = psi_new_local_[groupset_id];
+  const auto& psi_single = psi_new_local_single_[groupset_id];
+  const bool single_precision = not psi_single.empty();
+
   const int gsi = groupset.groups_.front().id_;
   const int gsf = groupset.groups_.back().id_;
   const int gs_num_groups = gsf+1-gsi;
@@ -38,14 +42,14 @@ std::vector<double> lbs::DiscreteOrdinatesSolver::
   for (const auto& cell : grid_ptr_->local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto& fe_values = unit_cell_matrices_[cell.local_id_];
+    const auto fe_values = unit_cell_matrices_[cell.local_id_];
 
     size_t f=0;
     for (const auto& face : cell.faces_)
     {
       if (not face.has_neighbor_ and face.neighbor_id_ == boundary_id)
       {
-        const auto& IntF_shapeI = fe_values.face_Si_vectors[f];
+        const auto IntF_shapeI = fe_values.FaceSi(f);
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
         for (size_t fi=0; fi<num_face_nodes; ++fi)
         {
@@ -62,7 +66,8 @@ std::vector<double> lbs::DiscreteOrdinatesSolver::
                 const int g = gi+gsi;
                 const int64_t imap = sdm.MapDOFLocal(cell, i, psi_uk_man, n, g);
 
-                const double psi = psi_new_local_[groupset_id][imap];
+                const double psi = single_precision ? psi_single[imap]
+                                                    : psi_double[imap];
 
                 local_leakage[gi] += weight * mu * psi * IntF_shapeI[i];
               }//for g
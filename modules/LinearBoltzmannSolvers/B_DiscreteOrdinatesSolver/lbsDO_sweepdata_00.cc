@@ -2,9 +2,11 @@
 
 #include "mesh/MeshHandler/chi_meshhandler.h"
 #include "mesh/VolumeMesher/chi_volumemesher.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "chi_mpi.h"
 #include "utils/chi_timer.h"
 #include "utils/chi_utils.h"
 
@@ -124,6 +126,44 @@ void DiscreteOrdinatesSolver::InitializeSweepDataStructures()
     }
   } // quadrature info-pack
 
+  //=================================== Report sweep parallel efficiency
+  // The work of a cell is taken as its number of vertices, the same
+  // measure the sweep-aware partitioner predicts its efficiency with. This
+  // is a diagnostic, only gathered at verbosity level 1 and higher.
+  if (sweep_type_ == "AAH" and
+      Chi::log.GetVerbosity() >= chi::ChiLog::LOG_LVL::LOG_0VERBOSE_1)
+  {
+    using namespace chi_mesh::sweep_management;
+    double local_work = 0.0;
+    for (const auto& cell : grid_ptr_->local_cells)
+      local_work += static_cast<double>(cell.vertex_ids_.size());
+
+    std::vector<double> location_work(Chi::mpi.process_count, 0.0);
+    MPI_Allgather(&local_work,
+                  1,
+                  MPI_DOUBLE,
+                  location_work.data(),
+                  1,
+                  MPI_DOUBLE,
+                  Chi::mpi.comm);
+
+    double efficiency = 0.0;
+    size_t num_spds = 0;
+    for (const auto& [quadrature, spds_list] : quadrature_spds_map_)
+      for (const auto& spds : spds_list)
+      {
+        const auto& aah_spds =
+          dynamic_cast<const SPDS_AdamsAdamsHawkins&>(*spds);
+        efficiency += aah_spds.ParallelEfficiency(location_work);
+        ++num_spds;
+      }
+
+    if (num_spds > 0)
+      Chi::log.Log0Verbose1()
+        << "Sweep parallel efficiency achieved by the partition: "
+        << efficiency / static_cast<double>(num_spds);
+  }
+
   //=================================== Build FLUDS templates
   quadrature_fluds_commondata_map_.clear();
   for (const auto& [quadrature, spds_list] : quadrature_spds_map_)
@@ -3,6 +3,7 @@
 #include "mesh/SweepUtilities/FLUDS/AAH_FLUDS.h"
 #include "mesh/SweepUtilities/AngleSet/AAH_AngleSet.h"
 
+#include "SweepChunks/AAH_SweepPlan.h"
 #include "Sweepers/CBC_FLUDS.h"
 #include "Sweepers/CBC_AngleSet.h"
 #include "Sweepers/CBC_AsyncComm.h"
@@ -60,11 +61,16 @@ void lbs::DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
     const auto dir_subsets =
       chi::MakeSubSets(so_grouping.size(), groupset.master_num_ang_subsets_);
 
+    // AAH sweep plans of the direction subsets, shared by all group subsets
+    std::vector<std::shared_ptr<const AAH_SweepPlan>> sweep_plans(
+      dir_subsets.size());
+
     for (size_t gs_ss = 0; gs_ss < gs_num_ss; gs_ss++)
     {
       const size_t gs_ss_size = groupset.grp_subset_infos_[gs_ss].ss_size;
-      for (const auto& dir_ss_info : dir_subsets)
+      for (size_t dir_ss = 0; dir_ss < dir_subsets.size(); ++dir_ss)
       {
+        const auto& dir_ss_info = dir_subsets[dir_ss];
         const auto& dir_ss_begin = dir_ss_info.ss_begin;
         const auto& dir_ss_end = dir_ss_info.ss_end;
         const auto& dir_ss_size = dir_ss_info.ss_size;
@@ -82,7 +88,8 @@ void lbs::DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
           std::shared_ptr<FLUDS> fluds = std::make_shared<AAH_FLUDS>(
             gs_ss_size,
             angle_indices.size(),
-            dynamic_cast<const AAH_FLUDSCommonData&>(fluds_common_data));
+            dynamic_cast<const AAH_FLUDSCommonData&>(fluds_common_data),
+            single_precision_psi_);
 
           auto angleSet =
             std::make_shared<TAAH_AngleSet>(angle_set_id++,
@@ -93,8 +100,27 @@ void lbs::DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
                                             angle_indices,
                                             sweep_boundaries_,
                                             options_.sweep_eager_limit,
+                                            options_.sweep_persistent_requests,
                                             *grid_local_comm_set_);
 
+          //=========================== The sweep plan is built once per
+          //                            direction subset of the SPDS
+          auto& sweep_plan = sweep_plans[dir_ss];
+          if (not sweep_plan)
+          {
+            std::vector<chi_mesh::Vector3> omegas;
+            for (size_t angle_index : angle_indices)
+              omegas.push_back(groupset.quadrature_->omegas_[angle_index]);
+
+            sweep_plan = std::make_shared<const AAH_SweepPlan>(
+              *grid_ptr_,
+              *discretization_,
+              cell_transport_views_,
+              *sweep_ordering,
+              omegas);
+          }
+          angleSet->SetSweepData(sweep_plan);
+
           angle_set_group.AngleSets().push_back(angleSet);
         }
         else if (sweep_type_ == "CBC")
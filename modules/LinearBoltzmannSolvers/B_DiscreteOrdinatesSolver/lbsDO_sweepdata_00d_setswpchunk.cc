@@ -27,6 +27,10 @@ lbs::DiscreteOrdinatesSolver::SetSweepChunk(LBSGroupset& groupset)
       num_moments_,
       max_cell_dof_count_);
 
+    if (not psi_new_local_single_[groupset.id_].empty())
+      sweep_chunk->SetDestinationPsiSingle(
+        psi_new_local_single_[groupset.id_]);
+
     return sweep_chunk;
   }
   else if (sweep_type_ == "CBC")
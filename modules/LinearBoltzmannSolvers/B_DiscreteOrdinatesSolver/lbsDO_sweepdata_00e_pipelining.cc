@@ -0,0 +1,264 @@
+#include "lbs_discrete_ordinates_solver.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/SweepUtilities/SPDS/SPDS_AdamsAdamsHawkins.h"
+#include "mesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
+#include "math/SpatialDiscretization/spatial_discretization.h"
+#include "math/SpatialDiscretization/CellMappings/cell_mapping_base.h"
+#include "math/chi_math_batched_solvers.h"
+
+#include "utils/chi_timer.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <set>
+#include <cmath>
+
+// ###################################################################
+/**Sets the number of group subsets of a groupset for pipelined sweeps.
+ *
+ * If "sweep_pipeline_chunk_size" is non-zero it directly sets the number
+ * of groups per subset. Otherwise the number of subsets follows from the
+ * pipeline model of SweepScheduler::OptimalNumPipelineChunks, using the
+ * number of global sweep planes as the number of stages and the measured
+ * cost of a cell solve and of neighbor messages to estimate the time of
+ * sweeping an angle set on the most loaded location. A non-default
+ * "groupset_num_subsets" of the groupset is overridden with a warning.*/
+void lbs::DiscreteOrdinatesSolver::TuneGroupsetPipelining(
+  LBSGroupset& groupset)
+{
+  typedef chi_mesh::sweep_management::SweepScheduler SweepScheduler;
+  typedef chi_mesh::sweep_management::SPDS_AdamsAdamsHawkins SPDS_AAH;
+
+  const size_t num_groups = groupset.groups_.size();
+
+  size_t num_subsets = 1;
+  if (sweep_pipeline_chunk_size_ > 0)
+    num_subsets = (num_groups + sweep_pipeline_chunk_size_ - 1) /
+                  sweep_pipeline_chunk_size_;
+  else
+  {
+    //============================================= Number of stages
+    size_t num_stages = 1;
+    for (const auto& spds : quadrature_spds_map_[groupset.quadrature_])
+    {
+      const auto& aah_spds = dynamic_cast<const SPDS_AAH&>(*spds);
+      num_stages =
+        std::max(num_stages, aah_spds.GetGlobalSweepPlanes().size());
+    }
+
+    //============================================= Angles per angle set
+    const auto& so_groupings =
+      quadrature_unq_so_grouping_map_[groupset.quadrature_].first;
+    const auto num_ang_subsets =
+      static_cast<size_t>(groupset.master_num_ang_subsets_);
+    size_t num_angles = 1;
+    for (const auto& so_grouping : so_groupings)
+      num_angles =
+        std::max(num_angles,
+                 (so_grouping.size() + num_ang_subsets - 1) / num_ang_subsets);
+
+    //============================================= Outgoing values per group
+    // Roughly half of the faces on the partition boundary are outgoing for
+    // any direction.
+    const auto& grid = *grid_ptr_;
+    size_t num_nonlocal_face_nodes = 0;
+    for (const auto& cell : grid.local_cells)
+    {
+      const auto& cell_mapping = discretization_->GetCellMapping(cell);
+      for (size_t f = 0; f < cell.faces_.size(); ++f)
+      {
+        const auto& face = cell.faces_[f];
+        if (face.has_neighbor_ and not face.IsNeighborLocal(grid))
+          num_nonlocal_face_nodes += cell_mapping.NumFaceNodes(f);
+      }
+    }
+    const size_t message_values_per_group =
+      std::max<size_t>(1, num_nonlocal_face_nodes * num_angles / 2);
+
+    //============================================= Measure costs
+    const double cell_cost = MeasureCellSweepCost(num_groups);
+    const double latency = MeasureSweepMessageTime(1);
+    const double message_time =
+      MeasureSweepMessageTime(message_values_per_group * num_groups);
+    const double transfer_time = std::max(0.0, message_time - latency);
+
+    double local_costs[2] = {
+      static_cast<double>(grid.local_cells.size() * num_angles * num_groups) *
+          cell_cost +
+        transfer_time,
+      latency};
+    double global_costs[2] = {0.0, 0.0};
+    MPI_Allreduce(
+      local_costs, global_costs, 2, MPI_DOUBLE, MPI_MAX, Chi::mpi.comm);
+
+    num_subsets = SweepScheduler::OptimalNumPipelineChunks(
+      num_stages, global_costs[0], global_costs[1], num_groups);
+
+    Chi::log.Log() << "Groupset " << groupset.id_ << " pipeline tuning: "
+                   << num_stages << " stages, angle set sweep time "
+                   << global_costs[0] << " s, message latency "
+                   << global_costs[1] << " s.";
+  }
+
+  num_subsets = std::max<size_t>(1, std::min(num_subsets, num_groups));
+
+  Chi::log.Log() << "Groupset " << groupset.id_ << " is swept pipelined over "
+                 << num_subsets << " group subsets.";
+
+  const auto user_num_subsets =
+    static_cast<size_t>(groupset.master_num_grp_subsets_);
+  if (user_num_subsets != 1 and user_num_subsets != num_subsets)
+    Chi::log.Log0Warning()
+      << "Groupset " << groupset.id_ << ": \"groupset_num_subsets\" = "
+      << user_num_subsets << " is overridden by \"sweep_pipelining\" with "
+      << num_subsets << " group subsets.";
+
+  groupset.master_num_grp_subsets_ = static_cast<int>(num_subsets);
+  groupset.BuildSubsets();
+}
+
+// ###################################################################
+/**Returns the measured time, in seconds, of solving the cell system of a
+ * single cell, direction and group. The systems of up to 256 local cells
+ * are assembled from their unit cell matrices and solved for all groups
+ * with the same batched elimination the sweep chunks use.*/
+double
+lbs::DiscreteOrdinatesSolver::MeasureCellSweepCost(size_t num_groups) const
+{
+  const size_t max_num_cells = 256;
+  const size_t num_repeats = 4;
+
+  const size_t num_cells =
+    std::min(max_num_cells, static_cast<size_t>(unit_cell_matrices_.size()));
+  if (num_cells == 0 or num_groups == 0) return 0.0;
+
+  const double w = 1.0 / std::sqrt(3.0);
+  const std::vector<double> sigma(num_groups, 1.0);
+  std::vector<double> lane_work(2 * num_groups, 0.0);
+  std::vector<double> Awork, b;
+
+  chi::Timer timer;
+  double elapsed_ms = 0.0;
+  for (size_t c = 0; c < num_cells; ++c)
+  {
+    const auto cell_matrices = unit_cell_matrices_[c];
+    const size_t n = cell_matrices.NumNodes();
+    const auto G = cell_matrices.G();
+    const auto M = cell_matrices.M();
+
+    MatDbl A(n, VecDbl(n, 0.0));
+    Awork.assign(n * n * num_groups, 0.0);
+
+    timer.Reset();
+    for (size_t r = 0; r < num_repeats; ++r)
+    {
+      for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j)
+          A[i][j] = w * (G.Component(0)[i * n + j] +
+                         G.Component(1)[i * n + j] +
+                         G.Component(2)[i * n + j]);
+
+      b.assign(n * num_groups, 1.0);
+      chi_math::BatchedGaussElimination<0>(static_cast<int>(n),
+                                           A,
+                                           M,
+                                           sigma.data(),
+                                           num_groups,
+                                           Awork.data(),
+                                           b.data(),
+                                           lane_work.data());
+    }
+    elapsed_ms += timer.GetTime();
+  }
+
+  return elapsed_ms * 1.0e-3 /
+         static_cast<double>(num_cells * num_repeats * num_groups);
+}
+
+// ###################################################################
+/**Returns the measured time, in seconds, of exchanging a message of the
+ * given number of doubles with every location sharing a face with this
+ * location. Must be called by all locations.
+ *
+ * All locations probe with the largest requested size so that the
+ * exchanged messages match. Probe messages are capped at
+ * `max_probe_size` doubles, larger sizes are extrapolated linearly from
+ * the times of a single double and of a capped message.*/
+double lbs::DiscreteOrdinatesSolver::MeasureSweepMessageTime(
+  size_t message_size) const
+{
+  const int num_repeats = 10;
+  const int tag = 101;
+  const size_t max_probe_size = 1 << 20;
+
+  uint64_t local_size = message_size;
+  uint64_t global_size = 0;
+  chi::MPI_Info::Call(MPI_Allreduce(&local_size,
+                                    &global_size,
+                                    1,
+                                    MPI_UINT64_T,
+                                    MPI_MAX,
+                                    Chi::mpi.comm));
+  message_size = std::max<size_t>(1, global_size);
+
+  //============================================= Extrapolate large messages
+  if (message_size > max_probe_size)
+  {
+    const double latency = MeasureSweepMessageTime(1);
+    const double probe_time = MeasureSweepMessageTime(max_probe_size);
+    const double time_per_value =
+      std::max(0.0, probe_time - latency) /
+      static_cast<double>(max_probe_size - 1);
+    return latency +
+           time_per_value * static_cast<double>(message_size - 1);
+  }
+
+  const auto& grid = *grid_ptr_;
+  std::set<int> neighbor_locations;
+  for (const auto& cell : grid.local_cells)
+    for (const auto& face : cell.faces_)
+      if (face.has_neighbor_ and not face.IsNeighborLocal(grid))
+        neighbor_locations.insert(face.GetNeighborPartitionID(grid));
+
+  const size_t num_neighbors = neighbor_locations.size();
+  const int count = static_cast<int>(message_size);
+  std::vector<double> send_buffer(message_size, 0.0);
+  std::vector<std::vector<double>> recv_buffers(
+    num_neighbors, std::vector<double>(message_size, 0.0));
+  std::vector<MPI_Request> requests(2 * num_neighbors, MPI_REQUEST_NULL);
+
+  Chi::mpi.Barrier();
+  chi::Timer timer;
+  for (int r = 0; r < num_repeats; ++r)
+  {
+    size_t k = 0;
+    for (int location : neighbor_locations)
+    {
+      chi::MPI_Info::Call(MPI_Irecv(recv_buffers[k].data(), // buf
+                                    count,                  // count
+                                    MPI_DOUBLE,             // datatype
+                                    location,               // source
+                                    tag,                    // tag
+                                    Chi::mpi.comm,          // comm
+                                    &requests[2 * k]));     // request
+      chi::MPI_Info::Call(MPI_Isend(send_buffer.data(),     // buf
+                                    count,                  // count
+                                    MPI_DOUBLE,             // datatype
+                                    location,               // destination
+                                    tag,                    // tag
+                                    Chi::mpi.comm,          // comm
+                                    &requests[2 * k + 1])); // request
+      ++k;
+    }
+    chi::MPI_Info::Call(MPI_Waitall(static_cast<int>(requests.size()),
+                                    requests.data(),
+                                    MPI_STATUSES_IGNORE));
+  }
+  const double elapsed_ms = timer.GetTime();
+
+  if (num_neighbors == 0) return 0.0;
+  return elapsed_ms * 1.0e-3 / num_repeats;
+}
@@ -34,6 +34,10 @@ protected:
 
   std::vector<size_t> verbose_sweep_angles_;
   const std::string sweep_type_;
+  const size_t sweep_num_threads_ = 1;
+  const bool single_precision_psi_ = false;
+  const bool sweep_pipelining_ = false;
+  const size_t sweep_pipeline_chunk_size_ = 0;
 
 public:
   static chi::InputParameters GetInputParameters();
@@ -44,6 +48,7 @@ protected:
 
 public:
   const std::string& SweepType() const {return sweep_type_;}
+  bool SweepPipelining() const {return sweep_pipelining_;}
   virtual ~DiscreteOrdinatesSolver() override;
 
   std::pair<size_t, size_t> GetNumPhiIterativeUnknowns() override;
@@ -64,6 +69,9 @@ protected:
                             lbs::GeometryType lbs_geo_type);
   void InitFluxDataStructures(LBSGroupset& groupset);
   void ResetSweepOrderings(LBSGroupset& groupset);
+  void TuneGroupsetPipelining(LBSGroupset& groupset);
+  double MeasureCellSweepCost(size_t num_groups) const;
+  double MeasureSweepMessageTime(size_t message_size) const;
   virtual std::shared_ptr<SweepChunk> SetSweepChunk(LBSGroupset& groupset);
 
   // Vector assembly
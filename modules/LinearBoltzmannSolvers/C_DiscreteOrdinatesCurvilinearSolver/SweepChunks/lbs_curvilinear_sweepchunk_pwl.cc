@@ -13,8 +13,8 @@ namespace lbs
 SweepChunkPWLRZ::SweepChunkPWLRZ(
   const chi_mesh::MeshContinuum& grid,
   const chi_math::SpatialDiscretization& discretization_primary,
-  const std::vector<lbs::UnitCellMatrices>& unit_cell_matrices,
-  const std::vector<lbs::UnitCellMatrices>& secondary_unit_cell_matrices,
+  const lbs::UnitCellMatricesStore& unit_cell_matrices,
+  const lbs::UnitCellMatricesStore& secondary_unit_cell_matrices,
   std::vector<lbs::CellLBSView>& cell_transport_views,
   std::vector<double>& destination_phi,
   std::vector<double>& destination_psi,
@@ -91,16 +91,16 @@ SweepChunkPWLRZ::SweepChunkPWLRZ(
 
   post_cell_dir_sweep_callbacks_.push_back(
     std::bind(&SweepChunkPWLRZ::PostCellDirSweepCallback, this));
+
+  // The callback lists differ from the standard ones
+  use_composed_kernels_ = false;
 }
 
 // ##################################################################
 /**Cell data callback.*/
 void SweepChunkPWLRZ::CellDataCallback()
 {
-  const auto& fe_intgrl_values_secondary =
-    secondary_unit_cell_matrices_[cell_local_id_];
-
-  Maux_ = &fe_intgrl_values_secondary.M_matrix;
+  Maux_ = secondary_unit_cell_matrices_[cell_local_id_].M();
 }
 
 // ##################################################################
@@ -141,8 +141,8 @@ void SweepChunkPWLRZ::PostCellDirSweepCallback()
 /**Assembles the volumetric gradient term.*/
 void SweepChunkPWLRZ::KernelFEMRZVolumetricGradientTerm()
 {
-  const auto& G = *G_;
-  const auto& Maux = *Maux_;
+  const auto G = cell_matrices_.G();
+  const auto& Maux = Maux_;
 
   for (int i = 0; i < cell_num_nodes_; ++i)
     for (int j = 0; j < cell_num_nodes_; ++j)
@@ -179,7 +179,7 @@ void SweepChunkPWLRZ::KernelFEMRZUpwindSurfaceIntegrals()
     if (incident_on_symmetric_boundary) return;
   }
 
-  const auto& M_surf_f = (*M_surf_)[f];
+  const auto M_surf_f = cell_matrices_.FaceM(f);
   const double mu = face_mu_values_[f];
   const size_t num_face_nodes = cell_mapping_->NumFaceNodes(f);
   for (int fi = 0; fi < num_face_nodes; ++fi)
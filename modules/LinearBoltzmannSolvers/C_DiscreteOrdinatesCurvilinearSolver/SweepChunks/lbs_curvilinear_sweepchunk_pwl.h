@@ -13,7 +13,7 @@ class SweepChunkPWLRZ : public lbs::AAH_SweepChunk
 {
   //  Attributes
 private:
-  const std::vector<lbs::UnitCellMatrices>& secondary_unit_cell_matrices_;
+  const lbs::UnitCellMatricesStore& secondary_unit_cell_matrices_;
   /** Unknown manager. */
   chi_math::UnknownManager unknown_manager_;
   /** Sweeping dependency angular intensity (for each polar level). */
@@ -24,7 +24,7 @@ private:
   chi_mesh::Vector3 normal_vector_boundary_;
 
   // Runtime params
-  const MatDbl*  Maux_ = nullptr;
+  DenseMatrixView Maux_;
 
   unsigned int polar_level_ = 0;
   double fac_diamond_difference_ = 0.0;
@@ -36,8 +36,8 @@ public:
   SweepChunkPWLRZ(
     const chi_mesh::MeshContinuum& grid,
     const chi_math::SpatialDiscretization& discretization_primary,
-    const std::vector<lbs::UnitCellMatrices>& unit_cell_matrices,
-    const std::vector<lbs::UnitCellMatrices>& secondary_unit_cell_matrices,
+    const lbs::UnitCellMatricesStore& unit_cell_matrices,
+    const lbs::UnitCellMatricesStore& secondary_unit_cell_matrices,
     std::vector<lbs::CellLBSView>& cell_transport_views,
     std::vector<double>& destination_phi,
     std::vector<double>& destination_psi,
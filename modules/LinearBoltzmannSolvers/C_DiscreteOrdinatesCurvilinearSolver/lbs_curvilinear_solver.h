@@ -18,7 +18,7 @@ private:
   /** Discretisation pointer to matrices of the secondary cell view
    *  (matrices of the primary cell view forwarded to the base class). */
   std::shared_ptr<chi_math::SpatialDiscretization> discretization_secondary_;
-  std::vector<lbs::UnitCellMatrices> secondary_unit_cell_matrices_;
+  lbs::UnitCellMatricesStore secondary_unit_cell_matrices_;
 
   //  Methods
 public:
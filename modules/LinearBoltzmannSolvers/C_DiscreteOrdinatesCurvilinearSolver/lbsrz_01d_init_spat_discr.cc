@@ -136,12 +136,14 @@ void DiscreteOrdinatesCurvilinearSolver::ComputeSecondaryUnitIntegrals()
   };
 
   const size_t num_local_cells = grid_ptr_->local_cells.size();
-  secondary_unit_cell_matrices_.resize(num_local_cells);
+  std::vector<lbs::UnitCellMatrices> local_unit_cell_matrices(num_local_cells);
 
   for (const auto& cell : grid_ptr_->local_cells)
-    secondary_unit_cell_matrices_[cell.local_id_] =
+    local_unit_cell_matrices[cell.local_id_] =
       ComputeCellUnitIntegrals(cell, *swf_ptr);
 
+  secondary_unit_cell_matrices_.Assign(local_unit_cell_matrices);
+
   Chi::mpi.Barrier();
   Chi::log.Log()
     << "Secondary Cell matrices computed.         Process memory = "
@@ -11,7 +11,7 @@ lbs::SweepChunkPWLTransientTheta::
 SweepChunkPWLTransientTheta(
   std::shared_ptr<chi_mesh::MeshContinuum> grid_ptr,
   chi_math::SpatialDiscretization& discretization,
-  const std::vector<UnitCellMatrices>& unit_cell_matrices,
+  const UnitCellMatricesStore& unit_cell_matrices,
   std::vector<lbs::CellLBSView>& cell_transport_views,
   std::vector<double>& destination_phi,
   std::vector<double>& destination_psi,
@@ -130,7 +130,7 @@ void lbs::SweepChunkPWLTransientTheta::
     const auto& cell = grid_view_->local_cells[cell_local_id];
     const auto num_faces = cell.faces_.size();
     const auto& cell_mapping = grid_fe_view_.GetCellMapping(cell);
-    const auto& fe_intgrl_values = unit_cell_matrices_[cell_local_id];
+    const auto fe_intgrl_values = unit_cell_matrices_[cell_local_id];
     const int num_nodes = static_cast<int>(cell_mapping.NumNodes());
     auto& transport_view = grid_transport_view_[cell.local_id_];
     const auto& sigma_tg = transport_view.XS().SigmaTotal();
@@ -146,10 +146,8 @@ void lbs::SweepChunkPWLTransientTheta::
       tau_gsg[gsg] = inv_velg[gs_gi+gsg]*inv_theta*inv_dt;
 
     // =================================================== Get Cell matrices
-    const auto& G           = fe_intgrl_values.G_matrix;
-    const auto& M           = fe_intgrl_values.M_matrix;
-    const auto& M_surf      = fe_intgrl_values.face_M_matrices;
-    const auto& IntS_shapeI = fe_intgrl_values.face_Si_vectors;
+    const auto  G           = fe_intgrl_values.G();
+    const auto  M           = fe_intgrl_values.M();
 
     // =================================================== Loop over angles in set
     const int ni_deploc_face_counter = deploc_face_counter;
@@ -204,6 +202,7 @@ void lbs::SweepChunkPWLTransientTheta::
         upwind.bndry_id = bndry_id;
         upwind.f = f;
 
+        const auto M_surf_f = fe_intgrl_values.FaceM(f);
         const size_t num_face_indices = face.vertex_ids_.size();
         for (int fi = 0; fi < num_face_indices; ++fi)
         {
@@ -214,7 +213,7 @@ void lbs::SweepChunkPWLTransientTheta::
 
             const double* psi = upwind.GetUpwindPsi(fj, local, boundary);
 
-            const double mu_Nij = -mu * M_surf[f][i][j];
+            const double mu_Nij = -mu * M_surf_f[i][j];
             Amat_[i][j] += mu_Nij;
             for (int gsg = 0; gsg < gs_ss_size; ++gsg)
               b_[gsg][i] += psi[gsg] * mu_Nij;
@@ -304,7 +303,7 @@ void lbs::SweepChunkPWLTransientTheta::
         const bool local = transport_view.IsFaceLocal(f);
         const bool boundary = not face.has_neighbor_;
         const size_t num_face_indices = face.vertex_ids_.size();
-        const std::vector<double>& IntF_shapeI = IntS_shapeI[f];
+        const auto IntF_shapeI = fe_intgrl_values.FaceSi(f);
         const uint64_t bndry_id = face.neighbor_id_;
 
         bool reflecting_bndry = false;
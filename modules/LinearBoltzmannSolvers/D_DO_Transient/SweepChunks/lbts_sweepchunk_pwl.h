@@ -20,7 +20,7 @@ class SweepChunkPWLTransientTheta : public chi_mesh::sweep_management::SweepChun
 protected:
   const std::shared_ptr<chi_mesh::MeshContinuum> grid_view_;
   chi_math::SpatialDiscretization& grid_fe_view_;
-  const std::vector<UnitCellMatrices>& unit_cell_matrices_;
+  const UnitCellMatricesStore& unit_cell_matrices_;
   std::vector<lbs::CellLBSView>& grid_transport_view_;
   const std::vector<double>& q_moments_;
   LBSGroupset& groupset_;
@@ -47,7 +47,7 @@ public:
   SweepChunkPWLTransientTheta(
     std::shared_ptr<chi_mesh::MeshContinuum> grid_ptr,
     chi_math::SpatialDiscretization& discretization,
-    const std::vector<UnitCellMatrices>& unit_cell_matrices,
+    const UnitCellMatricesStore& unit_cell_matrices,
     std::vector<lbs::CellLBSView>& cell_transport_views,
     std::vector<double>& destination_phi,
     std::vector<double>& destination_psi,
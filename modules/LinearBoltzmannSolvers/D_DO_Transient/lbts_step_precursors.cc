@@ -22,7 +22,7 @@ void lbs::DiscOrdTransientSolver::StepPrecursors()
   // precursor_new_local(theta-flavor)
   for (auto& cell : grid_ptr_->local_cells)
   {
-    const auto& fe_values = unit_cell_matrices_[cell.local_id_];
+    const auto fe_values = unit_cell_matrices_[cell.local_id_];
     const auto& transport_view = cell_transport_views_[cell.local_id_];
     const double cell_volume = transport_view.Volume();
 
@@ -36,7 +36,7 @@ void lbs::DiscOrdTransientSolver::StepPrecursors()
     for (int i = 0; i < transport_view.NumNodes(); ++i)
     {
       const size_t uk_map = transport_view.MapDOF(i, 0, 0);
-      const double node_V_fraction = fe_values.Vi_vectors[i]/cell_volume;
+      const double node_V_fraction = fe_values.Vi()[i]/cell_volume;
 
       for (int g = 0; g < groups_.size(); ++g)
         delayed_fission += nu_delayed_sigma_f[g] *
@@ -22,6 +22,11 @@ void XXPowerIterationKEigen::Execute()
   double k_eff_prev = 1.0;
   double k_eff_change = 1.0;
 
+  //================================================== Setup the inners once
+  // The Krylov solvers, and their operators and work vectors, are kept
+  // across outer iterations. Each inner solve warm-starts from phi_old.
+  primary_ags_solver_->Setup();
+
   //================================================== Start power iterations
   int nit = 0;
   bool converged = false;
@@ -32,7 +37,6 @@ void XXPowerIterationKEigen::Execute()
     Scale(q_moments_local_, 1.0 / k_eff_);
 
     //================================= This solves the inners for transport
-    primary_ags_solver_->Setup();
     primary_ags_solver_->Solve();
 
     //================================= Recompute k-eigenvalue
@@ -40,6 +40,11 @@ void XXPowerIterationKEigenSCDSA::Execute()
   double k_eff_prev = 1.0;
   double k_eff_change = 1.0;
 
+  //================================================== Setup the inners once
+  // The Krylov solvers, and their operators and work vectors, are kept
+  // across outer iterations. Each inner solve warm-starts from phi_old.
+  primary_ags_solver_->Setup();
+
   //================================================== Start power iterations
   int nit = 0;
   bool converged = false;
@@ -53,7 +58,6 @@ void XXPowerIterationKEigenSCDSA::Execute()
     auto Sf0_ell = CopyOnlyPhi0(front_gs_, q_moments_local_);
 
     //================================= This solves the inners for transport
-    primary_ags_solver_->Setup();
     primary_ags_solver_->Solve();
 
     // lph_i = l + 1/2,i
@@ -0,0 +1,90 @@
+#include "data_types/flat_index_map.h"
+#include "mesh/chi_mesh.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum_vertexhandler.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_data_types_Test01(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_data_types_Test01,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_data_types_Test01);
+
+chi::ParameterBlock
+chi_data_types_Test01(const chi::InputParameters&)
+{
+  //======================================================= Flat index map
+  Chi::log.Log() << "Testing chi_data_types::FlatIndexMap";
+  {
+    chi_data_types::FlatIndexMap map;
+
+    ChiLogicalErrorIf(map.Find(7) != nullptr, "Empty map finds a key");
+
+    // Strided keys, inserted through several rehashes
+    const uint64_t num_keys = 10000;
+    for (uint64_t k = 0; k < num_keys; ++k)
+      ChiLogicalErrorIf(not map.Insert(k * 977 + 3, k), "Insert failed");
+
+    ChiLogicalErrorIf(map.Insert(3, 42), "Existing key was inserted");
+    ChiLogicalErrorIf(map.Size() != num_keys, "Wrong size");
+
+    for (uint64_t k = 0; k < num_keys; ++k)
+    {
+      const uint64_t* value = map.Find(k * 977 + 3);
+      ChiLogicalErrorIf(value == nullptr or *value != k, "Wrong value");
+      ChiLogicalErrorIf(map.Count(k * 977 + 4) != 0, "Found absent key");
+    }
+
+    map.Clear();
+    ChiLogicalErrorIf(map.Size() != 0 or map.Find(3) != nullptr,
+                      "Clear failed");
+  }
+  Chi::log.Log() << "chi_data_types::FlatIndexMap ... Passed";
+
+  //======================================================= Vertex handler
+  Chi::log.Log() << "Testing chi_mesh::VertexHandler";
+  {
+    chi_mesh::VertexHandler vertices;
+    for (uint64_t vid : {10, 2, 7, 30, 7, 0})
+      vertices.Insert(vid, chi_mesh::Vector3(double(vid), 0.0, 0.0));
+
+    ChiLogicalErrorIf(vertices.NumLocallyStored() != 5, "Wrong size");
+
+    uint64_t previous_vid = 0;
+    bool first = true;
+    for (const auto& [vid, vertex] : vertices)
+    {
+      ChiLogicalErrorIf(not first and vid <= previous_vid, "Not sorted");
+      ChiLogicalErrorIf(vertex.x != double(vid), "Wrong vertex");
+      previous_vid = vid;
+      first = false;
+    }
+
+    vertices[30].y = 1.0;
+    ChiLogicalErrorIf(vertices[30].y != 1.0, "Accessor failed");
+
+    bool threw = false;
+    try
+    {
+      vertices[3];
+    }
+    catch (const std::out_of_range&)
+    {
+      threw = true;
+    }
+    ChiLogicalErrorIf(not threw, "Absent vertex did not throw");
+  }
+  Chi::log.Log() << "chi_mesh::VertexHandler ... Passed";
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,27 @@
+-- Space-filling curve partitioning of a 512 cell mesh, replicated and
+-- distributed. Each of the 4 locations must receive exactly 128 cells.
+-- Also partitions the replicated mesh in parallel with PETSc.
+nodes = {-1.0,-0.75,-0.5,-0.25,0.0,0.25,0.5,0.75,1.0}
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create
+({
+  node_sets = {nodes,nodes,nodes},
+  partitioner = chi.SFCGraphPartitioner.Create({})
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+meshgen2 = chi_mesh.OrthogonalMeshGenerator.Create
+({
+  node_sets = {nodes,nodes,nodes},
+  distributed_setup = true,
+  partitioner = chi.SFCGraphPartitioner.Create({})
+})
+chi_mesh.MeshGenerator.Execute(meshgen2)
+
+meshgen3 = chi_mesh.OrthogonalMeshGenerator.Create
+({
+  node_sets = {nodes,nodes,nodes},
+  partitioner = chi.PETScGraphPartitioner.Create({parallel = true})
+})
+chi_mesh.MeshGenerator.Execute(meshgen3)
+
+--chiMeshHandlerExportMeshToVTK("ZMeshTest")
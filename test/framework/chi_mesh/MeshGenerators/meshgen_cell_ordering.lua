@@ -0,0 +1,20 @@
+-- Renumbers the local cells and checks the grid's lookups and face
+-- associations against the renumbered cells
+for _,ordering in pairs({"hilbert", "rcm"}) do
+  chiMeshHandlerCreate()
+  meshgen1 = chi_mesh.ExtruderMeshGenerator.Create
+  ({
+    inputs =
+    {
+      [0] = chi_mesh.FromFileMeshGenerator.Create
+      ({
+        filename="TriangleMesh2x2.obj"
+      }),
+    },
+    layers = {{z=1.1, n=2}, {z=2.1, n=3}},
+    cell_ordering = ordering
+  })
+  chi_mesh.MeshGenerator.Execute(meshgen1)
+
+  chi_unit_tests.chi_mesh_FaceAssociationsTest00()
+end
@@ -0,0 +1,128 @@
+-- Writes a partitioned mesh to a checkpoint and loads it back. The same
+-- problem, with a vacuum xmin boundary and a source in one corner, is
+-- solved on both meshes. The results depend on the vertices, the material
+-- ids and the boundary ids, so both solves must agree.
+-- Test: Relative difference-sum=0.0 and Relative difference-max=0.0
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+num_groups = 1
+for m=1,2 do
+  chiPhysicsMaterialAddProperty(materials[m],TRANSPORT_XSECTIONS)
+  chiPhysicsMaterialAddProperty(materials[m],ISOTROPIC_MG_SOURCE)
+  chiPhysicsMaterialSetProperty(materials[m],TRANSPORT_XSECTIONS,
+    SIMPLEXS1,num_groups,1.0,0.5)
+end
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,
+  FROM_ARRAY,{0.0})
+chiPhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,
+  FROM_ARRAY,{1.0})
+
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+
+--############################################### Solve on the current mesh
+-- Returns the integral and the maximum of the scalar flux.
+function SolveAndGetValues()
+  local lbs_block =
+  {
+    num_groups = num_groups,
+    groupsets =
+    {
+      {
+        groups_from_to = {0, num_groups-1},
+        angular_quadrature_handle = pquad0,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-8,
+        l_max_its = 300,
+        gmres_restart_interval = 100,
+      },
+    }
+  }
+
+  local boundary_conditions = {}
+  for _,name in pairs({"xmax","ymin","ymax","zmin","zmax"}) do
+    table.insert(boundary_conditions, {name = name, type = "reflecting"})
+  end
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys, { boundary_conditions = boundary_conditions,
+                         scattering_order = 0 })
+
+  local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  local fflist,count = chiLBSGetScalarFieldFunctionList(phys)
+
+  local values = {}
+  for k,op in pairs({OP_SUM, OP_MAX}) do
+    local ffi = chiFFInterpolationCreate(VOLUME)
+    chiFFInterpolationSetProperty(ffi,OPERATION,op)
+    chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+    chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,fflist[1])
+
+    chiFFInterpolationInitialize(ffi)
+    chiFFInterpolationExecute(ffi)
+    values[k] = chiFFInterpolationGetValue(ffi)
+  end
+  return values
+end
+
+--############################################### Original mesh
+nodes = {-1.0,-0.75,-0.5,-0.25,0.0,0.25,0.5,0.75,1.0}
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create
+({
+  node_sets = {nodes,nodes,nodes}
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+chiVolumeMesherSetMatIDToAll(0)
+vol1 = chi_mesh.RPPLogicalVolume.Create
+({ xmin=0.0,xmax=1.0,ymin=0.0,ymax=1.0,zmin=0.0,zmax=1.0 })
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+values_original = SolveAndGetValues()
+
+chiMeshHandlerExportMeshToCheckpoint("ZMeshCheckpoint")
+
+--############################################### Reloaded mesh
+chiMeshHandlerCreate()
+meshgen2 = chi_mesh.FromFileMeshGenerator.Create
+({
+  filename = "ZMeshCheckpoint.cmesh"
+})
+chi_mesh.MeshGenerator.Execute(meshgen2)
+
+chi_unit_tests.chi_mesh_FaceAssociationsTest00()
+
+values_reloaded = SolveAndGetValues()
+
+for k,name in pairs({"sum", "max"}) do
+  rel_diff = math.abs(values_reloaded[k] - values_original[k])/
+             values_original[k]
+  chiLog(LOG_0,string.format("Relative difference-%s=%.3e", name, rel_diff))
+end
+
+chiMPIBarrier()
+if (chi_location_id == 0) then
+  os.execute("rm ZMeshCheckpoint_*.cmesh")
+end
@@ -0,0 +1,19 @@
+-- Builds the connectivity of the test meshes with 1 and 4 threads. The
+-- time of each build is logged as "Cell connectivity established in".
+-- The face associations are checked on each resulting grid.
+mesh_path = "../../../../resources/TestMeshes/"
+for _,file in pairs({"TriangleMesh2x2SuperFine.obj",
+                     "gmsh_2d_unstruct1.msh",
+                     "Sphere.case"}) do
+  for _,num_threads in pairs({1, 4}) do
+    chiMeshHandlerCreate()
+    meshgen1 = chi_mesh.FromFileMeshGenerator.Create
+    ({
+      filename = mesh_path..file,
+      connectivity_num_threads = num_threads
+    })
+    chi_mesh.MeshGenerator.Execute(meshgen1)
+
+    chi_unit_tests.chi_mesh_FaceAssociationsTest00()
+  end
+end
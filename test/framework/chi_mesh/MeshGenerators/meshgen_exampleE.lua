@@ -0,0 +1,106 @@
+-- Distributed setup: each process generates/reads only a slab of the mesh.
+-- An infinite medium problem is solved on the replicated and on the
+-- distributed setup of the same mesh, both must give phi = q/sigma_a = 2.0.
+-- Test: Max-value=2.00000 and Relative difference=0.0
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Add material
+material = chiPhysicsAddMaterial("Test Material");
+chiPhysicsMaterialAddProperty(material,TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(material,ISOTROPIC_MG_SOURCE)
+
+num_groups = 1
+chiPhysicsMaterialSetProperty(material,TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,1.0,0.5)
+chiPhysicsMaterialSetProperty(material,ISOTROPIC_MG_SOURCE,FROM_ARRAY,{1.0})
+
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+
+--############################################### Solve on a mesh
+nodes = {-1.0,-0.75,-0.5,-0.25,0.0,0.25,0.5,0.75,1.0}
+function SolveAndGetMaxValue(distributed_setup)
+  chiMeshHandlerCreate()
+
+  local meshgen = chi_mesh.OrthogonalMeshGenerator.Create
+  ({
+    node_sets = {nodes,nodes,nodes},
+    distributed_setup = distributed_setup,
+    partitioner = chi.LinearGraphPartitioner.Create({})
+  })
+  chi_mesh.MeshGenerator.Execute(meshgen)
+  chiVolumeMesherSetMatIDToAll(0)
+
+  local lbs_block =
+  {
+    num_groups = num_groups,
+    groupsets =
+    {
+      {
+        groups_from_to = {0, num_groups-1},
+        angular_quadrature_handle = pquad0,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-8,
+        l_max_its = 300,
+        gmres_restart_interval = 100,
+      },
+    }
+  }
+
+  local boundary_conditions = {}
+  for _,name in pairs({"xmin","xmax","ymin","ymax","zmin","zmax"}) do
+    table.insert(boundary_conditions, {name = name, type = "reflecting"})
+  end
+
+  local phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys, { boundary_conditions = boundary_conditions,
+                         scattering_order = 0 })
+
+  local ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  local fflist,count = chiLBSGetScalarFieldFunctionList(phys)
+
+  local ffi = chiFFInterpolationCreate(VOLUME)
+  chiFFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+  chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+  chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,fflist[1])
+
+  chiFFInterpolationInitialize(ffi)
+  chiFFInterpolationExecute(ffi)
+  return chiFFInterpolationGetValue(ffi)
+end
+
+--############################################### Replicated vs distributed
+maxval_replicated = SolveAndGetMaxValue(false)
+maxval_distributed = SolveAndGetMaxValue(true)
+
+rel_diff = math.abs(maxval_distributed - maxval_replicated)/maxval_replicated
+chiLog(LOG_0,string.format("Max-value=%.5f", maxval_distributed))
+chiLog(LOG_0,string.format("Relative difference=%.3e", rel_diff))
+
+--############################################### Distributed read
+chiMeshHandlerCreate()
+meshgen2 = chi_mesh.FromFileMeshGenerator.Create
+({
+  filename = "../../../../resources/TestMeshes/gmsh_2d_unstruct1.msh",
+  distributed_setup = true
+})
+chi_mesh.MeshGenerator.Execute(meshgen2)
+
+--chiMeshHandlerExportMeshToVTK("ZMeshTest")
@@ -0,0 +1,15 @@
+-- Sweep-aware partitioning of a 512 cell cube over 4 locations. The best
+-- decomposition is a 2x2 tensor product with 3 sweep stages and a
+-- predicted sweep efficiency of 1/3.
+nodes = {-1.0,-0.75,-0.5,-0.25,0.0,0.25,0.5,0.75,1.0}
+meshgen1 = chi_mesh.OrthogonalMeshGenerator.Create
+({
+  node_sets = {nodes,nodes,nodes},
+  partitioner = chi.SweepGraphPartitioner.Create
+  ({
+    max_refinement_iterations = 4
+  })
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+--chiMeshHandlerExportMeshToVTK("ZMeshTest")
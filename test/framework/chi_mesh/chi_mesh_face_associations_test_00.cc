@@ -0,0 +1,90 @@
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <algorithm>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_mesh_FaceAssociationsTest00(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_mesh_FaceAssociationsTest00,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_mesh_FaceAssociationsTest00);
+
+/**Compares the precomputed face associations of the current grid with the
+ * associations found by searching the vertex lists.*/
+chi::ParameterBlock
+chi_mesh_FaceAssociationsTest00(const chi::InputParameters&)
+{
+  Chi::log.Log() << "Testing chi_mesh::CellFaceAssociations";
+
+  const auto& grid = *chi_mesh::GetCurrentHandler().GetGrid();
+  const auto& face_associations = grid.FaceAssociations();
+
+  ChiLogicalErrorIf(&face_associations != &grid.FaceAssociations(),
+                    "Face associations were not cached");
+
+  for (const auto& cell : grid.local_cells)
+  {
+    const uint64_t c = cell.local_id_;
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      const auto face_node_mapping = face_associations.FaceNodeMapping(c, f);
+      const auto cell_node_mapping = face_associations.CellNodeMapping(c, f);
+
+      if (not face.has_neighbor_)
+      {
+        ChiLogicalErrorIf(face_associations.AssociatedFace(c, f) != -1 or
+                            face_associations.NeighborIsLocal(c, f) or
+                            not face_node_mapping.empty() or
+                            not cell_node_mapping.empty(),
+                          "Boundary face has an association");
+        continue;
+      }
+
+      const auto& adj_cell = grid.cells[face.neighbor_id_];
+
+      ChiLogicalErrorIf(face_associations.AssociatedFace(c, f) !=
+                          face.GetNeighborAssociatedFace(grid),
+                        "Wrong associated face");
+      ChiLogicalErrorIf(face_associations.NeighborIsLocal(c, f) !=
+                          face.IsNeighborLocal(grid),
+                        "Wrong neighbor locality");
+      if (face.IsNeighborLocal(grid))
+        ChiLogicalErrorIf(face_associations.NeighborLocalID(c, f) !=
+                            adj_cell.local_id_,
+                          "Wrong neighbor local id");
+
+      std::vector<short> ref_face_node_mapping;
+      std::vector<short> ref_cell_node_mapping;
+      grid.FindAssociatedVertices(face, ref_face_node_mapping);
+      grid.FindAssociatedCellVertices(face, ref_cell_node_mapping);
+
+      ChiLogicalErrorIf(not std::equal(face_node_mapping.begin(),
+                                       face_node_mapping.end(),
+                                       ref_face_node_mapping.begin(),
+                                       ref_face_node_mapping.end()),
+                        "Wrong face-node mapping");
+      ChiLogicalErrorIf(not std::equal(cell_node_mapping.begin(),
+                                       cell_node_mapping.end(),
+                                       ref_cell_node_mapping.begin(),
+                                       ref_cell_node_mapping.end()),
+                        "Wrong cell-node mapping");
+    } // for f
+  }   // for cell
+
+  Chi::log.Log() << "Done testing chi_mesh::CellFaceAssociations";
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
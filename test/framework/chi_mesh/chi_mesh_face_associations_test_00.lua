@@ -0,0 +1,14 @@
+meshgen1 = chi_mesh.ExtruderMeshGenerator.Create
+({
+  inputs =
+  {
+    [0] = chi_mesh.FromFileMeshGenerator.Create
+    ({
+      filename="ReactorPinMesh.obj"
+    }),
+  },
+  layers = {{z=0.5, n=2}}
+})
+chi_mesh.MeshGenerator.Execute(meshgen1)
+
+chi_unit_tests.chi_mesh_FaceAssociationsTest00()
@@ -0,0 +1,101 @@
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <algorithm>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_mesh_PackedTopologyTest00(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_mesh_PackedTopologyTest00,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_mesh_PackedTopologyTest00);
+
+/**Compares the packed topology of the current grid with its cells.*/
+chi::ParameterBlock
+chi_mesh_PackedTopologyTest00(const chi::InputParameters&)
+{
+  Chi::log.Log() << "Testing chi_mesh::PackedCellTopology";
+
+  auto& grid = *chi_mesh::GetCurrentHandler().GetGrid();
+
+  ChiLogicalErrorIf(grid.HasPackedTopology(),
+                    "Packed topology exists before being built");
+
+  const auto& topology = grid.BuildPackedTopology();
+
+  ChiLogicalErrorIf(not grid.HasPackedTopology(),
+                    "Packed topology does not exist after being built");
+  ChiLogicalErrorIf(topology.NumCells() != grid.local_cells.size(),
+                    "Wrong number of cells");
+
+  size_t num_faces = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto cell_view = topology.GetCell(cell.local_id_);
+
+    ChiLogicalErrorIf(cell_view.GlobalID() != cell.global_id_,
+                      "Wrong global id");
+    ChiLogicalErrorIf(cell_view.Type() != cell.Type() or
+                        cell_view.SubType() != cell.SubType(),
+                      "Wrong cell type");
+    ChiLogicalErrorIf(cell_view.MaterialID() != cell.material_id_,
+                      "Wrong material id");
+    ChiLogicalErrorIf((cell_view.GetCentroid() - cell.centroid_).Norm() > 0,
+                      "Wrong cell centroid");
+
+    const auto vertex_ids = cell_view.VertexIDs();
+    ChiLogicalErrorIf(not std::equal(vertex_ids.begin(),
+                                     vertex_ids.end(),
+                                     cell.vertex_ids_.begin(),
+                                     cell.vertex_ids_.end()),
+                      "Wrong cell vertex ids");
+
+    ChiLogicalErrorIf(cell_view.NumFaces() != cell.faces_.size(),
+                      "Wrong number of faces");
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      const auto face_view = cell_view.GetFace(f);
+
+      const auto face_vertex_ids = face_view.VertexIDs();
+      ChiLogicalErrorIf(not std::equal(face_vertex_ids.begin(),
+                                       face_vertex_ids.end(),
+                                       face.vertex_ids_.begin(),
+                                       face.vertex_ids_.end()),
+                        "Wrong face vertex ids");
+      ChiLogicalErrorIf((face_view.GetNormal() - face.normal_).Norm() > 0,
+                        "Wrong face normal");
+      ChiLogicalErrorIf(
+        (face_view.GetCentroid() - face.centroid_).Norm() > 0,
+        "Wrong face centroid");
+      ChiLogicalErrorIf(face_view.HasNeighbor() != face.has_neighbor_ or
+                          face_view.NeighborID() != face.neighbor_id_,
+                        "Wrong face neighbor");
+    }
+    num_faces += cell.faces_.size();
+  }
+  ChiLogicalErrorIf(topology.NumFaces() != num_faces, "Wrong number of faces");
+
+  Chi::log.Log() << "Packed topology memory: " << topology.MemoryUsage()
+                 << " bytes for " << topology.NumCells() << " cells and "
+                 << topology.NumFaces() << " faces";
+
+  grid.ClearCellReferences();
+  ChiLogicalErrorIf(grid.HasPackedTopology(),
+                    "Packed topology exists after clearing the cells");
+
+  Chi::log.Log() << "Done testing chi_mesh::PackedCellTopology";
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
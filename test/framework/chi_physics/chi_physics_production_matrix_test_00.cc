@@ -0,0 +1,130 @@
+#include "physics/PhysicsMaterial/MultiGroupXS/single_state_mgxs.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "utils/chi_timer.h"
+
+#include "console/chi_console.h"
+
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters chi_physics_ProductionMatrixTest00_Syntax();
+chi::ParameterBlock
+chi_physics_ProductionMatrixTest00(const chi::InputParameters& params);
+
+RegisterWrapperFunction(
+  /*namespace_name=*/chi_unit_tests,
+  /*name_in_lua=*/chi_physics_ProductionMatrixTest00,
+  /*syntax_function=*/chi_physics_ProductionMatrixTest00_Syntax,
+  /*actual_function=*/chi_physics_ProductionMatrixTest00);
+
+chi::InputParameters chi_physics_ProductionMatrixTest00_Syntax()
+{
+  chi::InputParameters params;
+
+  params.AddRequiredParameter<std::string>(
+    "arg0", "Path to a fissionable Chi cross section file.");
+
+  return params;
+}
+
+/**Checks the dense and sparse production matrix views of a cross section
+ * file and times the view against the per-access copy it replaces.*/
+chi::ParameterBlock
+chi_physics_ProductionMatrixTest00(const chi::InputParameters& params)
+{
+  //======================================================= Views of a file
+  Chi::log.Log() << "Testing chi_physics::FlatProductionMatrix";
+  {
+    chi_physics::SingleStateMGXS xs;
+    xs.MakeFromChiXSFile(params.GetParamValue<std::string>("arg0"));
+
+    ChiLogicalErrorIf(not xs.IsFissionable(), "Expected fissionable xs");
+
+    const auto& F = xs.ProductionMatrix();
+    const size_t G = xs.NumGroups();
+    ChiLogicalErrorIf(F.NumGroups() != G, "Wrong number of groups");
+
+    // Dense and sparse rows hold the same entries
+    for (size_t g = 0; g < G; ++g)
+    {
+      std::vector<double> sparse_row(G, 0.0);
+      for (size_t k = F.SparseRowBegin(g); k < F.SparseRowEnd(g); ++k)
+        sparse_row[F.SparseCols()[k]] = F.SparseValues()[k];
+
+      for (size_t gp = 0; gp < G; ++gp)
+        ChiLogicalErrorIf(F.Row(g)[gp] != F(g, gp) or
+                            sparse_row[gp] != F(g, gp),
+                          "Dense and sparse views differ");
+    }
+
+    // Columns sum to the production cross section, for a unit spectrum
+    for (size_t gp = 0; gp < G; ++gp)
+    {
+      double column_sum = 0.0;
+      for (size_t g = 0; g < G; ++g)
+        column_sum += F(g, gp);
+      ChiLogicalErrorIf(std::fabs(column_sum - xs.NuSigmaF()[gp]) >
+                          1.0e-12 * std::fabs(xs.NuSigmaF()[gp]),
+                        "Production matrix inconsistent with nu-sigma_f");
+    }
+  }
+  Chi::log.Log() << "chi_physics::FlatProductionMatrix ... Passed";
+
+  //======================================================= Benchmark
+  // Mimics one fission source evaluation over many fissile cells with 172
+  // groups, once copying the nested matrix per cell, as the by-value
+  // accessor did, and once through the flat view.
+  {
+    const size_t G = 172;
+    const size_t num_cells = 2000;
+
+    std::vector<std::vector<double>> F_nested(G, std::vector<double>(G));
+    for (size_t g = 0; g < G; ++g)
+      for (size_t gp = 0; gp < G; ++gp)
+        F_nested[g][gp] = 1.0 / static_cast<double>(1 + g + gp);
+    const chi_physics::FlatProductionMatrix F(F_nested);
+
+    const std::vector<double> phi(G, 1.0);
+
+    chi::Timer timer;
+    double copy_sum = 0.0;
+    for (size_t c = 0; c < num_cells; ++c)
+    {
+      const std::vector<std::vector<double>> F_copy = F_nested;
+      for (size_t g = 0; g < G; ++g)
+        for (size_t gp = 0; gp < G; ++gp)
+          copy_sum += F_copy[g][gp] * phi[gp];
+    }
+    const double copy_time = timer.GetTime();
+
+    timer.Reset();
+    double view_sum = 0.0;
+    for (size_t c = 0; c < num_cells; ++c)
+      for (size_t g = 0; g < G; ++g)
+      {
+        const double* F_g = F.Row(g);
+        for (size_t gp = 0; gp < G; ++gp)
+          view_sum += F_g[gp] * phi[gp];
+      }
+    const double view_time = timer.GetTime();
+
+    ChiLogicalErrorIf(std::fabs(copy_sum - view_sum) > 1.0e-10 * copy_sum,
+                      "Copy and view results differ");
+
+    const double copied_MB = static_cast<double>(num_cells * G * G) *
+                             sizeof(double) / (1024.0 * 1024.0);
+    Chi::log.Log() << "Production matrix, " << G << " groups, "
+                   << num_cells << " cells: per-cell copy " << copy_time
+                   << " ms (" << copied_MB << " MB copied, "
+                   << num_cells * (G + 1) << " allocations), flat view "
+                   << view_time << " ms";
+  }
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,2 @@
+chi_unit_tests.chi_physics_ProductionMatrixTest00(
+  "../../modules/LinearBoltzmannSolvers/Transport_Keigen/xs_fuel_g2.cxs")
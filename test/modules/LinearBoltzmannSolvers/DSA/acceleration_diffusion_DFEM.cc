@@ -5,7 +5,7 @@
 
 #include "A_LBSSolver/Acceleration/acceleration.h"
 #include "A_LBSSolver/Acceleration/diffusion_mip.h"
-#include "LinearBoltzmannSolvers/A_LBSSolver/lbs_structs.h"
+#include "LinearBoltzmannSolvers/A_LBSSolver/lbs_unit_cell_matrices.h"
 
 #include "physics/FieldFunction/fieldfunction_gridbased.h"
 
@@ -154,6 +154,7 @@ acceleration_Diffusion_DFEM(const chi::InputParameters&)
                             IntS_shapeI_gradshapeJ,     //face G-matrices
                             IntS_shapeI};               //face Si-vectors
   }//for cell
+  const lbs::UnitCellMatricesStore unit_cell_matrices_store(unit_cell_matrices);
 
   //============================================= Make solver
   lbs::acceleration::DiffusionMIPSolver solver("SimTest92_DSA",
@@ -161,7 +162,7 @@ acceleration_Diffusion_DFEM(const chi::InputParameters&)
                                                OneDofPerNode,
                                                bcs,
                                                matid_2_xs_map,
-                                               unit_cell_matrices,
+                                               unit_cell_matrices_store,
                                                true);
   solver.options.ref_solution_lua_function = "MMS_phi";
   solver.options.source_lua_function = "MMS_q";
@@ -0,0 +1,121 @@
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "math/SpatialDiscretization/spatial_discretization.h"
+
+#include "A_LBSSolver/lbs_solver.h"
+#include "A_LBSSolver/Acceleration/acceleration.h"
+#include "A_LBSSolver/Acceleration/diffusion_mip.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::InputParameters acceleration_Diffusion_MIP_MatrixFree_Syntax();
+chi::ParameterBlock
+acceleration_Diffusion_MIP_MatrixFree(const chi::InputParameters& params);
+
+RegisterWrapperFunction(
+  /*namespace_name=*/chi_unit_tests,
+  /*name_in_lua=*/acceleration_Diffusion_MIP_MatrixFree,
+  /*syntax_function=*/acceleration_Diffusion_MIP_MatrixFree_Syntax,
+  /*actual_function=*/acceleration_Diffusion_MIP_MatrixFree);
+
+chi::InputParameters acceleration_Diffusion_MIP_MatrixFree_Syntax()
+{
+  chi::InputParameters params;
+
+  params.AddRequiredParameter<size_t>(
+    "arg0", "Handle to an initialized lbs solver.");
+
+  return params;
+}
+
+/**Builds the MIP operator of all the groups of an lbs solver, once
+ * assembled and once matrix-free, and compares the product of both with
+ * the same vector. Boundaries with an even id are Robin and those with an
+ * odd id Dirichlet, so that all face kinds are exercised.*/
+chi::ParameterBlock
+acceleration_Diffusion_MIP_MatrixFree(const chi::InputParameters& params)
+{
+  typedef lbs::acceleration::DiffusionMIPSolver MIPSolver;
+  Chi::log.Log() << "Testing the matrix-free MIP operator";
+
+  const auto& lbs_solver = Chi::GetStackItem<lbs::LBSSolver>(
+    Chi::object_stack, params.GetParamValue<size_t>("arg0"), __FUNCTION__);
+
+  const auto& grid = lbs_solver.Grid();
+  const auto& sdm = lbs_solver.SpatialDiscretization();
+  const size_t num_groups = lbs_solver.NumGroups();
+
+  chi_math::UnknownManager uk_man;
+  uk_man.AddUnknown(chi_math::UnknownType::VECTOR_N, num_groups);
+
+  //============================================= Make boundary conditions
+  typedef lbs::acceleration::BoundaryCondition BC;
+  std::map<uint64_t, BC> bcs;
+  for (const auto& cell : grid.local_cells)
+    for (const auto& face : cell.faces_)
+      if (not face.has_neighbor_ and face.neighbor_id_ % 2 == 0)
+        bcs[face.neighbor_id_] = {lbs::acceleration::BCType::ROBIN,
+                                  {0.25, 0.5, 0.0}};
+
+  const auto matid_2_xs_map = lbs::acceleration::PackGroupsetXS(
+    lbs_solver.GetMatID2XSMap(), 0, static_cast<int>(num_groups) - 1);
+
+  //============================================= Make both solvers
+  MIPSolver assembled_solver("MIPAssembled", sdm, uk_man, bcs,
+                             matid_2_xs_map,
+                             lbs_solver.GetUnitCellMatrices(),
+                             /*verbose=*/false);
+  MIPSolver matrix_free_solver("MIPMatrixFree", sdm, uk_man, bcs,
+                               matid_2_xs_map,
+                               lbs_solver.GetUnitCellMatrices(),
+                               /*verbose=*/false);
+  matrix_free_solver.options.matrix_free = true;
+
+  std::vector<double> dummy_rhs(sdm.GetNumLocalDOFs(uk_man), 0.0);
+  for (auto* solver : {&assembled_solver, &matrix_free_solver})
+  {
+    solver->Initialize();
+    solver->AssembleAand_b(dummy_rhs);
+  }
+
+  //============================================= Apply both operators
+  Vec x, y_assembled, y_matrix_free;
+  VecDuplicate(assembled_solver.RHS(), &x);
+  VecDuplicate(x, &y_assembled);
+  VecDuplicate(x, &y_matrix_free);
+
+  PetscInt ir_begin, ir_end;
+  VecGetOwnershipRange(x, &ir_begin, &ir_end);
+  for (PetscInt ir = ir_begin; ir < ir_end; ++ir)
+    VecSetValue(x, ir, 1.0 + std::sin(0.1 * static_cast<double>(ir)),
+                INSERT_VALUES);
+  VecAssemblyBegin(x);
+  VecAssemblyEnd(x);
+
+  MatMult(assembled_solver.SystemMatrix(), x, y_assembled);
+  MatMult(matrix_free_solver.SystemMatrix(), x, y_matrix_free);
+
+  double ref_norm, diff_norm;
+  VecNorm(y_assembled, NORM_2, &ref_norm);
+  VecAXPY(y_matrix_free, -1.0, y_assembled);
+  VecNorm(y_matrix_free, NORM_2, &diff_norm);
+
+  VecDestroy(&x);
+  VecDestroy(&y_assembled);
+  VecDestroy(&y_matrix_free);
+
+  Chi::log.Log() << "MatShell relative difference=" << std::scientific
+                 << diff_norm / ref_norm;
+
+  return chi::ParameterBlock();
+}
+
+}//namespace chi_unit_tests
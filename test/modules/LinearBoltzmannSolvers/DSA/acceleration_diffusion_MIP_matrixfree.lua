@@ -0,0 +1,78 @@
+-- Compares the matrix-free MIP operator with the assembled one on a
+-- two material, two group problem.
+-- Test: MatShell relative difference=0.0
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+mesh={}
+N=8
+L=2
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  mesh[i] = xmin + k*dx
+end
+
+chiMeshCreateUnpartitioned2DOrthoMesh(mesh,mesh)
+chiVolumeMesherExecute();
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+
+chiVolumeMesherSetupOrthogonalBoundaries()
+
+vol1 = chi_mesh.RPPLogicalVolume.Create
+({ xmin=-0.5,xmax=0.5,ymin=-0.5,ymax=0.5, infz=true })
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+num_groups = 2
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,1.0,0.9)
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,0.1,0.5)
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2,false)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = pquad0,
+    },
+  }
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys1, { scattering_order = 0 })
+
+ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
+chiSolverInitialize(ss_solver)
+
+chi_unit_tests.acceleration_Diffusion_MIP_MatrixFree(phys1)
@@ -0,0 +1,250 @@
+#include "mesh/chi_mesh.h"
+#include "utils/chi_timer.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+SweepKernelDispatchBenchmark(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/SweepKernelDispatchBenchmark,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/SweepKernelDispatchBenchmark);
+
+namespace
+{
+
+constexpr int NUM_NODES = 4;
+constexpr int NUM_FACES = 4;
+constexpr int NUM_FACE_NODES = 2;
+constexpr int NUM_GROUPS = 4;
+
+// ##################################################################
+/**Mock sweep chunk with the kernel phases of lbs::SweepChunk.*/
+class MockSweepChunk
+{
+public:
+  typedef std::function<void()> CallbackFunction;
+
+  chi_mesh::Vector3 G_[NUM_NODES][NUM_NODES];
+  double M_surf_[NUM_FACES][NUM_NODES][NUM_NODES] = {};
+  double Amat_[NUM_NODES][NUM_NODES] = {};
+  double b_[NUM_GROUPS][NUM_NODES] = {};
+  double psi_upwind_[NUM_GROUPS] = {};
+  double phi_[NUM_GROUPS * NUM_NODES] = {};
+  double face_mu_values_[NUM_FACES] = {};
+
+  chi_mesh::Vector3 omega_;
+  int current_face_ = 0;
+
+  std::vector<CallbackFunction> direction_data_callbacks_and_kernels_;
+  std::vector<CallbackFunction> surface_integral_kernels_;
+  std::vector<CallbackFunction> flux_update_kernels_;
+  std::vector<CallbackFunction> post_cell_dir_sweep_callbacks_;
+
+  MockSweepChunk()
+  {
+    for (int i = 0; i < NUM_NODES; ++i)
+      for (int j = 0; j < NUM_NODES; ++j)
+      {
+        G_[i][j] = chi_mesh::Vector3(0.1 * i, 0.1 * j, 0.01 * (i + j));
+        for (int f = 0; f < NUM_FACES; ++f)
+          M_surf_[f][i][j] = 0.01 * (f + 1) * (i == j ? 2.0 : 1.0);
+      }
+    for (int gsg = 0; gsg < NUM_GROUPS; ++gsg)
+      psi_upwind_[gsg] = 1.0 / (gsg + 1);
+
+    direction_data_callbacks_and_kernels_ = {
+      std::bind(&MockSweepChunk::KernelVolumetricGradientTerm, this)};
+    surface_integral_kernels_ = {
+      std::bind(&MockSweepChunk::KernelUpwindSurfaceIntegrals, this)};
+    flux_update_kernels_ = {std::bind(&MockSweepChunk::KernelPhiUpdate, this)};
+    post_cell_dir_sweep_callbacks_ = {};
+  }
+
+  void KernelVolumetricGradientTerm()
+  {
+    for (int i = 0; i < NUM_NODES; ++i)
+      for (int j = 0; j < NUM_NODES; ++j)
+        Amat_[i][j] = omega_.Dot(G_[i][j]);
+  }
+
+  void KernelUpwindSurfaceIntegrals()
+  {
+    const int f = current_face_;
+    const double mu = face_mu_values_[f];
+    for (int fi = 0; fi < NUM_FACE_NODES; ++fi)
+    {
+      const int i = (f + fi) % NUM_NODES;
+      for (int fj = 0; fj < NUM_FACE_NODES; ++fj)
+      {
+        const int j = (f + fj) % NUM_NODES;
+        const double mu_Nij = -mu * M_surf_[f][i][j];
+        Amat_[i][j] += mu_Nij;
+        for (int gsg = 0; gsg < NUM_GROUPS; ++gsg)
+          b_[gsg][i] += psi_upwind_[gsg] * mu_Nij;
+      }
+    }
+  }
+
+  void KernelPhiUpdate()
+  {
+    for (int i = 0; i < NUM_NODES; ++i)
+      for (int gsg = 0; gsg < NUM_GROUPS; ++gsg)
+        phi_[i * NUM_GROUPS + gsg] += 1.0e-3 * (b_[gsg][i] + Amat_[i][i]);
+  }
+
+  static void ExecuteKernels(const std::vector<CallbackFunction>& kernels)
+  {
+    for (auto& kernel : kernels)
+      kernel();
+  }
+
+  /**Cell-angle loop body, mirroring AAH_SweepChunk::SweepImpl.*/
+  template <typename Kernels>
+  void Sweep(size_t num_cell_angles)
+  {
+    for (size_t n = 0; n < num_cell_angles; ++n)
+    {
+      const double theta = 1.0e-3 * static_cast<double>(n % 1000);
+      omega_ = chi_mesh::Vector3(std::cos(theta), std::sin(theta), 0.0);
+
+      for (auto& b_g : b_)
+        for (double& b_gi : b_g)
+          b_gi = 0.0;
+
+      Kernels::DirectionData(*this);
+
+      for (int f = 0; f < NUM_FACES; ++f)
+        face_mu_values_[f] = (f % 2 == 0 ? omega_.x : omega_.y);
+
+      for (int f = 0; f < NUM_FACES; ++f)
+      {
+        if (face_mu_values_[f] >= 0.0) continue;
+        current_face_ = f;
+        Kernels::SurfaceIntegrals(*this);
+      }
+
+      Kernels::FluxUpdate(*this);
+      Kernels::PostCellDirSweep(*this);
+    }
+  }
+
+  double Checksum() const
+  {
+    double sum = 0.0;
+    for (double value : phi_)
+      sum += value;
+    return sum;
+  }
+};
+
+/**Direct calls, the counterpart of lbs::StandardSweepKernels.*/
+struct ComposedKernels
+{
+  static void DirectionData(MockSweepChunk& chunk)
+  {
+    chunk.KernelVolumetricGradientTerm();
+  }
+  static void SurfaceIntegrals(MockSweepChunk& chunk)
+  {
+    chunk.KernelUpwindSurfaceIntegrals();
+  }
+  static void FluxUpdate(MockSweepChunk& chunk) { chunk.KernelPhiUpdate(); }
+  static void PostCellDirSweep(MockSweepChunk&) {}
+};
+
+/**Callback lists, the counterpart of lbs::RegisteredSweepKernels.*/
+struct RegisteredKernels
+{
+  static void DirectionData(MockSweepChunk& chunk)
+  {
+    MockSweepChunk::ExecuteKernels(chunk.direction_data_callbacks_and_kernels_);
+  }
+  static void SurfaceIntegrals(MockSweepChunk& chunk)
+  {
+    MockSweepChunk::ExecuteKernels(chunk.surface_integral_kernels_);
+  }
+  static void FluxUpdate(MockSweepChunk& chunk)
+  {
+    MockSweepChunk::ExecuteKernels(chunk.flux_update_kernels_);
+  }
+  static void PostCellDirSweep(MockSweepChunk& chunk)
+  {
+    MockSweepChunk::ExecuteKernels(chunk.post_cell_dir_sweep_callbacks_);
+  }
+};
+
+} // namespace
+
+// ##################################################################
+/**Micro-benchmark comparing the two ways a sweep chunk can dispatch its
+ * kernels per cell-angle pair: runtime registered std::function callback
+ * lists (lbs::RegisteredSweepKernels) and compile-time composed kernel
+ * policies (lbs::StandardSweepKernels). The mock chunk has the same phase
+ * structure and comparable kernel sizes as the standard PWLD kernels on a
+ * quadrilateral, without the mesh and FLUDS machinery.*/
+chi::ParameterBlock
+SweepKernelDispatchBenchmark(const chi::InputParameters&)
+{
+  const size_t num_cell_angles = 2000000;
+  const int num_repeats = 5;
+
+  // Best of several repeats to suppress noise
+  auto TimeSweep = [&](auto dispatch, double& checksum)
+  {
+    double best_time = 1.0e300;
+    for (int r = 0; r < num_repeats; ++r)
+    {
+      MockSweepChunk chunk;
+      chi::Timer timer;
+      dispatch(chunk);
+      best_time = std::min(best_time, timer.GetTime());
+      checksum = chunk.Checksum();
+    }
+    return best_time;
+  };
+
+  double checksum_registered = 0.0;
+  double checksum_composed = 0.0;
+
+  const double time_registered = TimeSweep(
+    [&](MockSweepChunk& chunk)
+    { chunk.Sweep<RegisteredKernels>(num_cell_angles); },
+    checksum_registered);
+  const double time_composed = TimeSweep(
+    [&](MockSweepChunk& chunk)
+    { chunk.Sweep<ComposedKernels>(num_cell_angles); },
+    checksum_composed);
+
+  const double to_ns = 1.0e6 / static_cast<double>(num_cell_angles);
+
+  Chi::log.Log() << "Sweep kernel dispatch benchmark, " << num_cell_angles
+                 << " cell-angle pairs";
+  Chi::log.Log() << "Registered (std::function) time per cell-angle [ns]: "
+                 << time_registered * to_ns;
+  Chi::log.Log() << "Composed (inlined) time per cell-angle [ns]: "
+                 << time_composed * to_ns;
+  Chi::log.Log() << "Dispatch overhead per cell-angle [ns]: "
+                 << (time_registered - time_composed) * to_ns;
+
+  if (checksum_registered == checksum_composed)
+    Chi::log.Log() << "Kernel dispatch results agree";
+  else
+    Chi::log.Log() << "Kernel dispatch results differ: " << checksum_registered
+                   << " vs " << checksum_composed;
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1 @@
+chi_unit_tests.SweepKernelDispatchBenchmark()
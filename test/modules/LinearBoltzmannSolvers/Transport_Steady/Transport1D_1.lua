@@ -2,6 +2,7 @@
 -- SDM: PWLD
 -- Test: Max-value=0.49903 and 7.18243e-4
 num_procs = 3
+if (single_precision_psi == nil) then single_precision_psi = false end
 
 
 
@@ -67,6 +68,7 @@ pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE,40)
 lbs_block =
 {
   num_groups = num_groups,
+  single_precision_psi = single_precision_psi,
   groupsets =
   {
     {
@@ -1,8 +1,11 @@
 -- 1D LinearBSolver test of a block of graphite with an air cavity. DSA and TG
+-- With wgdsa_batched=true the WGDSA groups are solved batched, the first
+-- groupset with a shared and the second with per-group preconditioners.
 -- SDM: PWLD
 -- Test: WGS groups [0-62] Iteration    28 Residual 6.74299e-07 CONVERGED
 -- and   WGS groups [63-167] Iteration    39 Residual 8.73816e-07 CONVERGED
 num_procs = 4
+if (wgdsa_batched == nil) then wgdsa_batched = false end
 
 
 
@@ -92,6 +95,7 @@ lbs_block =
       gmres_restart_interval = 30,
       apply_wgdsa = true,
       wgdsa_l_abs_tol = 1.0e-2,
+      wgdsa_batched = wgdsa_batched,
     },
     {
       groups_from_to = {63, num_groups-1},
@@ -105,6 +109,8 @@ lbs_block =
       apply_wgdsa = true,
       apply_tgdsa = true,
       wgdsa_l_abs_tol = 1.0e-2,
+      wgdsa_batched = wgdsa_batched,
+      wgdsa_batched_shared_pc = false,
     },
   }
 }
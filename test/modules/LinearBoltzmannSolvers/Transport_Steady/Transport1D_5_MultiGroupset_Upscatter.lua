@@ -0,0 +1,137 @@
+-- 1D LinearBSolver test of an infinite medium with two groupsets and
+-- up-scattering within the second groupset. Two materials share the same
+-- cross sections. The problem is solved, the cross sections are rebuilt in
+-- place and the problem is solved again.
+-- SDM: PWLD
+-- Test: Max-value1-g0..2=1.25000e+00, 7.01220e-01, 5.79268e-01
+-- and   Max-value2-g0..2=1.33333e+00, 4.44444e-01, 1.48148e-01
+num_procs = 2
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+mesh={}
+N=10
+L=10.0
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  mesh[i] = xmin + k*dx
+end
+chiMeshCreateUnpartitioned1DOrthoMesh(mesh)
+chiVolumeMesherExecute();
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+
+vol1 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true,
+                                        zmin=0.0, zmax=L})
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+num_groups = 3
+src={1.0, 0.0, 0.0}
+for m=1,2 do
+  chiPhysicsMaterialAddProperty(materials[m],TRANSPORT_XSECTIONS)
+  chiPhysicsMaterialAddProperty(materials[m],ISOTROPIC_MG_SOURCE)
+
+  chiPhysicsMaterialSetProperty(materials[m],TRANSPORT_XSECTIONS,
+    CHI_XSFILE,"upscatter_3g.cxs")
+  chiPhysicsMaterialSetProperty(materials[m],ISOTROPIC_MG_SOURCE,
+    FROM_ARRAY,src)
+end
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE,4)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, 0},
+      angular_quadrature_handle = pquad0,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-8,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+    {
+      groups_from_to = {1, num_groups-1},
+      angular_quadrature_handle = pquad0,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-8,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+  }
+}
+
+lbs_options =
+{
+  boundary_conditions =
+  {
+    { name = "zmin", type = "reflecting" },
+    { name = "zmax", type = "reflecting" },
+  },
+  scattering_order = 0,
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys1, lbs_options)
+
+--############################################### Initialize and Execute Solver
+ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
+
+chiSolverInitialize(ss_solver)
+
+vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+
+function SolveAndLogMaxValues(label)
+  chiSolverExecute(ss_solver)
+
+  local fflist,count = chiLBSGetScalarFieldFunctionList(phys1)
+  for g=1,num_groups do
+    local ffi = chiFFInterpolationCreate(VOLUME)
+    chiFFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+    chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+    chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,fflist[g])
+
+    chiFFInterpolationInitialize(ffi)
+    chiFFInterpolationExecute(ffi)
+    local maxval = chiFFInterpolationGetValue(ffi)
+
+    chiLog(LOG_0,string.format("Max-value%s-g%d=%.5e", label, g-1, maxval))
+  end
+end
+
+-- Analytic: phi = (sigma_t - S)^-1 q = {1.25, 0.2875/0.41, 0.2375/0.41}
+SolveAndLogMaxValues("1")
+
+--############################################### Rebuild the xs in place
+-- The sources must now be computed from the new transfer matrix,
+-- phi = {4/3, 4/9, 4/27}
+for m=1,2 do
+  chiPhysicsMaterialSetProperty(materials[m],TRANSPORT_XSECTIONS,
+    SIMPLEXS1,num_groups,1.0,0.5)
+end
+
+SolveAndLogMaxValues("2")
@@ -2,6 +2,8 @@
 -- SDM: PWLD
 -- Test: Max-value=0.50758 and 2.52527e-04
 num_procs = 4
+if (single_precision_psi == nil) then single_precision_psi = false end
+if (sweep_num_threads == nil) then sweep_num_threads = 1 end
 
 
 
@@ -74,6 +76,8 @@ chiOptimizeAngularQuadratureForPolarSymmetry(pqaud, 4.0*math.pi)
 lbs_block =
 {
   num_groups = num_groups,
+  single_precision_psi = single_precision_psi,
+  sweep_num_threads = sweep_num_threads,
   groupsets =
   {
     {
@@ -1,7 +1,12 @@
 -- 2D Transport test with Vacuum and Incident-isotropic BC.
 -- SDM: PWLD
+-- Optionally, pass cell_ordering="hilbert" or "rcm" to renumber the local
+-- cells after partitioning and apply_wgdsa=true to include the DSA
+-- assembly. Neither may change the solution.
 -- Test: Max-value=0.51187 and 1.42458e-03
 num_procs = 4
+if (single_precision_psi == nil) then single_precision_psi = false end
+if (apply_wgdsa == nil) then apply_wgdsa = false end
 --Unstructured mesh
 
 
@@ -33,6 +38,10 @@ chiVolumeMesherSetProperty(PARTITION_TYPE,KBA_STYLE_XYZ)
 chiSurfaceMesherExecute();
 chiVolumeMesherExecute();
 
+if (cell_ordering ~= nil) then
+  chiMeshHandlerReorderLocalCells(cell_ordering)
+end
+
 --############################################### Set Material IDs
 vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
 chiVolumeMesherSetMatIDToAll(0)
@@ -73,6 +82,7 @@ chiOptimizeAngularQuadratureForPolarSymmetry(pqaud, 4.0*math.pi)
 lbs_block =
 {
     num_groups = num_groups,
+    single_precision_psi = single_precision_psi,
     groupsets =
     {
         {
@@ -84,6 +94,8 @@ lbs_block =
             l_abs_tol = 1.0e-6,
             l_max_its = 300,
             gmres_restart_interval = 100,
+            apply_wgdsa = apply_wgdsa,
+            wgdsa_l_abs_tol = 1.0e-2,
         },
         {
             groups_from_to = {63, num_groups-1},
@@ -94,6 +106,8 @@ lbs_block =
             l_abs_tol = 1.0e-6,
             l_max_its = 300,
             gmres_restart_interval = 100,
+            apply_wgdsa = apply_wgdsa,
+            wgdsa_l_abs_tol = 1.0e-2,
         },
     }
 }
@@ -1,8 +1,10 @@
 -- 2D LinearBSolver test of a block of graphite with an air cavity. DSA and TG
+-- With wgdsa_matrix_free=true the WGDSA and TGDSA operators are matrix-free.
 -- SDM: PWLD
 -- Test: WGS groups [0-62] Iteration    53 Residual 5.96018e-07 CONVERGED
 -- and   WGS groups [63-167] Iteration    59 Residual 5.96296e-07 CONVERGED
 num_procs = 4
+if (wgdsa_matrix_free == nil) then wgdsa_matrix_free = false end
 
 
 
@@ -93,6 +95,7 @@ lbs_block =
       gmres_restart_interval = 30,
       apply_wgdsa = true,
       wgdsa_l_abs_tol = 1.0e-2,
+      wgdsa_matrix_free = wgdsa_matrix_free,
     },
     {
       groups_from_to = {63, num_groups-1},
@@ -106,6 +109,8 @@ lbs_block =
       apply_wgdsa = true,
       apply_tgdsa = true,
       wgdsa_l_abs_tol = 1.0e-2,
+      wgdsa_matrix_free = wgdsa_matrix_free,
+      tgdsa_matrix_free = wgdsa_matrix_free,
     },
   }
 }
@@ -2,7 +2,10 @@
 -- SDM: PWLD
 -- Test: Max-value=5.28310e-01 and 8.04576e-04
 num_procs = 4
+if (single_precision_psi == nil) then single_precision_psi = false end
 if (reflecting == nil) then reflecting = true end
+if (sweep_persistent_requests == nil) then sweep_persistent_requests = false end
+if (sweep_pipelining == nil) then sweep_pipelining = false end
 
 
 
@@ -68,6 +71,8 @@ pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
 lbs_block =
 {
   num_groups = num_groups,
+  single_precision_psi = single_precision_psi,
+  sweep_pipelining = sweep_pipelining,
   groupsets =
   {
     {
@@ -93,6 +98,7 @@ lbs_options =
   boundary_conditions = { { name = "xmin", type = "incident_isotropic",
                             group_strength=bsrc}},
   scattering_order = 1,
+  sweep_persistent_requests = sweep_persistent_requests,
 }
 if (reflecting) then
   table.insert(lbs_options.boundary_conditions,
@@ -2,6 +2,7 @@
 -- SDM: PWLD
 -- Test: Max-value=0.50758 and 2.52527e-04
 num_procs = 4
+if (sweep_num_threads == nil) then sweep_num_threads = 1 end
 
 
 
@@ -97,7 +98,8 @@ lbs_block =
       gmres_restart_interval = 100,
     },
   },
-  sweep_type = "CBC"
+  sweep_type = "CBC",
+  sweep_num_threads = sweep_num_threads
 }
 bsrc={}
 for g=1,num_groups do